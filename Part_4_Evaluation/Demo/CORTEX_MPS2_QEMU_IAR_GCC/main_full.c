@@ -48,10 +48,12 @@
  * "Check" task - This only executes every five (simulated) seconds.  Its main
  * function is to check the tests running in the standard demo tasks have never
  * failed and that all the tasks are still running.  If that is the case the
- * check task prints "PASS : nnnn (x)", where nnnn is the current tick count and
- * x is the number of times the interrupt nesting test executed while interrupts
- * were nested.  If the check task discovers a failed test or a stalled task
- * it prints a message that indicates which task reported the error or stalled.
+ * check task prints "PASS : nnnn (x) r tasks/s", where nnnn is the current tick
+ * count, x is the number of times the interrupt nesting test executed while
+ * interrupts were nested, and r is the rate measured by the task creation
+ * benchmark (see TaskCreateBench.c).  If the check task discovers a failed
+ * test or a stalled task it prints a message that indicates which task reported
+ * the error or stalled.
  * Normally the check task would have the highest priority to keep its timing
  * jitter to a minimum.  In this case the check task is run at the idle priority
  * to ensure other tasks are not stalled by it writing to a slow UART using a
@@ -94,6 +96,7 @@
 #include "TimerDemo.h"
 #include "StreamBufferInterrupt.h"
 #include "IntSemTest.h"
+#include "TaskCreateBench.h"
 
 /*-----------------------------------------------------------*/
 
@@ -103,6 +106,7 @@
 #define mainSEM_TEST_PRIORITY				( tskIDLE_PRIORITY + 1 )
 #define mainCREATOR_TASK_PRIORITY           ( tskIDLE_PRIORITY + 3 )
 #define mainGEN_QUEUE_TASK_PRIORITY			( tskIDLE_PRIORITY )
+#define mainCREATE_BENCH_PRIORITY			( tskIDLE_PRIORITY )
 
 /* Stack sizes are defined relative to configMINIMAL_STACK_SIZE so they scale
 across projects that have that constant set differently - in this case the
@@ -144,6 +148,10 @@ void main_full( void )
 	vStartStreamBufferInterruptDemo();
 	vStartInterruptSemaphoreTasks();
 
+	/* The benchmark does not block while it measures, so it runs at the idle
+	priority where it shares the processor instead of starving other tasks. */
+	vStartTaskCreateBenchmark( mainCREATE_BENCH_PRIORITY );
+
 	/* The suicide tasks must be created last as they need to know how many
 	tasks were running prior to their creation in order to ascertain whether
 	or not the correct/expected number of tasks are running at any given time. */
@@ -276,10 +284,14 @@ extern uint32_t ulNestCount;
 		{
 			pcMessage = "xAreInterruptSemaphoreTasksStillRunning() returned false";
 		}
+		else if( xIsTaskCreateBenchmarkStillRunning() != pdTRUE )
+		{
+			pcMessage = "xIsTaskCreateBenchmarkStillRunning() returned false";
+		}
 
 		/* It is normally not good to call printf() from an embedded system,
 		although it is ok in this simulated case. */
-		printf( "%s : %d (%d)\r\n", pcMessage, (int) xTaskGetTickCount(), ( int ) ulNestCount );
+		printf( "%s : %d (%d) %u tasks/s\r\n", pcMessage, (int) xTaskGetTickCount(), ( int ) ulNestCount, ( unsigned int ) ulGetTaskCreateBenchmarkRate() );
 	}
 }
 /*-----------------------------------------------------------*/
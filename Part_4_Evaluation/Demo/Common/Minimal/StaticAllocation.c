@@ -210,7 +210,8 @@
                            NULL,                               /* Parameter passed into the task - not used in this case. */
                            staticTASK_PRIORITY,                /* Priority of the task. */
                            &( uxCreatorTaskStackBuffer[ 0 ] ), /* The buffer to use as the task's stack. */
-                           &xCreatorTaskTCBBuffer );           /* The variable that will hold the task's TCB. */
+                           &xCreatorTaskTCBBuffer,             /* The variable that will hold the task's TCB. */
+                           0 );                                /* The number of lottery tickets held by the task. */
     }
 /*-----------------------------------------------------------*/
 
@@ -752,7 +753,8 @@
             NULL,                          /* Parameter to pass into the task. */
             uxTaskPriorityGet( NULL ) + 1, /* The priority of the task. */
             &( uxStackBuffer[ 0 ] ),       /* The buffer to use as the task's stack. */
-            &xTCBBuffer );                 /* The variable that will hold that task's TCB. */
+            &xTCBBuffer,                   /* The variable that will hold that task's TCB. */
+            0 );                           /* The number of lottery tickets held by the task. */
 
         /* Check the task was created correctly, then delete the task. */
         if( xCreatedTask == NULL )
@@ -0,0 +1,147 @@
+/*
+ * FreeRTOS V202212.01
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Measures how many tasks can be created and deleted per second, which is the
+ * cost configUSE_TASK_RECYCLING is intended to reduce.
+ *
+ * A single benchmark task repeatedly creates a job task with a stack of
+ * configMINIMAL_STACK_SIZE words, then deletes it again, for one second at a
+ * time.  Deleting the job from the benchmark task, rather than letting the job
+ * delete itself, frees (or recycles) its memory immediately instead of leaving
+ * it for the idle task, so every round trip pays the full cost of creation and
+ * deletion.  Build once with configUSE_TASK_RECYCLING set to 0 and once with it
+ * set to 1 and compare the rates returned by ulGetTaskCreateBenchmarkRate().
+ *
+ * The job tasks are created with no lottery tickets, so they are normally
+ * deleted before they ever run.  The measured rate includes any time taken by
+ * other tasks that run during the second, so is only comparable between
+ * builds of the same application.
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Demo program include files. */
+#include "TaskCreateBench.h"
+
+#define benchSTACK_SIZE        ( configMINIMAL_STACK_SIZE * 2 )
+#define benchJOB_STACK_SIZE    configMINIMAL_STACK_SIZE
+#define benchSAMPLE_PERIOD     pdMS_TO_TICKS( ( TickType_t ) 1000 )
+
+/* The task that creates and deletes the job tasks. */
+static portTASK_FUNCTION_PROTO( prvBenchmarkTask, pvParameters );
+
+/* The task function of the created and deleted tasks. */
+static portTASK_FUNCTION_PROTO( prvJobTask, pvParameters );
+
+/* The number of create/delete round trips completed in the most recent whole
+ * sample period. */
+static volatile uint32_t ulLastRate = 0;
+
+/* Used by the check function to tell that the benchmark is still completing
+ * sample periods, and that no job task failed to be created. */
+static volatile uint32_t ulSampleCount = 0;
+static volatile BaseType_t xErrorDetected = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vStartTaskCreateBenchmark( UBaseType_t uxPriority )
+{
+    xTaskCreate( prvBenchmarkTask, "CBench", benchSTACK_SIZE, NULL, uxPriority, NULL, 0 );
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulGetTaskCreateBenchmarkRate( void )
+{
+    return ulLastRate;
+}
+/*-----------------------------------------------------------*/
+
+static portTASK_FUNCTION( prvJobTask, pvParameters )
+{
+    /* Remove compiler warning about unused parameter. */
+    ( void ) pvParameters;
+
+    /* Should the job run before it is deleted, it has nothing to do. */
+    for( ; ; )
+    {
+        vTaskSuspend( NULL );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static portTASK_FUNCTION( prvBenchmarkTask, pvParameters )
+{
+    TaskHandle_t xJob;
+    TickType_t xStartTime;
+    uint32_t ulRoundTrips;
+
+    /* Remove compiler warning about unused parameter. */
+    ( void ) pvParameters;
+
+    for( ; ; )
+    {
+        ulRoundTrips = 0;
+
+        /* Start the sample on a tick boundary. */
+        vTaskDelay( ( TickType_t ) 1 );
+        xStartTime = xTaskGetTickCount();
+
+        while( ( xTaskGetTickCount() - xStartTime ) < benchSAMPLE_PERIOD )
+        {
+            if( xTaskCreate( prvJobTask, "Job", benchJOB_STACK_SIZE, NULL, tskIDLE_PRIORITY, &xJob, 0 ) == pdPASS )
+            {
+                vTaskDelete( xJob );
+                ulRoundTrips++;
+            }
+            else
+            {
+                xErrorDetected = pdTRUE;
+            }
+        }
+
+        ulLastRate = ( ulRoundTrips * ( uint32_t ) pdMS_TO_TICKS( 1000 ) ) / ( uint32_t ) benchSAMPLE_PERIOD;
+        ulSampleCount++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsTaskCreateBenchmarkStillRunning( void )
+{
+    static uint32_t ulLastSampleCount = 0;
+    BaseType_t xReturn = pdTRUE;
+
+    if( ( ulLastSampleCount == ulSampleCount ) || ( xErrorDetected != pdFALSE ) )
+    {
+        xReturn = pdFALSE;
+    }
+
+    ulLastSampleCount = ulSampleCount;
+
+    return xReturn;
+}
@@ -26,6 +26,9 @@
  *
  */
 
+/* Standard includes. */
+#include <stdlib.h>
+
 #include "FreeRTOS.h"
 #include "task.h"
 #include "croutine.h"
@@ -55,9 +58,29 @@
     static UBaseType_t uxTopCoRoutineReadyPriority = 0;
     static TickType_t xCoRoutineTickCount = 0, xLastTickCount = 0, xPassedTicks = 0;
 
+    #if ( configUSE_TICKETS == 1 )
+
+/* Sum of the tickets held by the co-routines in each ready list.  Kept up to
+ * date as co-routines enter and leave the ready lists so the lottery draw does
+ * not need to walk the list twice. */
+        static UBaseType_t uxReadyCoRoutineTickets[ configMAX_CO_ROUTINE_PRIORITIES ];
+    #endif
+
 /* The initial state of the co-routine when it is created. */
     #define corINITIAL_STATE    ( 0 )
 
+/*
+ * Keep uxReadyCoRoutineTickets in step with the ready lists.  Must be used
+ * whenever a co-routine is added to or removed from a ready list.
+ */
+    #if ( configUSE_TICKETS == 1 )
+        #define prvAddCoRoutineTickets( pxCRCB )       ( uxReadyCoRoutineTickets[ ( pxCRCB )->uxPriority ] += ( pxCRCB )->uxTickets )
+        #define prvRemoveCoRoutineTickets( pxCRCB )    ( uxReadyCoRoutineTickets[ ( pxCRCB )->uxPriority ] -= ( pxCRCB )->uxTickets )
+    #else
+        #define prvAddCoRoutineTickets( pxCRCB )
+        #define prvRemoveCoRoutineTickets( pxCRCB )
+    #endif
+
 /*
  * Place the co-routine represented by pxCRCB into the appropriate ready queue
  * for the priority.  It is inserted at the end of the list.
@@ -72,6 +95,7 @@
             uxTopCoRoutineReadyPriority = ( pxCRCB )->uxPriority;                                                               \
         }                                                                                                                       \
         vListInsertEnd( ( List_t * ) &( pxReadyCoRoutineLists[ ( pxCRCB )->uxPriority ] ), &( ( pxCRCB )->xGenericListItem ) ); \
+        prvAddCoRoutineTickets( pxCRCB );                                                                                       \
     }
 
 /*
@@ -98,11 +122,21 @@
  */
     static void prvCheckDelayedList( void );
 
+/*
+ * Draw a ticket among the co-routines in the ready list of priority
+ * uxPriority and return the co-routine that holds it.  The list must not be
+ * empty and the co-routines in it must hold at least one ticket between them.
+ */
+    #if ( configUSE_TICKETS == 1 )
+        static CRCB_t * prvSelectLotteryWinner( UBaseType_t uxPriority );
+    #endif
+
 /*-----------------------------------------------------------*/
 
     BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode,
                                  UBaseType_t uxPriority,
-                                 UBaseType_t uxIndex )
+                                 UBaseType_t uxIndex,
+                                 UBaseType_t uxTicketNumber )
     {
         BaseType_t xReturn;
         CRCB_t * pxCoRoutine;
@@ -132,6 +166,16 @@
             pxCoRoutine->uxIndex = uxIndex;
             pxCoRoutine->pxCoRoutineFunction = pxCoRoutineCode;
 
+            #if ( configUSE_TICKETS == 1 )
+            {
+                pxCoRoutine->uxTickets = uxTicketNumber;
+            }
+            #else
+            {
+                ( void ) uxTicketNumber;
+            }
+            #endif
+
             /* Initialise all the other co-routine control block parameters. */
             vListInitialiseItem( &( pxCoRoutine->xGenericListItem ) );
             vListInitialiseItem( &( pxCoRoutine->xEventListItem ) );
@@ -161,7 +205,7 @@
 /*-----------------------------------------------------------*/
 
     void vCoRoutineAddToDelayedList( TickType_t xTicksToDelay,
-                                     List_t * pxEventList )
+                                     EventList_t * pxEventList )
     {
         TickType_t xTimeToWake;
 
@@ -173,6 +217,7 @@
          * ourselves to the blocked list as the same list item is used for
          * both lists. */
         ( void ) uxListRemove( ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) );
+        prvRemoveCoRoutineTickets( pxCurrentCoRoutine );
 
         /* The list item will be inserted in wake time order. */
         listSET_LIST_ITEM_VALUE( &( pxCurrentCoRoutine->xGenericListItem ), xTimeToWake );
@@ -194,7 +239,7 @@
         {
             /* Also add the co-routine to an event list.  If this is done then the
              * function must be called with interrupts disabled. */
-            vListInsert( pxEventList, &( pxCurrentCoRoutine->xEventListItem ) );
+            listEVENT_LIST_INSERT( pxEventList, &( pxCurrentCoRoutine->xEventListItem ), pxCurrentCoRoutine->uxPriority );
         }
     }
 /*-----------------------------------------------------------*/
@@ -306,9 +351,20 @@
                 --uxTopCoRoutineReadyPriority;
             }
 
-            /* listGET_OWNER_OF_NEXT_ENTRY walks through the list, so the co-routines
-             * of the same priority get an equal share of the processor time. */
-            listGET_OWNER_OF_NEXT_ENTRY( pxCurrentCoRoutine, &( pxReadyCoRoutineLists[ uxTopCoRoutineReadyPriority ] ) );
+            #if ( configUSE_TICKETS == 1 )
+                if( uxReadyCoRoutineTickets[ uxTopCoRoutineReadyPriority ] > ( UBaseType_t ) 0 )
+                {
+                    /* The co-routines of the same priority share the processor
+                     * time in proportion to the tickets they hold. */
+                    pxCurrentCoRoutine = prvSelectLotteryWinner( uxTopCoRoutineReadyPriority );
+                }
+                else
+            #endif /* configUSE_TICKETS */
+            {
+                /* listGET_OWNER_OF_NEXT_ENTRY walks through the list, so the co-routines
+                 * of the same priority get an equal share of the processor time. */
+                listGET_OWNER_OF_NEXT_ENTRY( pxCurrentCoRoutine, &( pxReadyCoRoutineLists[ uxTopCoRoutineReadyPriority ] ) );
+            }
 
             /* Call the co-routine. */
             ( pxCurrentCoRoutine->pxCoRoutineFunction )( pxCurrentCoRoutine, pxCurrentCoRoutine->uxIndex );
@@ -323,6 +379,12 @@
         for( uxPriority = 0; uxPriority < configMAX_CO_ROUTINE_PRIORITIES; uxPriority++ )
         {
             vListInitialise( ( List_t * ) &( pxReadyCoRoutineLists[ uxPriority ] ) );
+
+            #if ( configUSE_TICKETS == 1 )
+            {
+                uxReadyCoRoutineTickets[ uxPriority ] = ( UBaseType_t ) 0;
+            }
+            #endif
         }
 
         vListInitialise( ( List_t * ) &xDelayedCoRoutineList1 );
@@ -336,7 +398,45 @@
     }
 /*-----------------------------------------------------------*/
 
-    BaseType_t xCoRoutineRemoveFromEventList( const List_t * pxEventList )
+    #if ( configUSE_TICKETS == 1 )
+
+        static CRCB_t * prvSelectLotteryWinner( UBaseType_t uxPriority )
+        {
+            const List_t * const pxReadyList = &( pxReadyCoRoutineLists[ uxPriority ] );
+            const ListItem_t * pxListItem;
+            CRCB_t * pxWinner;
+            UBaseType_t uxWinningTicket, uxAccumulatedTickets = 0;
+
+            configASSERT( uxReadyCoRoutineTickets[ uxPriority ] > ( UBaseType_t ) 0 );
+
+            /* Tickets are numbered from 1 to the total held by the list. */
+            uxWinningTicket = ( ( UBaseType_t ) rand() % uxReadyCoRoutineTickets[ uxPriority ] ) + ( UBaseType_t ) 1;
+
+            /* Walk the list from its head, accumulating tickets until the
+             * winning ticket is reached.  The total guarantees the walk ends
+             * before the list end marker. */
+            pxListItem = listGET_HEAD_ENTRY( pxReadyList );
+
+            for( ; ; )
+            {
+                pxWinner = ( CRCB_t * ) listGET_LIST_ITEM_OWNER( pxListItem );
+                uxAccumulatedTickets += pxWinner->uxTickets;
+
+                if( uxAccumulatedTickets >= uxWinningTicket )
+                {
+                    break;
+                }
+
+                pxListItem = listGET_NEXT( pxListItem );
+            }
+
+            return pxWinner;
+        }
+
+    #endif /* configUSE_TICKETS */
+/*-----------------------------------------------------------*/
+
+    BaseType_t xCoRoutineRemoveFromEventList( EventList_t * pxEventList )
     {
         CRCB_t * pxUnblockedCRCB;
         BaseType_t xReturn;
@@ -344,7 +444,7 @@
         /* This function is called from within an interrupt.  It can only access
          * event lists and the pending ready list.  This function assumes that a
          * check has already been made to ensure pxEventList is not empty. */
-        pxUnblockedCRCB = ( CRCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
+        pxUnblockedCRCB = ( CRCB_t * ) listGET_LIST_ITEM_OWNER( listEVENT_LIST_GET_HEAD_ENTRY( pxEventList ) );
         ( void ) uxListRemove( &( pxUnblockedCRCB->xEventListItem ) );
         vListInsertEnd( ( List_t * ) &( xPendingReadyCoRoutineList ), &( pxUnblockedCRCB->xEventListItem ) );
 
@@ -61,10 +61,30 @@
     #define eventEVENT_BITS_CONTROL_BYTES    0xff000000UL
 #endif
 
+/* The event bits that cannot be used by the application, and the number that
+ * can.  When configUSE_WIDE_EVENT_GROUPS is 1 the bits a task waits for are
+ * held in its TCB rather than its event list item value, so only the control
+ * bits are kept in the item value and all 64 event bits are available. */
+#if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+    #define eventRESERVED_EVENT_BITS    ( ( EventBits_t ) 0 )
+    #define eventNUMBER_OF_BITS         ( 64U )
+#elif configUSE_16_BIT_TICKS == 1
+    #define eventRESERVED_EVENT_BITS    ( ( EventBits_t ) eventEVENT_BITS_CONTROL_BYTES )
+    #define eventNUMBER_OF_BITS         ( 8U )
+#else
+    #define eventRESERVED_EVENT_BITS    ( ( EventBits_t ) eventEVENT_BITS_CONTROL_BYTES )
+    #define eventNUMBER_OF_BITS         ( 24U )
+#endif
+
 typedef struct EventGroupDef_t
 {
     EventBits_t uxEventBits;
-    List_t xTasksWaitingForBits; /*< List of tasks waiting for a bit to be set. */
+    List_t xTasksWaitingForBits; /*< List of tasks waiting for a bit to be set.  If configUSE_EVENT_GROUP_BIT_INDEX is 1 this only holds the tasks waiting for any one of several bits. */
+
+    #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+        EventBits_t uxIndexedBits;                                  /*< One bit per list in xTasksWaitingForBit[] that may hold tasks.  Cleared lazily as tasks that time out are removed by the scheduler. */
+        List_t xTasksWaitingForBit[ eventNUMBER_OF_BITS ];          /*< Tasks that cannot be unblocked until bit n is set are held in xTasksWaitingForBit[ n ]. */
+    #endif
 
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxEventGroupNumber;
@@ -89,6 +109,67 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits,
                                         const EventBits_t uxBitsToWaitFor,
                                         const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
 
+/*
+ * Initialise the lists that hold the tasks waiting for bits in an event group.
+ */
+static void prvInitialiseWaitLists( EventGroup_t * pxEventBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Select the list in which to hold a task that waits for uxBitsToWaitFor with
+ * the options in uxControlBits.  If configUSE_EVENT_GROUP_BIT_INDEX is 1 a task
+ * that waits for all of its bits is held in the list of one of those bits that
+ * is not yet set, and a task that waits for a single bit in the list of that
+ * bit, so xEventGroupSetBits() need only test the tasks held in the lists of
+ * the bits it sets.  Otherwise, and for a task that waits for any one of
+ * several bits, the list is xTasksWaitingForBits.
+ */
+static List_t * prvGetWaitList( EventGroup_t * pxEventBits,
+                                const EventBits_t uxBitsToWaitFor,
+                                const EventBits_t uxControlBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Place the calling task in the Blocked state to wait for uxBitsToWaitFor.
+ * Must be called with the scheduler suspended.
+ */
+static void prvPlaceOnWaitList( EventGroup_t * pxEventBits,
+                                const EventBits_t uxBitsToWaitFor,
+                                const EventBits_t uxControlBits,
+                                const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by a task that was blocked on an event group once it runs again.
+ * Returns pdTRUE and sets *puxEventBits to the event bits that unblocked the
+ * task if the task's wait condition was met, or returns pdFALSE if the task
+ * timed out.
+ */
+static BaseType_t prvResetUnblockedBits( EventBits_t * puxEventBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Obtain the bits that the task that owns pxListItem is waiting for.
+ */
+static EventBits_t prvGetBitsWaitedFor( const ListItem_t * pxListItem ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblock the task that owns pxListItem, passing it uxEventBits as the value
+ * of the event group that unblocked it.
+ */
+static void prvUnblockWaiter( ListItem_t * pxListItem,
+                              const EventBits_t uxEventBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblock the tasks held in pxList whose wait condition is met by the current
+ * value of the event group.  Returns the bits to clear because tasks that were
+ * unblocked asked for them to be cleared on exit.  Must be called with the
+ * scheduler suspended.
+ */
+static EventBits_t prvUnblockMatchingWaiters( EventGroup_t * pxEventBits,
+                                              List_t * pxList ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblock every task held in pxList, as the event group is being deleted.
+ */
+static void prvUnblockAllWaiters( const List_t * pxList ) PRIVILEGED_FUNCTION;
+
 /*-----------------------------------------------------------*/
 
 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
@@ -116,7 +197,7 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits,
         if( pxEventBits != NULL )
         {
             pxEventBits->uxEventBits = 0;
-            vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
+            prvInitialiseWaitLists( pxEventBits );
 
             #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
             {
@@ -162,12 +243,12 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits,
          * sizeof( TickType_t ), the TickType_t variables will be accessed in two
          * or more reads operations, and the alignment requirements is only that
          * of each individual read. */
-        pxEventBits = ( EventGroup_t * ) pvPortMalloc( sizeof( EventGroup_t ) ); /*lint !e9087 !e9079 see comment above. */
+        pxEventBits = ( EventGroup_t * ) pvPortMallocObject( sizeof( EventGroup_t ) ); /*lint !e9087 !e9079 see comment above. */
 
         if( pxEventBits != NULL )
         {
             pxEventBits->uxEventBits = 0;
-            vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
+            prvInitialiseWaitLists( pxEventBits );
 
             #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
             {
@@ -201,7 +282,7 @@ EventBits_t xEventGroupSync( EventGroupHandle_t xEventGroup,
     BaseType_t xAlreadyYielded;
     BaseType_t xTimeoutOccurred = pdFALSE;
 
-    configASSERT( ( uxBitsToWaitFor & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+    configASSERT( ( uxBitsToWaitFor & eventRESERVED_EVENT_BITS ) == 0 );
     configASSERT( uxBitsToWaitFor != 0 );
     #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
     {
@@ -235,7 +316,7 @@ EventBits_t xEventGroupSync( EventGroupHandle_t xEventGroup,
                 /* Store the bits that the calling task is waiting for in the
                  * task's event list item so the kernel knows when a match is
                  * found.  Then enter the blocked state. */
-                vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+                prvPlaceOnWaitList( pxEventBits, uxBitsToWaitFor, ( eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
 
                 /* This assignment is obsolete as uxReturn will get set after
                  * the task unblocks, but some compilers mistakenly generate a
@@ -269,9 +350,7 @@ EventBits_t xEventGroupSync( EventGroupHandle_t xEventGroup,
          * point either the required bits were set or the block time expired.  If
          * the required bits were set they will have been stored in the task's
          * event list item, and they should now be retrieved then cleared. */
-        uxReturn = uxTaskResetEventItemValue();
-
-        if( ( uxReturn & eventUNBLOCKED_DUE_TO_BIT_SET ) == ( EventBits_t ) 0 )
+        if( prvResetUnblockedBits( &uxReturn ) == pdFALSE )
         {
             /* The task timed out, just return the current event bit value. */
             taskENTER_CRITICAL();
@@ -299,10 +378,6 @@ EventBits_t xEventGroupSync( EventGroupHandle_t xEventGroup,
         {
             /* The task unblocked because the bits were set. */
         }
-
-        /* Control bits might be set as the task had blocked should not be
-         * returned. */
-        uxReturn &= ~eventEVENT_BITS_CONTROL_BYTES;
     }
 
     traceEVENT_GROUP_SYNC_END( xEventGroup, uxBitsToSet, uxBitsToWaitFor, xTimeoutOccurred );
@@ -328,7 +403,7 @@ EventBits_t xEventGroupWaitBits( EventGroupHandle_t xEventGroup,
     /* Check the user is not attempting to wait on the bits used by the kernel
      * itself, and that at least one bit is being requested. */
     configASSERT( xEventGroup );
-    configASSERT( ( uxBitsToWaitFor & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+    configASSERT( ( uxBitsToWaitFor & eventRESERVED_EVENT_BITS ) == 0 );
     configASSERT( uxBitsToWaitFor != 0 );
     #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
     {
@@ -394,7 +469,7 @@ EventBits_t xEventGroupWaitBits( EventGroupHandle_t xEventGroup,
             /* Store the bits that the calling task is waiting for in the
              * task's event list item so the kernel knows when a match is
              * found.  Then enter the blocked state. */
-            vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+            prvPlaceOnWaitList( pxEventBits, uxBitsToWaitFor, uxControlBits, xTicksToWait );
 
             /* This is obsolete as it will get set after the task unblocks, but
              * some compilers mistakenly generate a warning about the variable
@@ -421,9 +496,7 @@ EventBits_t xEventGroupWaitBits( EventGroupHandle_t xEventGroup,
          * point either the required bits were set or the block time expired.  If
          * the required bits were set they will have been stored in the task's
          * event list item, and they should now be retrieved then cleared. */
-        uxReturn = uxTaskResetEventItemValue();
-
-        if( ( uxReturn & eventUNBLOCKED_DUE_TO_BIT_SET ) == ( EventBits_t ) 0 )
+        if( prvResetUnblockedBits( &uxReturn ) == pdFALSE )
         {
             taskENTER_CRITICAL();
             {
@@ -456,9 +529,6 @@ EventBits_t xEventGroupWaitBits( EventGroupHandle_t xEventGroup,
         {
             /* The task unblocked because the bits were set. */
         }
-
-        /* The task blocked so control bits may have been set. */
-        uxReturn &= ~eventEVENT_BITS_CONTROL_BYTES;
     }
 
     traceEVENT_GROUP_WAIT_BITS_END( xEventGroup, uxBitsToWaitFor, xTimeoutOccurred );
@@ -479,7 +549,7 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
     /* Check the user is not attempting to clear the bits used by the kernel
      * itself. */
     configASSERT( xEventGroup );
-    configASSERT( ( uxBitsToClear & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+    configASSERT( ( uxBitsToClear & eventRESERVED_EVENT_BITS ) == 0 );
 
     taskENTER_CRITICAL();
     {
@@ -505,6 +575,13 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
     {
         BaseType_t xReturn;
 
+        #if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+        {
+            /* The pended function call only carries 32 bits. */
+            configASSERT( ( uxBitsToClear >> 32 ) == 0 );
+        }
+        #endif
+
         traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear );
         xReturn = xTimerPendFunctionCallFromISR( vEventGroupClearBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToClear, NULL ); /*lint !e9087 Can't avoid cast to void* as a generic callback function not specific to this use case. Callback casts back to original type so safe. */
 
@@ -533,88 +610,56 @@ EventBits_t xEventGroupGetBitsFromISR( EventGroupHandle_t xEventGroup )
 EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
                                 const EventBits_t uxBitsToSet )
 {
-    ListItem_t * pxListItem;
-    ListItem_t * pxNext;
-    ListItem_t const * pxListEnd;
-    List_t const * pxList;
-    EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
+    EventBits_t uxBitsToClear;
     EventGroup_t * pxEventBits = xEventGroup;
-    BaseType_t xMatchFound = pdFALSE;
+
+    #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+        EventBits_t uxBitsToScan;
+        UBaseType_t uxBit;
+    #endif
 
     /* Check the user is not attempting to set the bits used by the kernel
      * itself. */
     configASSERT( xEventGroup );
-    configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+    configASSERT( ( uxBitsToSet & eventRESERVED_EVENT_BITS ) == 0 );
 
-    pxList = &( pxEventBits->xTasksWaitingForBits );
-    pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
     vTaskSuspendAll();
     {
         traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
 
-        pxListItem = listGET_HEAD_ENTRY( pxList );
-
         /* Set the bits. */
         pxEventBits->uxEventBits |= uxBitsToSet;
 
         /* See if the new bit value should unblock any tasks. */
-        while( pxListItem != pxListEnd )
-        {
-            pxNext = listGET_NEXT( pxListItem );
-            uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
-            xMatchFound = pdFALSE;
+        uxBitsToClear = prvUnblockMatchingWaiters( pxEventBits, &( pxEventBits->xTasksWaitingForBits ) );
 
-            /* Split the bits waited for from the control bits. */
-            uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
-            uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+        #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+        {
+            /* A task held in the list of a bit cannot be unblocked until that
+             * bit is set, so only the lists of the bits being set need to be
+             * tested. */
+            uxBitsToScan = uxBitsToSet & pxEventBits->uxIndexedBits;
 
-            if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+            for( uxBit = 0U; uxBitsToScan != ( EventBits_t ) 0; uxBit++ )
             {
-                /* Just looking for single bit being set. */
-                if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
+                if( ( uxBitsToScan & ( EventBits_t ) 1 ) != ( EventBits_t ) 0 )
                 {
-                    xMatchFound = pdTRUE;
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            }
-            else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
-            {
-                /* All bits are set. */
-                xMatchFound = pdTRUE;
-            }
-            else
-            {
-                /* Need all bits to be set, but not all the bits were set. */
-            }
+                    uxBitsToClear |= prvUnblockMatchingWaiters( pxEventBits, &( pxEventBits->xTasksWaitingForBit[ uxBit ] ) );
 
-            if( xMatchFound != pdFALSE )
-            {
-                /* The bits match.  Should the bits be cleared on exit? */
-                if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
-                {
-                    uxBitsToClear |= uxBitsWaitedFor;
+                    /* Each task in the list was either unblocked or moved to
+                     * the list of a bit that is still clear, so the list is now
+                     * empty. */
+                    pxEventBits->uxIndexedBits &= ~( ( EventBits_t ) 1 << uxBit );
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
 
-                /* Store the actual event flag value in the task's event list
-                 * item before removing the task from the event list.  The
-                 * eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
-                 * that is was unblocked due to its required bits matching, rather
-                 * than because it timed out. */
-                vTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+                uxBitsToScan >>= 1;
             }
-
-            /* Move onto the next list item.  Note pxListItem->pxNext is not
-             * used here as the list item may have been removed from the event list
-             * and inserted into the ready/pending reading list. */
-            pxListItem = pxNext;
         }
+        #endif /* configUSE_EVENT_GROUP_BIT_INDEX */
 
         /* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
          * bit was set in the control word. */
@@ -629,23 +674,27 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
 void vEventGroupDelete( EventGroupHandle_t xEventGroup )
 {
     EventGroup_t * pxEventBits = xEventGroup;
-    const List_t * pxTasksWaitingForBits;
 
-    configASSERT( pxEventBits );
+    #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+        UBaseType_t uxBit;
+    #endif
 
-    pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
+    configASSERT( pxEventBits );
 
     vTaskSuspendAll();
     {
         traceEVENT_GROUP_DELETE( xEventGroup );
 
-        while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+        prvUnblockAllWaiters( &( pxEventBits->xTasksWaitingForBits ) );
+
+        #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
         {
-            /* Unblock the task, returning 0 as the event list is being deleted
-             * and cannot therefore have any bits set. */
-            configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( const ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
-            vTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+            for( uxBit = 0U; uxBit < eventNUMBER_OF_BITS; uxBit++ )
+            {
+                prvUnblockAllWaiters( &( pxEventBits->xTasksWaitingForBit[ uxBit ] ) );
+            }
         }
+        #endif
     }
     ( void ) xTaskResumeAll();
 
@@ -653,7 +702,7 @@ void vEventGroupDelete( EventGroupHandle_t xEventGroup )
     {
         /* The event group can only have been allocated dynamically - free
          * it again. */
-        vPortFree( pxEventBits );
+        vPortFreeObject( pxEventBits );
     }
     #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
     {
@@ -661,7 +710,7 @@ void vEventGroupDelete( EventGroupHandle_t xEventGroup )
          * dynamically, so check before attempting to free the memory. */
         if( pxEventBits->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
         {
-            vPortFree( pxEventBits );
+            vPortFreeObject( pxEventBits );
         }
         else
         {
@@ -727,6 +776,265 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits,
 }
 /*-----------------------------------------------------------*/
 
+static void prvInitialiseWaitLists( EventGroup_t * pxEventBits )
+{
+    #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+        UBaseType_t uxBit;
+    #endif
+
+    vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
+
+    #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+    {
+        pxEventBits->uxIndexedBits = 0;
+
+        for( uxBit = 0U; uxBit < eventNUMBER_OF_BITS; uxBit++ )
+        {
+            vListInitialise( &( pxEventBits->xTasksWaitingForBit[ uxBit ] ) );
+        }
+    }
+    #endif /* configUSE_EVENT_GROUP_BIT_INDEX */
+}
+/*-----------------------------------------------------------*/
+
+static List_t * prvGetWaitList( EventGroup_t * pxEventBits,
+                                const EventBits_t uxBitsToWaitFor,
+                                const EventBits_t uxControlBits )
+{
+    List_t * pxList = &( pxEventBits->xTasksWaitingForBits );
+
+    #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+    {
+        EventBits_t uxBitsToWatch;
+        UBaseType_t uxBit;
+
+        if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) != ( EventBits_t ) 0 )
+        {
+            /* The task cannot be unblocked until every bit it waits for is
+             * set, so it only needs to be tested when one of those that is
+             * still clear gets set. */
+            uxBitsToWatch = uxBitsToWaitFor & ~( pxEventBits->uxEventBits );
+        }
+        else if( ( uxBitsToWaitFor & ( uxBitsToWaitFor - ( EventBits_t ) 1 ) ) == ( EventBits_t ) 0 )
+        {
+            /* The task waits for a single bit. */
+            uxBitsToWatch = uxBitsToWaitFor;
+        }
+        else
+        {
+            /* Any one of several bits can unblock the task, so it has to be
+             * tested whenever any of them is set. */
+            uxBitsToWatch = 0;
+        }
+
+        if( uxBitsToWatch != ( EventBits_t ) 0 )
+        {
+            /* Hold the task in the list of the lowest of the bits. */
+            uxBit = 0U;
+
+            while( ( uxBitsToWatch & ( ( EventBits_t ) 1 << uxBit ) ) == ( EventBits_t ) 0 )
+            {
+                uxBit++;
+            }
+
+            pxEventBits->uxIndexedBits |= ( EventBits_t ) 1 << uxBit;
+            pxList = &( pxEventBits->xTasksWaitingForBit[ uxBit ] );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #else /* if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 ) */
+    {
+        ( void ) uxBitsToWaitFor;
+        ( void ) uxControlBits;
+    }
+    #endif /* configUSE_EVENT_GROUP_BIT_INDEX */
+
+    return pxList;
+}
+/*-----------------------------------------------------------*/
+
+static void prvPlaceOnWaitList( EventGroup_t * pxEventBits,
+                                const EventBits_t uxBitsToWaitFor,
+                                const EventBits_t uxControlBits,
+                                const TickType_t xTicksToWait )
+{
+    List_t * const pxList = prvGetWaitList( pxEventBits, uxBitsToWaitFor, uxControlBits );
+
+    #if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+    {
+        /* The event list item value only has room for the control bits. */
+        vTaskSetWideEventItemValue( NULL, uxBitsToWaitFor );
+        vTaskPlaceOnUnorderedEventList( pxList, ( TickType_t ) uxControlBits, xTicksToWait );
+    }
+    #else
+    {
+        vTaskPlaceOnUnorderedEventList( pxList, ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+    }
+    #endif
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvResetUnblockedBits( EventBits_t * puxEventBits )
+{
+    const TickType_t xItemValue = uxTaskResetEventItemValue();
+    BaseType_t xReturn;
+
+    if( ( xItemValue & eventUNBLOCKED_DUE_TO_BIT_SET ) != ( TickType_t ) 0 )
+    {
+        #if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+        {
+            *puxEventBits = ullTaskGetWideEventItemValue( NULL );
+        }
+        #else
+        {
+            /* Control bits were set as the task had blocked, and should not
+             * be returned. */
+            *puxEventBits = xItemValue & ~eventEVENT_BITS_CONTROL_BYTES;
+        }
+        #endif
+
+        xReturn = pdTRUE;
+    }
+    else
+    {
+        xReturn = pdFALSE;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static EventBits_t prvGetBitsWaitedFor( const ListItem_t * pxListItem )
+{
+    EventBits_t uxBitsWaitedFor;
+
+    #if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+    {
+        uxBitsWaitedFor = ullTaskGetWideEventItemValue( ( TaskHandle_t ) listGET_LIST_ITEM_OWNER( pxListItem ) );
+    }
+    #else
+    {
+        uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem ) & ~eventEVENT_BITS_CONTROL_BYTES;
+    }
+    #endif
+
+    return uxBitsWaitedFor;
+}
+/*-----------------------------------------------------------*/
+
+static void prvUnblockWaiter( ListItem_t * pxListItem,
+                              const EventBits_t uxEventBits )
+{
+    /* Store the actual event flag value before removing the task from the
+     * event list.  The eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task
+     * knows that is was unblocked due to its required bits matching, rather
+     * than because it timed out. */
+    #if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+    {
+        vTaskSetWideEventItemValue( ( TaskHandle_t ) listGET_LIST_ITEM_OWNER( pxListItem ), uxEventBits );
+        vTaskRemoveFromUnorderedEventList( pxListItem, eventUNBLOCKED_DUE_TO_BIT_SET );
+    }
+    #else
+    {
+        vTaskRemoveFromUnorderedEventList( pxListItem, uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+    }
+    #endif
+}
+/*-----------------------------------------------------------*/
+
+static EventBits_t prvUnblockMatchingWaiters( EventGroup_t * pxEventBits,
+                                              List_t * pxList )
+{
+    ListItem_t * pxListItem;
+    ListItem_t * pxNext;
+    ListItem_t const * pxListEnd;
+    EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
+    BaseType_t xMatchFound;
+
+    #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+        List_t * pxNewList;
+    #endif
+
+    pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+    pxListItem = listGET_HEAD_ENTRY( pxList );
+
+    while( pxListItem != pxListEnd )
+    {
+        pxNext = listGET_NEXT( pxListItem );
+
+        /* Split the bits waited for from the control bits. */
+        uxBitsWaitedFor = prvGetBitsWaitedFor( pxListItem );
+        uxControlBits = listGET_LIST_ITEM_VALUE( pxListItem ) & eventEVENT_BITS_CONTROL_BYTES;
+
+        if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+        {
+            xMatchFound = prvTestWaitCondition( pxEventBits->uxEventBits, uxBitsWaitedFor, pdFALSE );
+        }
+        else
+        {
+            xMatchFound = prvTestWaitCondition( pxEventBits->uxEventBits, uxBitsWaitedFor, pdTRUE );
+        }
+
+        if( xMatchFound != pdFALSE )
+        {
+            /* The bits match.  Should the bits be cleared on exit? */
+            if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+            {
+                uxBitsToClear |= uxBitsWaitedFor;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            prvUnblockWaiter( pxListItem, pxEventBits->uxEventBits );
+        }
+        else
+        {
+            #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+            {
+                if( pxList != &( pxEventBits->xTasksWaitingForBits ) )
+                {
+                    /* The bit the task was held under is now set, but the task
+                     * is still waiting for other bits, so move it to the list
+                     * of one of those. */
+                    pxNewList = prvGetWaitList( pxEventBits, uxBitsWaitedFor, uxControlBits );
+                    listREMOVE_ITEM( pxListItem );
+                    listINSERT_END( pxNewList, pxListItem );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_EVENT_GROUP_BIT_INDEX */
+        }
+
+        /* Move onto the next list item.  Note pxListItem->pxNext is not
+         * used here as the list item may have been removed from the event list
+         * and inserted into the ready/pending reading list. */
+        pxListItem = pxNext;
+    }
+
+    return uxBitsToClear;
+}
+/*-----------------------------------------------------------*/
+
+static void prvUnblockAllWaiters( const List_t * pxList )
+{
+    while( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+    {
+        /* Unblock the task, returning 0 as the event list is being deleted
+         * and cannot therefore have any bits set. */
+        configASSERT( pxList->xListEnd.pxNext != ( const ListItem_t * ) &( pxList->xListEnd ) );
+        prvUnblockWaiter( pxList->xListEnd.pxNext, 0 );
+    }
+}
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
     BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
@@ -735,6 +1043,13 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits,
     {
         BaseType_t xReturn;
 
+        #if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+        {
+            /* The pended function call only carries 32 bits. */
+            configASSERT( ( uxBitsToSet >> 32 ) == 0 );
+        }
+        #endif
+
         traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet );
         xReturn = xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToSet, pxHigherPriorityTaskWoken ); /*lint !e9087 Can't avoid cast to void* as a generic callback function not specific to this use case. Callback casts back to original type so safe. */
 
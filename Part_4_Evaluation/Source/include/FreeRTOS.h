@@ -163,6 +163,128 @@
     #define configUSE_CO_ROUTINES    0
 #endif
 
+#ifndef configUSE_TICKETS
+    #define configUSE_TICKETS    0
+#endif
+
+#ifndef configUSE_DELAYED_TASK_WHEEL
+    #define configUSE_DELAYED_TASK_WHEEL    0
+#endif
+
+#ifndef configUSE_TIMER_WHEEL
+    #define configUSE_TIMER_WHEEL    0
+#endif
+
+#ifndef configUSE_TIMER_SLACK
+    #define configUSE_TIMER_SLACK    0
+#endif
+
+#if ( ( configUSE_TIMER_SLACK == 1 ) && ( ( configUSE_DELAYED_TASK_WHEEL == 1 ) || ( configUSE_TIMER_WHEEL == 1 ) ) )
+    #error configUSE_TIMER_SLACK requires the sorted delayed task and timer lists, so cannot be used with configUSE_DELAYED_TASK_WHEEL or configUSE_TIMER_WHEEL.
+#endif
+
+#ifndef configLIST_WHEEL_LEVELS
+    #define configLIST_WHEEL_LEVELS    4
+#endif
+
+#if ( ( configLIST_WHEEL_LEVELS < 2 ) || ( configLIST_WHEEL_LEVELS > 6 ) )
+    #error configLIST_WHEEL_LEVELS must be between 2 and 6.
+#endif
+
+#ifndef configUSE_PRIORITY_EVENT_LISTS
+    #define configUSE_PRIORITY_EVENT_LISTS    0
+#endif
+
+#if ( ( configUSE_PRIORITY_EVENT_LISTS == 1 ) && ( configMAX_PRIORITIES > 32 ) )
+    #error configUSE_PRIORITY_EVENT_LISTS keeps one bit per priority in a 32-bit map, so configMAX_PRIORITIES cannot be greater than 32.
+#endif
+
+#ifndef configUSE_EVENT_GROUP_BIT_INDEX
+    #define configUSE_EVENT_GROUP_BIT_INDEX    0
+#endif
+
+#ifndef configUSE_WIDE_EVENT_GROUPS
+    #define configUSE_WIDE_EVENT_GROUPS    0
+#endif
+
+#ifndef configUSE_QUEUE_ZERO_COPY
+    #define configUSE_QUEUE_ZERO_COPY    0
+#endif
+
+#ifndef configUSE_QUEUE_BATCHING
+    #define configUSE_QUEUE_BATCHING    0
+#endif
+
+#ifndef configUSE_SPSC_QUEUES
+    #define configUSE_SPSC_QUEUES    0
+#endif
+
+/* The last notification index, so the consumer does not clear notifications
+ * sent to index 0 by xTaskNotifyGive() and stream buffers. */
+#ifndef configSPSC_QUEUE_NOTIFICATION_INDEX
+    #define configSPSC_QUEUE_NOTIFICATION_INDEX    ( configTASK_NOTIFICATION_ARRAY_ENTRIES - 1 )
+#endif
+
+#ifndef configUSE_STREAM_BUFFER_ZERO_COPY
+    #define configUSE_STREAM_BUFFER_ZERO_COPY    0
+#endif
+
+#ifndef configUSE_MESSAGE_BUFFER_BATCHING
+    #define configUSE_MESSAGE_BUFFER_BATCHING    0
+#endif
+
+#ifndef configUSE_QUEUE_SET_READY_LIST
+    #define configUSE_QUEUE_SET_READY_LIST    0
+#endif
+
+#ifndef configUSE_LIGHT_SYNC
+    #define configUSE_LIGHT_SYNC    0
+#endif
+
+/* Must be set explicitly if configTASK_NOTIFICATION_ARRAY_ENTRIES > 1, as index
+ * 0 is used by xTaskNotifyGive() and stream buffers. */
+#ifndef configLIGHT_SYNC_NOTIFICATION_INDEX
+    #define configLIGHT_SYNC_NOTIFICATION_INDEX    0
+#endif
+
+#ifndef configUSE_MUTEX_FAST_PATH
+    #define configUSE_MUTEX_FAST_PATH    0
+#endif
+
+#ifndef configUSE_RWLOCKS
+    #define configUSE_RWLOCKS    0
+#endif
+
+#ifndef configUSE_MAILBOXES
+    #define configUSE_MAILBOXES    0
+#endif
+
+#ifndef configUSE_BLOCK_POOLS
+    #define configUSE_BLOCK_POOLS    0
+#endif
+
+#ifndef configKERNEL_OBJECTS_FROM_BLOCK_POOLS
+    #define configKERNEL_OBJECTS_FROM_BLOCK_POOLS    0
+#endif
+
+#if ( configUSE_BLOCK_POOLS == 1 )
+    #ifndef configBLOCK_POOL_SIZES
+        #error If configUSE_BLOCK_POOLS is set to 1 then configBLOCK_POOL_SIZES must also be defined, for example { 32, 64, 128, 256 }.
+    #endif
+
+    #ifndef configBLOCK_POOL_COUNTS
+        #error If configUSE_BLOCK_POOLS is set to 1 then configBLOCK_POOL_COUNTS must also be defined, with one block count per entry in configBLOCK_POOL_SIZES.
+    #endif
+
+    #ifndef configTOTAL_BLOCK_POOL_SIZE
+        #error If configUSE_BLOCK_POOLS is set to 1 then configTOTAL_BLOCK_POOL_SIZE must also be defined.
+    #endif
+#endif
+
+#if ( ( configKERNEL_OBJECTS_FROM_BLOCK_POOLS == 1 ) && ( configUSE_BLOCK_POOLS == 0 ) )
+    #error configKERNEL_OBJECTS_FROM_BLOCK_POOLS requires configUSE_BLOCK_POOLS to be set to 1.
+#endif
+
 #ifndef INCLUDE_vTaskPrioritySet
     #define INCLUDE_vTaskPrioritySet    0
 #endif
@@ -261,6 +383,10 @@
     #ifndef configMAX_CO_ROUTINE_PRIORITIES
         #error configMAX_CO_ROUTINE_PRIORITIES must be greater than or equal to 1.
     #endif
+
+    #if ( ( configUSE_PRIORITY_EVENT_LISTS == 1 ) && ( configMAX_CO_ROUTINE_PRIORITIES > configMAX_PRIORITIES ) )
+        #error configUSE_PRIORITY_EVENT_LISTS files co-routines by priority too, so configMAX_CO_ROUTINE_PRIORITIES cannot be greater than configMAX_PRIORITIES.
+    #endif
 #endif
 
 #ifndef configUSE_DAEMON_TASK_STARTUP_HOOK
@@ -353,6 +479,14 @@
         #error If configUSE_TIMERS is set to 1 then configTIMER_TASK_STACK_DEPTH must also be defined.
     #endif /* configTIMER_TASK_STACK_DEPTH */
 
+    #ifndef configTIMER_COMMAND_BATCH_LENGTH
+        #define configTIMER_COMMAND_BATCH_LENGTH    1
+    #endif
+
+    #if ( configTIMER_COMMAND_BATCH_LENGTH < 1 )
+        #error configTIMER_COMMAND_BATCH_LENGTH must be at least 1.
+    #endif
+
 #endif /* configUSE_TIMERS */
 
 #ifndef portSET_INTERRUPT_MASK_FROM_ISR
@@ -458,6 +592,14 @@
     #define traceTASK_PRIORITY_DISINHERIT( pxTCBOfMutexHolder, uxOriginalPriority )
 #endif
 
+#ifndef traceTASK_SIDE_TABLE_FULL
+
+/* Called when the compact TCB is used and a task's application task tag or
+ * thread local storage pointer cannot be set because every entry of the task
+ * side table is assigned to another task.  The value is not stored. */
+    #define traceTASK_SIDE_TABLE_FULL( pxTCB )
+#endif
+
 #ifndef traceBLOCKING_ON_QUEUE_RECEIVE
 
 /* Task is about to block because it cannot read from a
@@ -807,6 +949,202 @@
     #define traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength )
 #endif
 
+#ifndef traceSPSC_QUEUE_CREATE
+    #define traceSPSC_QUEUE_CREATE( pxSpscQueue )
+#endif
+
+#ifndef traceSPSC_QUEUE_SEND
+    #define traceSPSC_QUEUE_SEND( xSpscQueue )
+#endif
+
+#ifndef traceSPSC_QUEUE_SEND_FAILED
+    #define traceSPSC_QUEUE_SEND_FAILED( xSpscQueue )
+#endif
+
+#ifndef traceSPSC_QUEUE_SEND_FROM_ISR
+    #define traceSPSC_QUEUE_SEND_FROM_ISR( xSpscQueue )
+#endif
+
+#ifndef traceSPSC_QUEUE_SEND_FROM_ISR_FAILED
+    #define traceSPSC_QUEUE_SEND_FROM_ISR_FAILED( xSpscQueue )
+#endif
+
+#ifndef traceBLOCKING_ON_SPSC_QUEUE_RECEIVE
+    #define traceBLOCKING_ON_SPSC_QUEUE_RECEIVE( xSpscQueue )
+#endif
+
+#ifndef traceSPSC_QUEUE_RECEIVE
+    #define traceSPSC_QUEUE_RECEIVE( xSpscQueue )
+#endif
+
+#ifndef traceSPSC_QUEUE_RECEIVE_FAILED
+    #define traceSPSC_QUEUE_RECEIVE_FAILED( xSpscQueue )
+#endif
+
+#ifndef traceLIGHT_SEMAPHORE_CREATE
+    #define traceLIGHT_SEMAPHORE_CREATE( pxSemaphore )
+#endif
+
+#ifndef traceLIGHT_SEMAPHORE_CREATE_FAILED
+    #define traceLIGHT_SEMAPHORE_CREATE_FAILED()
+#endif
+
+#ifndef traceBLOCKING_ON_LIGHT_SEMAPHORE_TAKE
+    #define traceBLOCKING_ON_LIGHT_SEMAPHORE_TAKE( xSemaphore )
+#endif
+
+#ifndef traceLIGHT_SEMAPHORE_TAKE
+    #define traceLIGHT_SEMAPHORE_TAKE( xSemaphore )
+#endif
+
+#ifndef traceLIGHT_SEMAPHORE_TAKE_FAILED
+    #define traceLIGHT_SEMAPHORE_TAKE_FAILED( xSemaphore )
+#endif
+
+#ifndef traceLIGHT_SEMAPHORE_GIVE
+    #define traceLIGHT_SEMAPHORE_GIVE( xSemaphore )
+#endif
+
+#ifndef traceLIGHT_SEMAPHORE_GIVE_FAILED
+    #define traceLIGHT_SEMAPHORE_GIVE_FAILED( xSemaphore )
+#endif
+
+#ifndef traceLIGHT_SEMAPHORE_GIVE_FROM_ISR
+    #define traceLIGHT_SEMAPHORE_GIVE_FROM_ISR( xSemaphore, xReturn )
+#endif
+
+#ifndef traceLIGHT_EVENT_FLAGS_CREATE
+    #define traceLIGHT_EVENT_FLAGS_CREATE( pxEventFlags )
+#endif
+
+#ifndef traceLIGHT_EVENT_FLAGS_CREATE_FAILED
+    #define traceLIGHT_EVENT_FLAGS_CREATE_FAILED()
+#endif
+
+#ifndef traceLIGHT_EVENT_FLAGS_WAIT_BLOCK
+    #define traceLIGHT_EVENT_FLAGS_WAIT_BLOCK( xEventFlags, ulBitsToWaitFor )
+#endif
+
+#ifndef traceLIGHT_EVENT_FLAGS_WAIT_END
+    #define traceLIGHT_EVENT_FLAGS_WAIT_END( xEventFlags, ulBitsToWaitFor, ulReturn )
+#endif
+
+#ifndef traceLIGHT_EVENT_FLAGS_SET
+    #define traceLIGHT_EVENT_FLAGS_SET( xEventFlags, ulBitsToSet )
+#endif
+
+#ifndef traceLIGHT_EVENT_FLAGS_SET_FROM_ISR
+    #define traceLIGHT_EVENT_FLAGS_SET_FROM_ISR( xEventFlags, ulBitsToSet )
+#endif
+
+#ifndef traceLIGHT_EVENT_FLAGS_CLEAR
+    #define traceLIGHT_EVENT_FLAGS_CLEAR( xEventFlags, ulBitsToClear )
+#endif
+
+#ifndef traceRWLOCK_CREATE
+    #define traceRWLOCK_CREATE( pxRWLock )
+#endif
+
+#ifndef traceRWLOCK_CREATE_FAILED
+    #define traceRWLOCK_CREATE_FAILED()
+#endif
+
+#ifndef traceRWLOCK_DELETE
+    #define traceRWLOCK_DELETE( xRWLock )
+#endif
+
+#ifndef traceBLOCKING_ON_RWLOCK_TAKE
+    #define traceBLOCKING_ON_RWLOCK_TAKE( pxRWLock, xForWrite )
+#endif
+
+#ifndef traceRWLOCK_TAKE_READ
+    #define traceRWLOCK_TAKE_READ( xRWLock )
+#endif
+
+#ifndef traceRWLOCK_TAKE_READ_FAILED
+    #define traceRWLOCK_TAKE_READ_FAILED( xRWLock )
+#endif
+
+#ifndef traceRWLOCK_GIVE_READ
+    #define traceRWLOCK_GIVE_READ( xRWLock )
+#endif
+
+#ifndef traceRWLOCK_GIVE_READ_FAILED
+    #define traceRWLOCK_GIVE_READ_FAILED( xRWLock )
+#endif
+
+#ifndef traceRWLOCK_TAKE_WRITE
+    #define traceRWLOCK_TAKE_WRITE( xRWLock )
+#endif
+
+#ifndef traceRWLOCK_TAKE_WRITE_FAILED
+    #define traceRWLOCK_TAKE_WRITE_FAILED( xRWLock )
+#endif
+
+#ifndef traceRWLOCK_GIVE_WRITE
+    #define traceRWLOCK_GIVE_WRITE( xRWLock )
+#endif
+
+#ifndef traceRWLOCK_GIVE_WRITE_FAILED
+    #define traceRWLOCK_GIVE_WRITE_FAILED( xRWLock )
+#endif
+
+#ifndef traceMAILBOX_CREATE
+    #define traceMAILBOX_CREATE( pxMailbox )
+#endif
+
+#ifndef traceMAILBOX_CREATE_FAILED
+    #define traceMAILBOX_CREATE_FAILED()
+#endif
+
+#ifndef traceMAILBOX_CREATE_STATIC_FAILED
+    #define traceMAILBOX_CREATE_STATIC_FAILED( xReturn )
+#endif
+
+#ifndef traceMAILBOX_DELETE
+    #define traceMAILBOX_DELETE( xMailbox )
+#endif
+
+#ifndef traceMAILBOX_WRITE
+    #define traceMAILBOX_WRITE( xMailbox )
+#endif
+
+#ifndef traceMAILBOX_WRITE_FROM_ISR
+    #define traceMAILBOX_WRITE_FROM_ISR( xMailbox )
+#endif
+
+#ifndef traceMAILBOX_WRITE_FROM_ISR_FAILED
+    #define traceMAILBOX_WRITE_FROM_ISR_FAILED( xMailbox )
+#endif
+
+#ifndef traceMAILBOX_READ
+    #define traceMAILBOX_READ( xMailbox )
+#endif
+
+#ifndef traceMAILBOX_READ_RETRY
+    #define traceMAILBOX_READ_RETRY( xMailbox )
+#endif
+
+#ifndef traceMAILBOX_READ_FAILED
+    #define traceMAILBOX_READ_FAILED( xMailbox )
+#endif
+
+#ifndef traceMAILBOX_READ_FROM_ISR
+    #define traceMAILBOX_READ_FROM_ISR( xMailbox )
+#endif
+
+#ifndef traceMAILBOX_READ_FROM_ISR_FAILED
+    #define traceMAILBOX_READ_FROM_ISR_FAILED( xMailbox )
+#endif
+
+#ifndef traceBLOCK_POOL_ALLOC
+    #define traceBLOCK_POOL_ALLOC( pvAddress, uxWantedSize )
+#endif
+
+#ifndef traceBLOCK_POOL_FREE
+    #define traceBLOCK_POOL_FREE( pvAddress, uxBlockSize )
+#endif
+
 #ifndef configGENERATE_RUN_TIME_STATS
     #define configGENERATE_RUN_TIME_STATS    0
 #endif
@@ -925,6 +1263,10 @@
     #define configAPPLICATION_ALLOCATED_HEAP    0
 #endif
 
+#ifndef configAPPLICATION_ALLOCATED_BLOCK_POOL
+    #define configAPPLICATION_ALLOCATED_BLOCK_POOL    0
+#endif
+
 #ifndef configUSE_TASK_NOTIFICATIONS
     #define configUSE_TASK_NOTIFICATIONS    1
 #endif
@@ -965,6 +1307,108 @@
     #error configUSE_STATS_FORMATTING_FUNCTIONS cannot be used without dynamic allocation, but configSUPPORT_DYNAMIC_ALLOCATION is not set to 1.
 #endif
 
+#ifndef configUSE_TASK_RECYCLING
+    #define configUSE_TASK_RECYCLING    0
+#endif
+
+#ifndef configTASK_RECYCLE_POOL_LENGTH
+    #define configTASK_RECYCLE_POOL_LENGTH    4
+#endif
+
+#ifndef configTASK_RECYCLE_STACK_DEPTH
+    #define configTASK_RECYCLE_STACK_DEPTH    configMINIMAL_STACK_SIZE
+#endif
+
+#if ( configUSE_TASK_RECYCLING == 1 )
+    #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 0 ) || ( INCLUDE_vTaskDelete == 0 ) )
+        #error configUSE_TASK_RECYCLING requires both configSUPPORT_DYNAMIC_ALLOCATION and INCLUDE_vTaskDelete to be set to 1.
+    #endif
+
+    #if ( ( portSTACK_GROWTH < 0 ) && ( configRECORD_STACK_HIGH_ADDRESS == 0 ) )
+        #error configUSE_TASK_RECYCLING requires configRECORD_STACK_HIGH_ADDRESS to be set to 1, as the recorded stack extent identifies the stacks that can be recycled.
+    #endif
+
+    #if ( configUSE_HEAP_ACCOUNTING == 1 )
+        #error configUSE_TASK_RECYCLING cannot be used with configUSE_HEAP_ACCOUNTING, as a recycled TCB and stack stay charged to the task that first allocated them.
+    #endif
+#endif
+
+#ifndef configUSE_STATIC_TASK_TABLE
+    #define configUSE_STATIC_TASK_TABLE    0
+#endif
+
+#if ( ( configUSE_STATIC_TASK_TABLE == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+    #error configUSE_STATIC_TASK_TABLE requires configSUPPORT_STATIC_ALLOCATION to be set to 1.
+#endif
+
+#ifndef configUSE_COMPACT_TCB
+    #define configUSE_COMPACT_TCB    0
+#endif
+
+#ifndef configTASK_SIDE_TABLE_LENGTH
+    #define configTASK_SIDE_TABLE_LENGTH    4
+#endif
+
+#if ( configUSE_COMPACT_TCB == 1 )
+    #if ( configMAX_PRIORITIES > 256 )
+        #error configMAX_PRIORITIES cannot exceed 256 when configUSE_COMPACT_TCB is set to 1, as the compact TCB holds priorities in a single byte.
+    #endif
+
+    #if ( ( configTASK_SIDE_TABLE_LENGTH < 1 ) || ( configTASK_SIDE_TABLE_LENGTH > 255 ) )
+        #error configTASK_SIDE_TABLE_LENGTH must be between 1 and 255.
+    #endif
+
+    #if ( configUSE_HEAP_MAGAZINES == 1 )
+        #error configUSE_COMPACT_TCB cannot be used with configUSE_HEAP_MAGAZINES, as every task that allocates memory would need a side table entry for its magazine.
+    #endif
+#endif
+
+/* The compact TCB moves the application task tag and the thread local storage
+ * pointers, which few tasks use, out of the TCB and into a table of
+ * configTASK_SIDE_TABLE_LENGTH entries that are assigned to tasks as they are
+ * needed.
+ *
+ * ***NOTE***:  configTASK_SIDE_TABLE_LENGTH limits how many tasks can have a
+ * task tag or a thread local storage pointer set at the same time.  When every
+ * entry is in use, setting one for a further task fails configASSERT(), and
+ * with configASSERT() undefined the value is silently not stored, so reads
+ * return NULL.  traceTASK_SIDE_TABLE_FULL() is called when that happens. */
+#if ( ( configUSE_COMPACT_TCB == 1 ) && ( ( configUSE_APPLICATION_TASK_TAG == 1 ) || ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 ) ) )
+    #define tskUSE_TASK_SIDE_TABLE    1
+#else
+    #define tskUSE_TASK_SIDE_TABLE    0
+#endif
+
+#ifndef configUSE_STACK_PROFILING
+    #define configUSE_STACK_PROFILING    0
+#endif
+
+#ifndef configSTACK_PROFILE_LENGTH
+    #define configSTACK_PROFILE_LENGTH    16
+#endif
+
+#ifndef configSTACK_PROFILE_MARGIN_PERCENT
+    #define configSTACK_PROFILE_MARGIN_PERCENT    25
+#endif
+
+#ifndef configPAINT_STACK_GUARD_ONLY
+    #define configPAINT_STACK_GUARD_ONLY    0
+#endif
+
+#ifndef configSTACK_GUARD_DEPTH
+    #define configSTACK_GUARD_DEPTH    8
+#endif
+
+#if ( configUSE_STACK_PROFILING == 1 )
+    #if ( ( portSTACK_GROWTH < 0 ) && ( configRECORD_STACK_HIGH_ADDRESS == 0 ) )
+        #error configUSE_STACK_PROFILING requires configRECORD_STACK_HIGH_ADDRESS to be set to 1, as the recorded stack extent gives the depth of each stack.
+    #endif
+
+    #if ( configPAINT_STACK_GUARD_ONLY == 1 )
+        #error configUSE_STACK_PROFILING cannot be used with configPAINT_STACK_GUARD_ONLY, as the high water marks can only be measured on fully painted stacks.
+    #endif
+#endif
+
 #if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
     #if ( ( configUSE_TRACE_FACILITY != 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
         #error configUSE_STATS_FORMATTING_FUNCTIONS is 1 but the functions it enables are not used because neither configUSE_TRACE_FACILITY or configGENERATE_RUN_TIME_STATS are 1.  Set configUSE_STATS_FORMATTING_FUNCTIONS to 0 in FreeRTOSConfig.h.
@@ -1240,6 +1684,17 @@ typedef struct xSTATIC_LIST
     #endif
 } StaticList_t;
 
+/* See the comments above the struct xSTATIC_LIST_ITEM definition. */
+#if ( configUSE_PRIORITY_EVENT_LISTS == 1 )
+    typedef struct xSTATIC_PRIORITY_LIST
+    {
+        uint32_t ulDummy1;
+        StaticList_t xDummy2[ configMAX_PRIORITIES ];
+    } StaticEventList_t;
+#else
+    typedef StaticList_t StaticEventList_t;
+#endif
+
 /*
  * In line with software engineering best practice, especially when supplying a
  * library that is likely to change in future versions, FreeRTOS implements a
@@ -1253,55 +1708,129 @@ typedef struct xSTATIC_LIST
  * are set.  Its contents are somewhat obfuscated in the hope users will
  * recognise that it would be unwise to make direct use of the structure members.
  */
-typedef struct xSTATIC_TCB
-{
-    void * pxDummy1;
-    #if ( portUSING_MPU_WRAPPERS == 1 )
-        xMPU_SETTINGS xDummy2;
-    #endif
-    StaticListItem_t xDummy3[ 2 ];
-    UBaseType_t uxDummy5;
-    void * pxDummy6;
-    uint8_t ucDummy7[ configMAX_TASK_NAME_LEN ];
-    #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
-        void * pxDummy8;
-    #endif
-    #if ( portCRITICAL_NESTING_IN_TCB == 1 )
-        UBaseType_t uxDummy9;
-    #endif
-    #if ( configUSE_TRACE_FACILITY == 1 )
-        UBaseType_t uxDummy10[ 2 ];
-    #endif
-    #if ( configUSE_MUTEXES == 1 )
-        UBaseType_t uxDummy12[ 2 ];
-    #endif
-    #if ( configUSE_APPLICATION_TASK_TAG == 1 )
-        void * pxDummy14;
-    #endif
-    #if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
-        void * pvDummy15[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
-    #endif
-    #if ( configGENERATE_RUN_TIME_STATS == 1 )
-        configRUN_TIME_COUNTER_TYPE ulDummy16;
-    #endif
-    #if ( ( configUSE_NEWLIB_REENTRANT == 1 ) || ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) )
-        configTLS_BLOCK_TYPE xDummy17;
-    #endif
-    #if ( configUSE_TASK_NOTIFICATIONS == 1 )
-        uint32_t ulDummy18[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
-        uint8_t ucDummy19[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
-    #endif
-    #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
-        uint8_t uxDummy20;
-    #endif
+#if ( configUSE_COMPACT_TCB == 1 )
+    typedef struct xSTATIC_TCB
+    {
+        void * pxDummy1;
+        #if ( portUSING_MPU_WRAPPERS == 1 )
+            xMPU_SETTINGS xDummy2;
+        #endif
+        StaticListItem_t xDummy3[ 2 ];
+        void * pxDummy6;
+        #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
+            void * pxDummy8;
+        #endif
+        #if ( portCRITICAL_NESTING_IN_TCB == 1 )
+            UBaseType_t uxDummy9;
+        #endif
+        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            configRUN_TIME_COUNTER_TYPE ulDummy16;
+        #endif
+        #if ( ( configUSE_NEWLIB_REENTRANT == 1 ) || ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) )
+            configTLS_BLOCK_TYPE xDummy17;
+        #endif
+        #if ( configUSE_POSIX_ERRNO == 1 )
+            int iDummy22;
+        #endif
+        #if ( configUSE_TIMER_SLACK == 1 )
+            TickType_t xDummy23;
+        #endif
+        #if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+            uint64_t ullDummy24;
+        #endif
+        #if ( configUSE_TRACE_FACILITY == 1 )
+            UBaseType_t uxDummy10[ 2 ];
+        #endif
+        #if ( configUSE_HEAP_ACCOUNTING == 1 )
+            size_t xDummy25[ 4 ];
+        #endif
+        #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+            uint32_t ulDummy18[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+        #endif
+        uint8_t ucDummy5;
+        #if ( configUSE_MUTEXES == 1 )
+            uint8_t ucDummy12[ 2 ];
+        #endif
+        #if ( configUSE_TICKETS == 1 )
+            uint8_t ucDummy26[ 2 ];
+        #endif
+        #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+            uint8_t ucDummy19[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+        #endif
+        #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+            uint8_t uxDummy20;
+        #endif
+        #if ( INCLUDE_xTaskAbortDelay == 1 )
+            uint8_t ucDummy21;
+        #endif
+        #if ( tskUSE_TASK_SIDE_TABLE == 1 )
+            uint8_t ucDummy27;
+        #endif
+        uint8_t ucDummy7[ configMAX_TASK_NAME_LEN ];
+    } StaticTask_t;
+#else
+    typedef struct xSTATIC_TCB
+    {
+        void * pxDummy1;
+        #if ( portUSING_MPU_WRAPPERS == 1 )
+            xMPU_SETTINGS xDummy2;
+        #endif
+        StaticListItem_t xDummy3[ 2 ];
+        UBaseType_t uxDummy5;
+        void * pxDummy6;
+        uint8_t ucDummy7[ configMAX_TASK_NAME_LEN ];
+        #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
+            void * pxDummy8;
+        #endif
+        #if ( portCRITICAL_NESTING_IN_TCB == 1 )
+            UBaseType_t uxDummy9;
+        #endif
+        #if ( configUSE_TRACE_FACILITY == 1 )
+            UBaseType_t uxDummy10[ 2 ];
+        #endif
+        #if ( configUSE_MUTEXES == 1 )
+            UBaseType_t uxDummy12[ 2 ];
+        #endif
+        #if ( configUSE_APPLICATION_TASK_TAG == 1 )
+            void * pxDummy14;
+        #endif
+        #if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
+            void * pvDummy15[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
+        #endif
+        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            configRUN_TIME_COUNTER_TYPE ulDummy16;
+        #endif
+        #if ( ( configUSE_NEWLIB_REENTRANT == 1 ) || ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) )
+            configTLS_BLOCK_TYPE xDummy17;
+        #endif
+        #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+            uint32_t ulDummy18[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+            uint8_t ucDummy19[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+        #endif
+        #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+            uint8_t uxDummy20;
+        #endif
 
-    #if ( INCLUDE_xTaskAbortDelay == 1 )
-        uint8_t ucDummy21;
-    #endif
-    #if ( configUSE_POSIX_ERRNO == 1 )
-        int iDummy22;
-    #endif
-} StaticTask_t;
+        #if ( INCLUDE_xTaskAbortDelay == 1 )
+            uint8_t ucDummy21;
+        #endif
+        #if ( configUSE_POSIX_ERRNO == 1 )
+            int iDummy22;
+        #endif
+        #if ( configUSE_TIMER_SLACK == 1 )
+            TickType_t xDummy23;
+        #endif
+        #if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+            uint64_t ullDummy24;
+        #endif
+        #if ( configUSE_HEAP_ACCOUNTING == 1 )
+            size_t xDummy25[ 4 ];
+        #endif
+        #if ( configUSE_TICKETS == 1 )
+            int iDummy26[ 2 ];
+        #endif
+    } StaticTask_t;
+#endif /* configUSE_COMPACT_TCB */
 
 /*
  * In line with software engineering best practice, especially when supplying a
@@ -1327,7 +1856,7 @@ typedef struct xSTATIC_QUEUE
         UBaseType_t uxDummy2;
     } u;
 
-    StaticList_t xDummy3[ 2 ];
+    StaticEventList_t xDummy3[ 2 ];
     UBaseType_t uxDummy4[ 3 ];
     uint8_t ucDummy5[ 2 ];
 
@@ -1335,8 +1864,17 @@ typedef struct xSTATIC_QUEUE
         uint8_t ucDummy6;
     #endif
 
+    #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+        uint8_t ucDummy10;
+    #endif
+
     #if ( configUSE_QUEUE_SETS == 1 )
         void * pvDummy7;
+
+        #if ( configUSE_QUEUE_SET_READY_LIST == 1 )
+            void * pvDummy11[ 3 ];
+            UBaseType_t uxDummy12;
+        #endif
     #endif
 
     #if ( configUSE_TRACE_FACILITY == 1 )
@@ -1362,9 +1900,26 @@ typedef StaticQueue_t StaticSemaphore_t;
  */
 typedef struct xSTATIC_EVENT_GROUP
 {
-    TickType_t xDummy1;
+    #if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+        uint64_t ullDummy1;
+    #else
+        TickType_t xDummy1;
+    #endif
     StaticList_t xDummy2;
 
+    #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+        #if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+            uint64_t ullDummy5;
+            StaticList_t xDummy6[ 64 ];
+        #elif ( configUSE_16_BIT_TICKS == 1 )
+            TickType_t xDummy5;
+            StaticList_t xDummy6[ 8 ];
+        #else
+            TickType_t xDummy5;
+            StaticList_t xDummy6[ 24 ];
+        #endif
+    #endif
+
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxDummy3;
     #endif
@@ -1431,6 +1986,62 @@ typedef struct xSTATIC_STREAM_BUFFER
 /* Message buffers are built on stream buffers. */
 typedef StaticStreamBuffer_t StaticMessageBuffer_t;
 
+/*
+ * In line with the other Static*_t structures above, StaticSpscQueue_t has the
+ * same size and alignment as the SPSC queue structure used by spsc_queue.c, so
+ * SPSC queues can be created without dynamic memory allocation.
+ */
+typedef struct xSTATIC_SPSC_QUEUE
+{
+    UBaseType_t uxDummy1[ 4 ];
+    void * pvDummy2[ 2 ];
+    uint8_t ucDummy3;
+} StaticSpscQueue_t;
+
+/*
+ * In line with the other Static*_t structures above, StaticLightSemaphore_t
+ * and StaticLightEventFlags_t have the same size and alignment as the
+ * structures used by light_sync.c.
+ */
+typedef struct xSTATIC_LIGHT_SEMAPHORE
+{
+    UBaseType_t uxDummy1[ 2 ];
+    void * pvDummy2;
+    uint8_t ucDummy3;
+} StaticLightSemaphore_t;
+
+typedef struct xSTATIC_LIGHT_EVENT_FLAGS
+{
+    uint32_t ulDummy1;
+    void * pvDummy2;
+    uint8_t ucDummy3;
+} StaticLightEventFlags_t;
+
+/*
+ * In line with the other Static*_t structures above, StaticRWLock_t has the
+ * same size and alignment as the reader-writer lock structure used by
+ * rwlock.c.
+ */
+typedef struct xSTATIC_RWLOCK
+{
+    StaticEventList_t xDummy1[ 2 ];
+    UBaseType_t uxDummy2;
+    void * pvDummy3;
+    uint8_t ucDummy4;
+} StaticRWLock_t;
+
+/*
+ * In line with the other Static*_t structures above, StaticMailbox_t has the
+ * same size and alignment as the mailbox structure used by mailbox.c.
+ */
+typedef struct xSTATIC_MAILBOX
+{
+    uint32_t ulDummy1;
+    size_t xDummy2;
+    void * pvDummy3;
+    uint8_t ucDummy4;
+} StaticMailbox_t;
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
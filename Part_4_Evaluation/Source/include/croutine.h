@@ -58,6 +58,10 @@ typedef struct corCoRoutineControlBlock
     UBaseType_t uxPriority;      /*< The priority of the co-routine in relation to other co-routines. */
     UBaseType_t uxIndex;         /*< Used to distinguish between co-routines when multiple co-routines use the same co-routine function. */
     uint16_t uxState;            /*< Used internally by the co-routine implementation. */
+
+    #if ( configUSE_TICKETS == 1 )
+        UBaseType_t uxTickets;   /*< Lottery tickets held by the co-routine.  Its share of the processor is uxTickets over the tickets held by all the ready co-routines of the same priority. */
+    #endif
 } CRCB_t;                        /* Co-routine control block.  Note must be identical in size down to uxPriority with TCB_t. */
 
 /**
@@ -66,7 +70,8 @@ typedef struct corCoRoutineControlBlock
  * BaseType_t xCoRoutineCreate(
  *                               crCOROUTINE_CODE pxCoRoutineCode,
  *                               UBaseType_t uxPriority,
- *                               UBaseType_t uxIndex
+ *                               UBaseType_t uxIndex,
+ *                               UBaseType_t uxTicketNumber
  *                             );
  * @endcode
  *
@@ -84,6 +89,13 @@ typedef struct corCoRoutineControlBlock
  * execute the same function.  See the example below and the co-routine section
  * of the WEB documentation for further information.
  *
+ * @param uxTicketNumber The number of lottery tickets held by the co-routine.
+ * When configUSE_TICKETS is set to 1 the co-routine scheduler draws a ticket
+ * among the ready co-routines of the highest ready priority, so each of them
+ * runs in proportion to the tickets it holds.  Co-routines holding no tickets
+ * only run when no co-routine of the same priority holds any.  Ignored when
+ * configUSE_TICKETS is not 1.
+ *
  * @return pdPASS if the co-routine was successfully created and added to a ready
  * list, otherwise an error code defined with ProjDefs.h.
  *
@@ -123,10 +135,11 @@ typedef struct corCoRoutineControlBlock
  *
  *   // Create two co-routines at priority 0.  The first is given index 0
  *   // so (from the code above) toggles LED 5 every 200 ticks.  The second
- *   // is given index 1 so toggles LED 6 every 400 ticks.
+ *   // is given index 1 so toggles LED 6 every 400 ticks.  Both hold 10
+ *   // tickets, so they get an equal share of the processor.
  *   for( uxIndex = 0; uxIndex < 2; uxIndex++ )
  *   {
- *       xCoRoutineCreate( vFlashCoRoutine, 0, uxIndex );
+ *       xCoRoutineCreate( vFlashCoRoutine, 0, uxIndex, 10 );
  *   }
  * }
  * @endcode
@@ -135,7 +148,8 @@ typedef struct corCoRoutineControlBlock
  */
 BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode,
                              UBaseType_t uxPriority,
-                             UBaseType_t uxIndex );
+                             UBaseType_t uxIndex,
+                             UBaseType_t uxTicketNumber );
 
 
 /**
@@ -733,7 +747,7 @@ void vCoRoutineSchedule( void );
  * appropriate delayed list.
  */
 void vCoRoutineAddToDelayedList( TickType_t xTicksToDelay,
-                                 List_t * pxEventList );
+                                 EventList_t * pxEventList );
 
 /*
  * This function is intended for internal use by the queue implementation only.
@@ -742,7 +756,7 @@ void vCoRoutineAddToDelayedList( TickType_t xTicksToDelay,
  * Removes the highest priority co-routine from the event list and places it in
  * the pending ready list.
  */
-BaseType_t xCoRoutineRemoveFromEventList( const List_t * pxEventList );
+BaseType_t xCoRoutineRemoveFromEventList( EventList_t * pxEventList );
 
 /* *INDENT-OFF* */
 #ifdef __cplusplus
@@ -83,14 +83,19 @@ struct EventGroupDef_t;
 typedef struct EventGroupDef_t   * EventGroupHandle_t;
 
 /*
- * The type that holds event bits always matches TickType_t - therefore the
- * number of bits it holds is set by configUSE_16_BIT_TICKS (16 bits if set to 1,
- * 32 bits if set to 0.
+ * The type that holds event bits matches TickType_t - therefore the number of
+ * bits it holds is set by configUSE_16_BIT_TICKS (16 bits if set to 1, 32 bits
+ * if set to 0.  If configUSE_WIDE_EVENT_GROUPS is set to 1 the type is 64 bits
+ * wide instead, whatever the width of TickType_t, and all 64 bits can be used.
  *
  * \defgroup EventBits_t EventBits_t
  * \ingroup EventGroup
  */
-typedef TickType_t               EventBits_t;
+#if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+    typedef uint64_t             EventBits_t;
+#else
+    typedef TickType_t           EventBits_t;
+#endif
 
 /**
  * event_groups.h
@@ -386,7 +391,9 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
  *
  * @param uxBitsToClear A bitwise value that indicates the bit or bits to clear.
  * For example, to clear bit 3 only, set uxBitsToClear to 0x08.  To clear bit 3
- * and bit 0 set uxBitsToClear to 0x09.
+ * and bit 0 set uxBitsToClear to 0x09.  The message to the timer task carries
+ * 32 bits, so if configUSE_WIDE_EVENT_GROUPS is 1 only bits 0 to 31 can be
+ * cleared from an interrupt.
  *
  * @return If the request to execute the function was posted successfully then
  * pdPASS is returned, otherwise pdFALSE is returned.  pdFALSE will be returned
@@ -521,7 +528,9 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  *
  * @param uxBitsToSet A bitwise value that indicates the bit or bits to set.
  * For example, to set bit 3 only, set uxBitsToSet to 0x08.  To set bit 3
- * and bit 0 set uxBitsToSet to 0x09.
+ * and bit 0 set uxBitsToSet to 0x09.  The message to the timer task carries
+ * 32 bits, so if configUSE_WIDE_EVENT_GROUPS is 1 only bits 0 to 31 can be
+ * set from an interrupt.
  *
  * @param pxHigherPriorityTaskWoken As mentioned above, calling this function
  * will result in a message being sent to the timer daemon task.  If the
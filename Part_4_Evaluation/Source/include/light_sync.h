@@ -0,0 +1,491 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Light semaphores and light event flags are smaller and faster alternatives
+ * to the semaphores in semphr.h and the event groups in event_groups.h for
+ * applications that do not need all their features.
+ *
+ * A semaphore created by semphr.h is a complete queue, with two event lists,
+ * and a task that gives or takes it runs through the generic queue send and
+ * receive paths.  A light semaphore only holds its count and a pointer to the
+ * tasks waiting to take it.  Each waiting task keeps its own record of the
+ * wait on its own stack and is woken using a direct to task notification, so
+ * giving and taking a light semaphore is a short critical section.  Likewise
+ * light event flags only hold the flag values and a pointer to the waiting
+ * tasks, and setting flags from an interrupt wakes the waiting tasks directly
+ * rather than deferring the work to the RTOS daemon task.
+ *
+ * ***NOTE***:  Waiting tasks are woken using the direct to task notification at
+ * index configLIGHT_SYNC_NOTIFICATION_INDEX, so that notification index must
+ * not be used for anything else by tasks that wait on light semaphores or
+ * light event flags.  Any notification pending at that index when a task starts
+ * to wait is discarded.  If configTASK_NOTIFICATION_ARRAY_ENTRIES is greater
+ * than 1 then configLIGHT_SYNC_NOTIFICATION_INDEX must be set to an index other
+ * than 0, which is the index used by xTaskNotifyGive(), ulTaskNotifyTake() and
+ * stream and message buffers.  Waiting tasks are woken in the order they
+ * started to wait, not in priority order, and light semaphores do not implement
+ * priority inheritance, so must not be used in place of mutexes.  The time taken
+ * to set light event flags grows with the number of tasks waiting on them.
+ *
+ * configUSE_LIGHT_SYNC must be set to 1 in FreeRTOSConfig.h, and light_sync.c
+ * must be built, for light semaphores and light event flags to be available.
+ */
+
+#ifndef LIGHT_SYNC_H
+#define LIGHT_SYNC_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include light_sync.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * Type by which light semaphores are referenced.  For example, a call to
+ * xLightSemaphoreCreate() returns a LightSemaphoreHandle_t variable that can
+ * then be used as a parameter to xLightSemaphoreTake(), xLightSemaphoreGive(),
+ * etc.
+ */
+struct LightSemaphoreDefinition;
+typedef struct LightSemaphoreDefinition * LightSemaphoreHandle_t;
+
+/**
+ * Type by which light event flags are referenced.  For example, a call to
+ * xLightEventFlagsCreate() returns a LightEventFlagsHandle_t variable that can
+ * then be used as a parameter to ulLightEventFlagsWait(),
+ * ulLightEventFlagsSet(), etc.
+ */
+struct LightEventFlagsDefinition;
+typedef struct LightEventFlagsDefinition * LightEventFlagsHandle_t;
+
+/**
+ * light_sync.h
+ *
+ * @code{c}
+ * LightSemaphoreHandle_t xLightSemaphoreCreate( UBaseType_t uxMaxCount, UBaseType_t uxInitialCount );
+ * @endcode
+ *
+ * Creates a new light semaphore using dynamically allocated memory.  Use a
+ * uxMaxCount of 1 for a binary semaphore.
+ *
+ * configSUPPORT_DYNAMIC_ALLOCATION must be set to 1 or left undefined in
+ * FreeRTOSConfig.h for xLightSemaphoreCreate() to be available.
+ *
+ * @param uxMaxCount The maximum count value that can be reached.  When the
+ * semaphore reaches this value it can no longer be 'given'.
+ *
+ * @param uxInitialCount The count value assigned to the semaphore when it is
+ * created.
+ *
+ * @return If the semaphore is created successfully then a handle to the
+ * created semaphore is returned.  If there was insufficient heap memory
+ * available to create the semaphore then NULL is returned.
+ *
+ * \defgroup xLightSemaphoreCreate xLightSemaphoreCreate
+ * \ingroup LightSyncManagement
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    LightSemaphoreHandle_t xLightSemaphoreCreate( UBaseType_t uxMaxCount,
+                                                  UBaseType_t uxInitialCount ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * light_sync.h
+ *
+ * @code{c}
+ * LightSemaphoreHandle_t xLightSemaphoreCreateStatic( UBaseType_t uxMaxCount,
+ *                                                     UBaseType_t uxInitialCount,
+ *                                                     StaticLightSemaphore_t *pxSemaphoreBuffer );
+ * @endcode
+ *
+ * Creates a new light semaphore using statically allocated memory.
+ *
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * xLightSemaphoreCreateStatic() to be available.
+ *
+ * @param uxMaxCount The maximum count value that can be reached.
+ *
+ * @param uxInitialCount The count value assigned to the semaphore when it is
+ * created.
+ *
+ * @param pxSemaphoreBuffer Must point to a variable of type
+ * StaticLightSemaphore_t, which will be used to hold the semaphore's data
+ * structure.
+ *
+ * @return If the semaphore is created successfully then a handle to the
+ * created semaphore is returned.  If pxSemaphoreBuffer is NULL then NULL is
+ * returned.
+ *
+ * \defgroup xLightSemaphoreCreateStatic xLightSemaphoreCreateStatic
+ * \ingroup LightSyncManagement
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    LightSemaphoreHandle_t xLightSemaphoreCreateStatic( UBaseType_t uxMaxCount,
+                                                        UBaseType_t uxInitialCount,
+                                                        StaticLightSemaphore_t * const pxSemaphoreBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * light_sync.h
+ *
+ * @code{c}
+ * void vLightSemaphoreDelete( LightSemaphoreHandle_t xSemaphore );
+ * @endcode
+ *
+ * Deletes a light semaphore that was previously created using a call to
+ * xLightSemaphoreCreate() or xLightSemaphoreCreateStatic().  No task may be
+ * waiting on the semaphore when it is deleted.
+ *
+ * @param xSemaphore The handle of the semaphore to be deleted.
+ *
+ * \defgroup vLightSemaphoreDelete vLightSemaphoreDelete
+ * \ingroup LightSyncManagement
+ */
+void vLightSemaphoreDelete( LightSemaphoreHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_sync.h
+ *
+ * @code{c}
+ * BaseType_t xLightSemaphoreTake( LightSemaphoreHandle_t xSemaphore, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Takes a light semaphore, blocking for up to xTicksToWait ticks if the count
+ * is zero.  A task that is blocked on the semaphore is handed the count
+ * directly when the semaphore is given.
+ *
+ * @param xSemaphore The handle of the semaphore being taken.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should
+ * remain in the Blocked state to wait for the semaphore to become available.
+ *
+ * @return pdPASS if the semaphore was obtained, otherwise pdFAIL.
+ *
+ * \defgroup xLightSemaphoreTake xLightSemaphoreTake
+ * \ingroup LightSyncManagement
+ */
+BaseType_t xLightSemaphoreTake( LightSemaphoreHandle_t xSemaphore,
+                                TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_sync.h
+ *
+ * @code{c}
+ * BaseType_t xLightSemaphoreTakeFromISR( LightSemaphoreHandle_t xSemaphore );
+ * @endcode
+ *
+ * A version of xLightSemaphoreTake() that can be called from an interrupt
+ * service routine.  It never blocks.
+ *
+ * @param xSemaphore The handle of the semaphore being taken.
+ *
+ * @return pdPASS if the semaphore was obtained, otherwise pdFAIL.
+ *
+ * \defgroup xLightSemaphoreTakeFromISR xLightSemaphoreTakeFromISR
+ * \ingroup LightSyncManagement
+ */
+BaseType_t xLightSemaphoreTakeFromISR( LightSemaphoreHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_sync.h
+ *
+ * @code{c}
+ * BaseType_t xLightSemaphoreGive( LightSemaphoreHandle_t xSemaphore );
+ * @endcode
+ *
+ * Gives a light semaphore.  If a task is waiting to take the semaphore then
+ * the oldest waiting task is given the semaphore and unblocked, otherwise the
+ * count is incremented.
+ *
+ * @param xSemaphore The handle of the semaphore being given.
+ *
+ * @return pdPASS if the semaphore was given, or pdFAIL if the count was
+ * already at its maximum value.
+ *
+ * \defgroup xLightSemaphoreGive xLightSemaphoreGive
+ * \ingroup LightSyncManagement
+ */
+BaseType_t xLightSemaphoreGive( LightSemaphoreHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_sync.h
+ *
+ * @code{c}
+ * BaseType_t xLightSemaphoreGiveFromISR( LightSemaphoreHandle_t xSemaphore, BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xLightSemaphoreGive() that can be called from an interrupt
+ * service routine.
+ *
+ * @param xSemaphore The handle of the semaphore being given.
+ *
+ * @param pxHigherPriorityTaskWoken *pxHigherPriorityTaskWoken is set to pdTRUE
+ * if giving the semaphore unblocked a task that has a priority above the
+ * currently running task.  If it is set to pdTRUE then a context switch should
+ * be requested before the interrupt is exited.
+ *
+ * @return pdPASS if the semaphore was given, or pdFAIL if the count was
+ * already at its maximum value.
+ *
+ * \defgroup xLightSemaphoreGiveFromISR xLightSemaphoreGiveFromISR
+ * \ingroup LightSyncManagement
+ */
+BaseType_t xLightSemaphoreGiveFromISR( LightSemaphoreHandle_t xSemaphore,
+                                       BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_sync.h
+ *
+ * @code{c}
+ * UBaseType_t uxLightSemaphoreGetCount( LightSemaphoreHandle_t xSemaphore );
+ * @endcode
+ *
+ * @param xSemaphore The handle of the semaphore being queried.
+ *
+ * @return The current count of the semaphore.
+ *
+ * \defgroup uxLightSemaphoreGetCount uxLightSemaphoreGetCount
+ * \ingroup LightSyncManagement
+ */
+UBaseType_t uxLightSemaphoreGetCount( LightSemaphoreHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_sync.h
+ *
+ * @code{c}
+ * LightEventFlagsHandle_t xLightEventFlagsCreate( void );
+ * @endcode
+ *
+ * Creates a new set of light event flags, all of which are initially clear,
+ * using dynamically allocated memory.  Unlike event groups all 32 bits are
+ * available to the application.
+ *
+ * configSUPPORT_DYNAMIC_ALLOCATION must be set to 1 or left undefined in
+ * FreeRTOSConfig.h for xLightEventFlagsCreate() to be available.
+ *
+ * @return If the event flags are created successfully then a handle to them is
+ * returned.  If there was insufficient heap memory available then NULL is
+ * returned.
+ *
+ * \defgroup xLightEventFlagsCreate xLightEventFlagsCreate
+ * \ingroup LightSyncManagement
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    LightEventFlagsHandle_t xLightEventFlagsCreate( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * light_sync.h
+ *
+ * @code{c}
+ * LightEventFlagsHandle_t xLightEventFlagsCreateStatic( StaticLightEventFlags_t *pxEventFlagsBuffer );
+ * @endcode
+ *
+ * Creates a new set of light event flags using statically allocated memory.
+ *
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * xLightEventFlagsCreateStatic() to be available.
+ *
+ * @param pxEventFlagsBuffer Must point to a variable of type
+ * StaticLightEventFlags_t, which will be used to hold the event flags' data
+ * structure.
+ *
+ * @return If the event flags are created successfully then a handle to them is
+ * returned.  If pxEventFlagsBuffer is NULL then NULL is returned.
+ *
+ * \defgroup xLightEventFlagsCreateStatic xLightEventFlagsCreateStatic
+ * \ingroup LightSyncManagement
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    LightEventFlagsHandle_t xLightEventFlagsCreateStatic( StaticLightEventFlags_t * const pxEventFlagsBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * light_sync.h
+ *
+ * @code{c}
+ * void vLightEventFlagsDelete( LightEventFlagsHandle_t xEventFlags );
+ * @endcode
+ *
+ * Deletes light event flags that were previously created using a call to
+ * xLightEventFlagsCreate() or xLightEventFlagsCreateStatic().  No task may be
+ * waiting on the flags when they are deleted.
+ *
+ * @param xEventFlags The handle of the event flags to be deleted.
+ *
+ * \defgroup vLightEventFlagsDelete vLightEventFlagsDelete
+ * \ingroup LightSyncManagement
+ */
+void vLightEventFlagsDelete( LightEventFlagsHandle_t xEventFlags ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_sync.h
+ *
+ * @code{c}
+ * uint32_t ulLightEventFlagsWait( LightEventFlagsHandle_t xEventFlags,
+ *                                 uint32_t ulBitsToWaitFor,
+ *                                 BaseType_t xClearOnExit,
+ *                                 BaseType_t xWaitForAllBits,
+ *                                 TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Blocks for up to xTicksToWait ticks for any, or all, of the bits in
+ * ulBitsToWaitFor to be set.  The parameters have the same meaning as those of
+ * xEventGroupWaitBits().
+ *
+ * @param xEventFlags The handle of the event flags being waited on.
+ *
+ * @param ulBitsToWaitFor The bits to wait for.  Must not be zero.
+ *
+ * @param xClearOnExit If pdTRUE then the bits in ulBitsToWaitFor are cleared
+ * when the condition is met.  Bits are only cleared once every task released
+ * by the same call to ulLightEventFlagsSet() has been released.
+ *
+ * @param xWaitForAllBits If pdTRUE then the function waits for all the bits
+ * in ulBitsToWaitFor to be set, otherwise for any one of them.
+ *
+ * @param xTicksToWait The maximum amount of time to wait.
+ *
+ * @return The value of the flags at the time the condition was met, before any
+ * bits were cleared, or the value at the time the wait timed out.  Test the
+ * return value to know which.
+ *
+ * \defgroup ulLightEventFlagsWait ulLightEventFlagsWait
+ * \ingroup LightSyncManagement
+ */
+uint32_t ulLightEventFlagsWait( LightEventFlagsHandle_t xEventFlags,
+                                uint32_t ulBitsToWaitFor,
+                                BaseType_t xClearOnExit,
+                                BaseType_t xWaitForAllBits,
+                                TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_sync.h
+ *
+ * @code{c}
+ * uint32_t ulLightEventFlagsSet( LightEventFlagsHandle_t xEventFlags, uint32_t ulBitsToSet );
+ * @endcode
+ *
+ * Sets bits in light event flags, releasing any tasks whose wait condition is
+ * then met.
+ *
+ * @param xEventFlags The handle of the event flags being updated.
+ *
+ * @param ulBitsToSet The bits to set.
+ *
+ * @return The value of the flags after the bits were set, before any bits
+ * were cleared by the tasks that were released.
+ *
+ * \defgroup ulLightEventFlagsSet ulLightEventFlagsSet
+ * \ingroup LightSyncManagement
+ */
+uint32_t ulLightEventFlagsSet( LightEventFlagsHandle_t xEventFlags,
+                               uint32_t ulBitsToSet ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_sync.h
+ *
+ * @code{c}
+ * uint32_t ulLightEventFlagsSetFromISR( LightEventFlagsHandle_t xEventFlags,
+ *                                       uint32_t ulBitsToSet,
+ *                                       BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of ulLightEventFlagsSet() that can be called from an interrupt
+ * service routine.  Waiting tasks are released within the interrupt, so the
+ * RTOS daemon task is not needed.
+ *
+ * @param xEventFlags The handle of the event flags being updated.
+ *
+ * @param ulBitsToSet The bits to set.
+ *
+ * @param pxHigherPriorityTaskWoken *pxHigherPriorityTaskWoken is set to pdTRUE
+ * if setting the bits unblocked a task that has a priority above the currently
+ * running task.  If it is set to pdTRUE then a context switch should be
+ * requested before the interrupt is exited.
+ *
+ * @return The value of the flags after the bits were set, before any bits
+ * were cleared by the tasks that were released.
+ *
+ * \defgroup ulLightEventFlagsSetFromISR ulLightEventFlagsSetFromISR
+ * \ingroup LightSyncManagement
+ */
+uint32_t ulLightEventFlagsSetFromISR( LightEventFlagsHandle_t xEventFlags,
+                                      uint32_t ulBitsToSet,
+                                      BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_sync.h
+ *
+ * @code{c}
+ * uint32_t ulLightEventFlagsClear( LightEventFlagsHandle_t xEventFlags, uint32_t ulBitsToClear );
+ * @endcode
+ *
+ * Clears bits in light event flags.  Must not be called from an interrupt
+ * service routine.
+ *
+ * @param xEventFlags The handle of the event flags being updated.
+ *
+ * @param ulBitsToClear The bits to clear.
+ *
+ * @return The value of the flags before the bits were cleared.
+ *
+ * \defgroup ulLightEventFlagsClear ulLightEventFlagsClear
+ * \ingroup LightSyncManagement
+ */
+uint32_t ulLightEventFlagsClear( LightEventFlagsHandle_t xEventFlags,
+                                 uint32_t ulBitsToClear ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_sync.h
+ *
+ * @code{c}
+ * uint32_t ulLightEventFlagsGet( LightEventFlagsHandle_t xEventFlags );
+ * @endcode
+ *
+ * @param xEventFlags The handle of the event flags being queried.
+ *
+ * @return The current value of the flags.
+ *
+ * \defgroup ulLightEventFlagsGet ulLightEventFlagsGet
+ * \ingroup LightSyncManagement
+ */
+uint32_t ulLightEventFlagsGet( LightEventFlagsHandle_t xEventFlags ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( LIGHT_SYNC_H ) */
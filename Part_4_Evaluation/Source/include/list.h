@@ -137,6 +137,14 @@
 #endif /* configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES */
 
 
+/* The timing wheel below is only built when a kernel object is configured to
+ * use it. */
+#if ( ( configUSE_DELAYED_TASK_WHEEL == 1 ) || ( configUSE_TIMER_WHEEL == 1 ) )
+    #define listINCLUDE_WHEEL    1
+#else
+    #define listINCLUDE_WHEEL    0
+#endif
+
 /*
  * Definition of the only type of object that a list can contain.
  */
@@ -178,6 +186,64 @@ typedef struct xLIST
     listSECOND_LIST_INTEGRITY_CHECK_VALUE     /*< Set to a known value if configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES is set to 1. */
 } List_t;
 
+/*
+ * Definition of a hierarchical timing wheel built from lists.  Items are
+ * filed by their item value (an absolute tick count) into one of
+ * listWHEEL_SLOTS slots on each of configLIST_WHEEL_LEVELS levels.  Level 0
+ * holds items due within listWHEEL_SLOTS ticks, one slot per tick, and each
+ * further level covers listWHEEL_SLOTS times the span of the level below it.
+ * Items cascade down a level each time the wheel time crosses the span of the
+ * slot they are in.  Insertion is O(1) and each item is moved at most once per
+ * level, in place of the O(n) sorted insertion of vListInsert().
+ *
+ * Items are removed from a wheel with uxListRemove() or listREMOVE_ITEM(), as
+ * from any other list.
+ */
+#if ( listINCLUDE_WHEEL == 1 )
+    #define listWHEEL_SLOT_BITS       ( 5U )
+    #define listWHEEL_SLOTS           ( ( UBaseType_t ) 1U << listWHEEL_SLOT_BITS )
+    #define listWHEEL_SLOT_MASK       ( listWHEEL_SLOTS - ( UBaseType_t ) 1U )
+    #define listWHEEL_TOTAL_SLOTS     ( listWHEEL_SLOTS * ( UBaseType_t ) configLIST_WHEEL_LEVELS )
+
+    typedef struct xLIST_WHEEL
+    {
+        TickType_t xWheelTime;                              /*< The tick up to which the wheel has been advanced.  Items in the level 0 slot of this tick are due. */
+        uint32_t ulOccupiedSlots[ configLIST_WHEEL_LEVELS ]; /*< One bit per slot that may hold items.  Bits are cleared lazily as items can be removed from a slot with uxListRemove(). */
+        List_t xSlots[ listWHEEL_TOTAL_SLOTS ];             /*< The slots of level n are at indexes [ n * listWHEEL_SLOTS, ( n + 1 ) * listWHEEL_SLOTS ). */
+    } ListWheel_t;
+#endif /* listINCLUDE_WHEEL */
+
+/*
+ * Definition of a list of blocked tasks held as one FIFO bucket per priority,
+ * with a bit set in ulOccupiedPriorities for each bucket that may hold items.
+ * Insertion appends to the bucket of the given priority, and the highest
+ * priority item is found by counting the leading zeros of the map, so both are
+ * O(1) in place of the O(n) sorted insertion of vListInsert().  Items of equal
+ * priority are returned in the order in which they were inserted, just as
+ * vListInsert() orders items of equal value.
+ *
+ * Items are removed with uxListRemove() or listREMOVE_ITEM(), as from any
+ * other list.
+ */
+#if ( configUSE_PRIORITY_EVENT_LISTS == 1 )
+    typedef struct xPRIORITY_LIST
+    {
+        uint32_t ulOccupiedPriorities;           /*< One bit per bucket that may hold items.  Bits are cleared lazily as items can be removed from a bucket with uxListRemove(). */
+        List_t xBuckets[ configMAX_PRIORITIES ]; /*< The items blocked at priority n are held in xBuckets[ n ]. */
+    } PriorityList_t;
+#endif /* configUSE_PRIORITY_EVENT_LISTS */
+
+/*
+ * The type of the lists on which tasks and co-routines block when waiting to
+ * send to or receive from a queue.  Kernel code accesses them through the
+ * listEVENT_LIST_ macros below so it is unaffected by the representation used.
+ */
+#if ( configUSE_PRIORITY_EVENT_LISTS == 1 )
+    typedef PriorityList_t   EventList_t;
+#else
+    typedef List_t           EventList_t;
+#endif
+
 /*
  * Access macro to set the owner of a list item.  The owner of a list item
  * is the object (usually a TCB) that contains the list item.
@@ -420,6 +486,68 @@ typedef struct xLIST
  */
 #define listLIST_IS_INITIALISED( pxList )                ( ( pxList )->xListEnd.xItemValue == portMAX_DELAY )
 
+#if ( listINCLUDE_WHEEL == 1 )
+
+/*
+ * Access macro to obtain one of the lists that make up a timing wheel, so
+ * every item held by the wheel can be visited by looping uxIndex from 0 to
+ * listWHEEL_TOTAL_SLOTS - 1.
+ *
+ * \page listWHEEL_GET_SLOT listWHEEL_GET_SLOT
+ * \ingroup LinkedList
+ */
+    #define listWHEEL_GET_SLOT( pxWheel, uxIndex )    ( &( ( pxWheel )->xSlots[ ( uxIndex ) ] ) )
+
+/*
+ * Check to see if a list is one of the slots of a timing wheel, and therefore
+ * whether an item whose container is pxList is held by the wheel.
+ *
+ * @param pxWheel The timing wheel.
+ * @param pxList The list to test.
+ * @return pdTRUE if pxList belongs to pxWheel, otherwise pdFALSE.
+ */
+    #define listWHEEL_CONTAINS_LIST( pxWheel, pxList )                      \
+    ( ( ( ( pxList ) >= listWHEEL_GET_SLOT( ( pxWheel ), 0 ) ) &&           \
+        ( ( pxList ) <= listWHEEL_GET_SLOT( ( pxWheel ), listWHEEL_TOTAL_SLOTS - 1U ) ) ) ? pdTRUE : pdFALSE )
+
+/*
+ * Access macro to obtain the tick count to which a timing wheel has been
+ * advanced.  Expiry times held by the wheel are all at or after this time, so
+ * it can be used as the reference when comparing tick counts that may have
+ * wrapped.
+ *
+ * \page listWHEEL_GET_WHEEL_TIME listWHEEL_GET_WHEEL_TIME
+ * \ingroup LinkedList
+ */
+    #define listWHEEL_GET_WHEEL_TIME( pxWheel )    ( ( pxWheel )->xWheelTime )
+
+#endif /* listINCLUDE_WHEEL */
+
+/*
+ * Access macros for event lists.  An event list is either a List_t sorted by
+ * item value, which for a blocked task is ( configMAX_PRIORITIES - uxPriority ),
+ * or a PriorityList_t when configUSE_PRIORITY_EVENT_LISTS is 1.
+ *
+ * listEVENT_LIST_INSERT() places an item in priority order, FIFO amongst items
+ * of equal priority.  listEVENT_LIST_GET_HEAD_ENTRY() returns the item of the
+ * highest priority waiter, and must only be used on an event list that is not
+ * empty.
+ *
+ * \page listEVENT_LIST_INSERT listEVENT_LIST_INSERT
+ * \ingroup LinkedList
+ */
+#if ( configUSE_PRIORITY_EVENT_LISTS == 1 )
+    #define listEVENT_LIST_INITIALISE( pxEventList )                          vListInitialisePriorityList( pxEventList )
+    #define listEVENT_LIST_INSERT( pxEventList, pxNewListItem, uxPriority )    vListPriorityInsert( ( pxEventList ), ( pxNewListItem ), ( uxPriority ) )
+    #define listEVENT_LIST_GET_HEAD_ENTRY( pxEventList )                      pxListPriorityGetHighest( pxEventList )
+    #define listEVENT_LIST_IS_EMPTY( pxEventList )                            ( ( pxListPriorityGetHighest( pxEventList ) == NULL ) ? pdTRUE : pdFALSE )
+#else
+    #define listEVENT_LIST_INITIALISE( pxEventList )                          vListInitialise( pxEventList )
+    #define listEVENT_LIST_INSERT( pxEventList, pxNewListItem, uxPriority )    vListInsert( ( pxEventList ), ( pxNewListItem ) )
+    #define listEVENT_LIST_GET_HEAD_ENTRY( pxEventList )                      listGET_HEAD_ENTRY( pxEventList )
+    #define listEVENT_LIST_IS_EMPTY( pxEventList )                            listLIST_IS_EMPTY( pxEventList )
+#endif
+
 /*
  * Must be called before a list is used!  This initialises all the members
  * of the list structure and inserts the xListEnd item into the list as a
@@ -494,6 +622,137 @@ void vListInsertEnd( List_t * const pxList,
  */
 UBaseType_t uxListRemove( ListItem_t * const pxItemToRemove ) PRIVILEGED_FUNCTION;
 
+#if ( listINCLUDE_WHEEL == 1 )
+
+/*
+ * Must be called before a timing wheel is used.
+ *
+ * @param pxWheel The wheel to initialise.
+ *
+ * @param xStartTime The tick count from which the wheel starts advancing.
+ * Items inserted into the wheel must have an item value (expiry time) that is
+ * no earlier than this.
+ *
+ * \page vListInitialiseWheel vListInitialiseWheel
+ * \ingroup LinkedList
+ */
+    void vListInitialiseWheel( ListWheel_t * const pxWheel,
+                               TickType_t xStartTime ) PRIVILEGED_FUNCTION;
+
+/*
+ * Insert a list item into a timing wheel, filed by its item value, which is
+ * the tick count at which the item expires.  The expiry time may have wrapped
+ * past the maximum tick count, but must not be earlier than the time to which
+ * the wheel has been advanced.  An item that expires at that time is returned
+ * by the next call to pxListWheelGetExpired().  Items that expire on the same
+ * tick are returned in the order in which they were inserted.
+ *
+ * @param pxWheel The wheel into which the item is to be inserted.
+ *
+ * @param pxNewListItem The item to insert.
+ *
+ * \page vListWheelInsert vListWheelInsert
+ * \ingroup LinkedList
+ */
+    void vListWheelInsert( ListWheel_t * const pxWheel,
+                           ListItem_t * const pxNewListItem ) PRIVILEGED_FUNCTION;
+
+/*
+ * Advance a timing wheel towards xTimeNow and return the first item found to
+ * have expired on the way.  The item is left in the wheel, so the caller must
+ * remove it before calling again.  NULL is returned once the wheel has reached
+ * xTimeNow without finding any more expired items.
+ *
+ * Ticks that hold no items are skipped, so the cost of the call depends on
+ * the number of expired items and, to a lesser extent, on the number of ticks
+ * the wheel is advanced by.  xTimeNow must not be earlier than the time the
+ * wheel has already been advanced to.
+ *
+ * @param pxWheel The wheel to advance.
+ *
+ * @param xTimeNow The current tick count.
+ *
+ * @return An expired item, or NULL if there are none.
+ *
+ * \page pxListWheelGetExpired pxListWheelGetExpired
+ * \ingroup LinkedList
+ */
+    ListItem_t * pxListWheelGetExpired( ListWheel_t * const pxWheel,
+                                        TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Obtain a tick count no later than the time at which the next item held by a
+ * timing wheel expires, in a time that does not depend on the number of items
+ * in the wheel.  The time is exact if the earliest item is due within
+ * listWHEEL_SLOTS ticks.  Otherwise it can be the time at which the slot that
+ * holds the earliest item is cascaded to a lower level, so advancing the wheel
+ * to that time with pxListWheelGetExpired() may not find an expired item, after
+ * which the next call returns a time closer to, or equal to, the expiry time.
+ *
+ * @param pxWheel The wheel to query.
+ *
+ * @param pxNextExpiryTime Set to the expiry time of the earliest item in the
+ * wheel, or to an earlier time as described above.  Not written if the wheel
+ * is empty.
+ *
+ * @return pdTRUE if the wheel holds any items, otherwise pdFALSE.
+ *
+ * \page xListWheelGetNextExpiry xListWheelGetNextExpiry
+ * \ingroup LinkedList
+ */
+    BaseType_t xListWheelGetNextExpiry( ListWheel_t * const pxWheel,
+                                        TickType_t * const pxNextExpiryTime ) PRIVILEGED_FUNCTION;
+
+#endif /* listINCLUDE_WHEEL */
+
+#if ( configUSE_PRIORITY_EVENT_LISTS == 1 )
+
+/*
+ * Must be called before a priority list is used.
+ *
+ * @param pxPriorityList The priority list to initialise.
+ *
+ * \page vListInitialisePriorityList vListInitialisePriorityList
+ * \ingroup LinkedList
+ */
+    void vListInitialisePriorityList( PriorityList_t * const pxPriorityList ) PRIVILEGED_FUNCTION;
+
+/*
+ * Append a list item to the bucket of a priority list that holds items of
+ * the given priority.
+ *
+ * @param pxPriorityList The priority list into which the item is to be
+ * inserted.
+ *
+ * @param pxNewListItem The item to insert.
+ *
+ * @param uxPriority The priority of the item, which must be less than
+ * configMAX_PRIORITIES.
+ *
+ * \page vListPriorityInsert vListPriorityInsert
+ * \ingroup LinkedList
+ */
+    void vListPriorityInsert( PriorityList_t * const pxPriorityList,
+                              ListItem_t * const pxNewListItem,
+                              UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+/*
+ * Obtain the item at the head of the highest priority bucket of a priority
+ * list that is not empty.  The item is left in the list.  Bits found set for
+ * buckets that have since been emptied are cleared on the way.
+ *
+ * @param pxPriorityList The priority list to query.
+ *
+ * @return The oldest item of the highest priority, or NULL if the priority
+ * list is empty.
+ *
+ * \page pxListPriorityGetHighest pxListPriorityGetHighest
+ * \ingroup LinkedList
+ */
+    ListItem_t * pxListPriorityGetHighest( PriorityList_t * const pxPriorityList ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_PRIORITY_EVENT_LISTS */
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
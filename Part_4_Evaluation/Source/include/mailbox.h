@@ -0,0 +1,315 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Mailboxes hold a single item that is overwritten by each write and can be
+ * read any number of times, like a queue of length one used with
+ * xQueueOverwrite() and xQueuePeek().  They are intended for state that is
+ * too large to copy with interrupts disabled.
+ *
+ * A mailbox is a sequence lock:  a write marks the item as changing, copies
+ * the new item in, then marks it as stable again, and a read copies the item
+ * out without locking and tries again if a write happened during the copy.
+ * Interrupts are only masked for the few instructions that mark the start of
+ * a write, so the time for which they are masked does not depend on the size
+ * of the item.
+ *
+ * ***NOTE***:  Tasks write to a mailbox with the scheduler suspended, so other
+ * tasks never see a write in progress.  An interrupt can, so
+ * xMailboxWriteFromISR() and xMailboxReadFromISR() fail, rather than wait,
+ * if they interrupt a write to the same mailbox.  A read by a task is retried
+ * for as long as interrupts keep writing to the mailbox during the copy.
+ *
+ * configUSE_MAILBOXES must be set to 1 in FreeRTOSConfig.h, and mailbox.c
+ * must be built, for mailboxes to be available.
+ */
+
+#ifndef MAILBOX_H
+#define MAILBOX_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include mailbox.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * Type by which mailboxes are referenced.  For example, a call to
+ * xMailboxCreate() returns a MailboxHandle_t variable that can then be used
+ * as a parameter to vMailboxWrite(), xMailboxRead(), etc.
+ */
+struct MailboxDefinition;
+typedef struct MailboxDefinition * MailboxHandle_t;
+
+/**
+ * mailbox.h
+ *
+ * @code{c}
+ * MailboxHandle_t xMailboxCreate( size_t xItemSize );
+ * @endcode
+ *
+ * Creates a new mailbox using dynamically allocated memory.  The mailbox is
+ * empty until it is first written.
+ *
+ * configSUPPORT_DYNAMIC_ALLOCATION must be set to 1 or left undefined in
+ * FreeRTOSConfig.h for xMailboxCreate() to be available.
+ *
+ * @param xItemSize The size, in bytes, of the item the mailbox holds.
+ *
+ * @return If the mailbox is created successfully then a handle to the created
+ * mailbox is returned.  If there was insufficient heap memory available to
+ * create the mailbox then NULL is returned.
+ *
+ * \defgroup xMailboxCreate xMailboxCreate
+ * \ingroup MailboxManagement
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    MailboxHandle_t xMailboxCreate( size_t xItemSize ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * mailbox.h
+ *
+ * @code{c}
+ * MailboxHandle_t xMailboxCreateStatic( size_t xItemSize,
+ *                                       uint8_t *pucItemStorageArea,
+ *                                       StaticMailbox_t *pxStaticMailbox );
+ * @endcode
+ *
+ * Creates a new mailbox using statically allocated memory.
+ *
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * xMailboxCreateStatic() to be available.
+ *
+ * @param xItemSize The size, in bytes, of the item the mailbox holds.
+ *
+ * @param pucItemStorageArea Must point to a uint8_t array that is at least
+ * xItemSize bytes big.
+ *
+ * @param pxStaticMailbox Must point to a variable of type StaticMailbox_t,
+ * which will be used to hold the mailbox's data structure.
+ *
+ * @return If the mailbox is created successfully then a handle to the created
+ * mailbox is returned.  If either pucItemStorageArea or pxStaticMailbox are
+ * NULL then NULL is returned.
+ *
+ * \defgroup xMailboxCreateStatic xMailboxCreateStatic
+ * \ingroup MailboxManagement
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    MailboxHandle_t xMailboxCreateStatic( size_t xItemSize,
+                                          uint8_t * const pucItemStorageArea,
+                                          StaticMailbox_t * const pxStaticMailbox ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * mailbox.h
+ *
+ * @code{c}
+ * void vMailboxDelete( MailboxHandle_t xMailbox );
+ * @endcode
+ *
+ * Deletes a mailbox that was previously created using a call to
+ * xMailboxCreate() or xMailboxCreateStatic().
+ *
+ * @param xMailbox The handle of the mailbox to be deleted.
+ *
+ * \defgroup vMailboxDelete vMailboxDelete
+ * \ingroup MailboxManagement
+ */
+void vMailboxDelete( MailboxHandle_t xMailbox ) PRIVILEGED_FUNCTION;
+
+/**
+ * mailbox.h
+ *
+ * @code{c}
+ * void vMailboxWrite( MailboxHandle_t xMailbox, const void *pvItem );
+ * @endcode
+ *
+ * Overwrites the item held in a mailbox.  Must only be called from a task.
+ * The scheduler is suspended while the item is copied in, but interrupts
+ * remain enabled.
+ *
+ * @param xMailbox The handle of the mailbox being written to.
+ *
+ * @param pvItem A pointer to the item to copy into the mailbox.  The size of
+ * the item was set when the mailbox was created.
+ *
+ * Example usage:
+ * @code{c}
+ * MailboxHandle_t xStateMailbox;
+ *
+ * void vPublishState( const StateVector_t *pxState )
+ * {
+ *  // Readers see either the previous state or this one, never a mix.
+ *  vMailboxWrite( xStateMailbox, pxState );
+ * }
+ *
+ * void vUseLatestState( void )
+ * {
+ * StateVector_t xState;
+ * uint32_t ulSequence;
+ *
+ *  if( xMailboxRead( xStateMailbox, &xState, &ulSequence ) == pdPASS )
+ *  {
+ *      // xState is a consistent copy of the state written by the
+ *      // ulSequence'th write.
+ *  }
+ * }
+ * @endcode
+ * \defgroup vMailboxWrite vMailboxWrite
+ * \ingroup MailboxManagement
+ */
+void vMailboxWrite( MailboxHandle_t xMailbox,
+                    const void * pvItem ) PRIVILEGED_FUNCTION;
+
+/**
+ * mailbox.h
+ *
+ * @code{c}
+ * BaseType_t xMailboxWriteFromISR( MailboxHandle_t xMailbox, const void *pvItem );
+ * @endcode
+ *
+ * A version of vMailboxWrite() that can be called from an interrupt service
+ * routine.  No task is unblocked, so no context switch is needed.
+ *
+ * @param xMailbox The handle of the mailbox being written to.
+ *
+ * @param pvItem A pointer to the item to copy into the mailbox.
+ *
+ * @return pdPASS if the item was written.  pdFAIL if the interrupt occurred
+ * while a task was writing to the same mailbox, in which case the mailbox is
+ * left holding the item the task is writing.
+ *
+ * \defgroup xMailboxWriteFromISR xMailboxWriteFromISR
+ * \ingroup MailboxManagement
+ */
+BaseType_t xMailboxWriteFromISR( MailboxHandle_t xMailbox,
+                                 const void * pvItem ) PRIVILEGED_FUNCTION;
+
+/**
+ * mailbox.h
+ *
+ * @code{c}
+ * BaseType_t xMailboxRead( MailboxHandle_t xMailbox, void *pvBuffer, uint32_t *pulSequence );
+ * @endcode
+ *
+ * Copies the item held in a mailbox out of the mailbox, without removing it.
+ * Must only be called from a task.  Never blocks.
+ *
+ * @param xMailbox The handle of the mailbox being read.
+ *
+ * @param pvBuffer A pointer to a buffer large enough to hold the item.
+ *
+ * @param pulSequence If not NULL, *pulSequence is set to the number of writes
+ * to the mailbox, including the write of the item that was read.  Comparing it
+ * with the value from the previous read tells the caller whether the item has
+ * changed.
+ *
+ * @return pdPASS if the item was read.  pdFAIL if the mailbox has never been
+ * written.
+ *
+ * \defgroup xMailboxRead xMailboxRead
+ * \ingroup MailboxManagement
+ */
+BaseType_t xMailboxRead( MailboxHandle_t xMailbox,
+                         void * pvBuffer,
+                         uint32_t * pulSequence ) PRIVILEGED_FUNCTION;
+
+/**
+ * mailbox.h
+ *
+ * @code{c}
+ * BaseType_t xMailboxReadFromISR( MailboxHandle_t xMailbox, void *pvBuffer, uint32_t *pulSequence );
+ * @endcode
+ *
+ * A version of xMailboxRead() that can be called from an interrupt service
+ * routine.
+ *
+ * @param xMailbox The handle of the mailbox being read.
+ *
+ * @param pvBuffer A pointer to a buffer large enough to hold the item.  The
+ * buffer's contents are undefined if pdFAIL is returned.
+ *
+ * @param pulSequence As for xMailboxRead().
+ *
+ * @return pdPASS if the item was read.  pdFAIL if the mailbox has never been
+ * written, or if the interrupt occurred while the mailbox was being written or
+ * a higher priority interrupt wrote to it during the copy.
+ *
+ * \defgroup xMailboxReadFromISR xMailboxReadFromISR
+ * \ingroup MailboxManagement
+ */
+BaseType_t xMailboxReadFromISR( MailboxHandle_t xMailbox,
+                                void * pvBuffer,
+                                uint32_t * pulSequence ) PRIVILEGED_FUNCTION;
+
+/**
+ * mailbox.h
+ *
+ * @code{c}
+ * uint32_t ulMailboxGetSequence( MailboxHandle_t xMailbox );
+ * @endcode
+ *
+ * @param xMailbox The handle of the mailbox being queried.
+ *
+ * @return The number of completed writes to the mailbox.  Cheaper than a read
+ * for checking whether the item has changed.
+ *
+ * \defgroup ulMailboxGetSequence ulMailboxGetSequence
+ * \ingroup MailboxManagement
+ */
+uint32_t ulMailboxGetSequence( MailboxHandle_t xMailbox ) PRIVILEGED_FUNCTION;
+
+/**
+ * mailbox.h
+ *
+ * @code{c}
+ * size_t xMailboxGetItemSize( MailboxHandle_t xMailbox );
+ * @endcode
+ *
+ * @param xMailbox The handle of the mailbox being queried.
+ *
+ * @return The size, in bytes, of the item the mailbox holds.
+ *
+ * \defgroup xMailboxGetItemSize xMailboxGetItemSize
+ * \ingroup MailboxManagement
+ */
+size_t xMailboxGetItemSize( MailboxHandle_t xMailbox ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( MAILBOX_H ) */
@@ -847,6 +847,92 @@ typedef StreamBufferHandle_t MessageBufferHandle_t;
 #define xMessageBufferReceiveCompletedFromISR( xMessageBuffer, pxHigherPriorityTaskWoken ) \
     xStreamBufferReceiveCompletedFromISR( ( xMessageBuffer ), ( pxHigherPriorityTaskWoken ) )
 
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferSendReserve( MessageBufferHandle_t xMessageBuffer, StreamBufferSpans_t * const pxSpans, size_t xMessageLengthBytes, TickType_t xTicksToWait );
+ * size_t xMessageBufferSendReserveFromISR( MessageBufferHandle_t xMessageBuffer, StreamBufferSpans_t * const pxSpans, size_t xMessageLengthBytes );
+ * size_t xMessageBufferSendCommit( MessageBufferHandle_t xMessageBuffer, size_t xBytesWritten );
+ * size_t xMessageBufferSendCommitFromISR( MessageBufferHandle_t xMessageBuffer, size_t xBytesWritten, BaseType_t * const pxHigherPriorityTaskWoken );
+ * size_t xMessageBufferReceiveAcquire( MessageBufferHandle_t xMessageBuffer, StreamBufferSpans_t * const pxSpans, size_t xBufferLengthBytes, TickType_t xTicksToWait );
+ * size_t xMessageBufferReceiveAcquireFromISR( MessageBufferHandle_t xMessageBuffer, StreamBufferSpans_t * const pxSpans, size_t xBufferLengthBytes );
+ * size_t xMessageBufferReceiveRelease( MessageBufferHandle_t xMessageBuffer, size_t xBytesRead );
+ * size_t xMessageBufferReceiveReleaseFromISR( MessageBufferHandle_t xMessageBuffer, size_t xBytesRead, BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Zero copy access to a message buffer.  See xStreamBufferSendReserve(),
+ * xStreamBufferSendCommit(), xStreamBufferReceiveAcquire() and
+ * xStreamBufferReceiveRelease() in stream_buffer.h.
+ *
+ * A reservation succeeds only if the whole message, plus the bytes used to
+ * store its length, fits in the buffer.  The message length is written when
+ * the message is committed, so a shorter message than was reserved can be
+ * sent.  An acquisition returns the whole of the next message, which must then
+ * be released whole.
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * these macros to be available.
+ *
+ * \defgroup xMessageBufferSendReserve xMessageBufferSendReserve
+ * \ingroup MessageBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+    #define xMessageBufferSendReserve( xMessageBuffer, pxSpans, xMessageLengthBytes, xTicksToWait ) \
+    xStreamBufferSendReserve( ( xMessageBuffer ), ( pxSpans ), ( xMessageLengthBytes ), ( xTicksToWait ) )
+
+    #define xMessageBufferSendReserveFromISR( xMessageBuffer, pxSpans, xMessageLengthBytes ) \
+    xStreamBufferSendReserveFromISR( ( xMessageBuffer ), ( pxSpans ), ( xMessageLengthBytes ) )
+
+    #define xMessageBufferSendCommit( xMessageBuffer, xBytesWritten ) \
+    xStreamBufferSendCommit( ( xMessageBuffer ), ( xBytesWritten ) )
+
+    #define xMessageBufferSendCommitFromISR( xMessageBuffer, xBytesWritten, pxHigherPriorityTaskWoken ) \
+    xStreamBufferSendCommitFromISR( ( xMessageBuffer ), ( xBytesWritten ), ( pxHigherPriorityTaskWoken ) )
+
+    #define xMessageBufferReceiveAcquire( xMessageBuffer, pxSpans, xBufferLengthBytes, xTicksToWait ) \
+    xStreamBufferReceiveAcquire( ( xMessageBuffer ), ( pxSpans ), ( xBufferLengthBytes ), ( xTicksToWait ) )
+
+    #define xMessageBufferReceiveAcquireFromISR( xMessageBuffer, pxSpans, xBufferLengthBytes ) \
+    xStreamBufferReceiveAcquireFromISR( ( xMessageBuffer ), ( pxSpans ), ( xBufferLengthBytes ) )
+
+    #define xMessageBufferReceiveRelease( xMessageBuffer, xBytesRead ) \
+    xStreamBufferReceiveRelease( ( xMessageBuffer ), ( xBytesRead ) )
+
+    #define xMessageBufferReceiveReleaseFromISR( xMessageBuffer, xBytesRead, pxHigherPriorityTaskWoken ) \
+    xStreamBufferReceiveReleaseFromISR( ( xMessageBuffer ), ( xBytesRead ), ( pxHigherPriorityTaskWoken ) )
+#endif
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferReceiveMultiple( MessageBufferHandle_t xMessageBuffer, void * pvRxData, size_t xBufferLengthBytes, size_t * const pxMessageOffsets, size_t xMaxMessages, TickType_t xTicksToWait );
+ * size_t xMessageBufferReceiveMultipleFromISR( MessageBufferHandle_t xMessageBuffer, void * pvRxData, size_t xBufferLengthBytes, size_t * const pxMessageOffsets, size_t xMaxMessages, BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Receives as many whole messages as fit into pvRxData, up to xMaxMessages, in
+ * a single call.  On return pxMessageOffsets[ n ] holds the offset of message n
+ * within pvRxData and the entry after the last message holds the total number
+ * of bytes received, so pxMessageOffsets must have xMaxMessages + 1 entries.
+ * See xStreamBufferReceiveMultiple() in stream_buffer.h.
+ *
+ * configUSE_MESSAGE_BUFFER_BATCHING must be set to 1 in FreeRTOSConfig.h for
+ * these macros to be available.
+ *
+ * @return The number of messages received.
+ *
+ * \defgroup xMessageBufferReceiveMultiple xMessageBufferReceiveMultiple
+ * \ingroup MessageBufferManagement
+ */
+#if ( configUSE_MESSAGE_BUFFER_BATCHING == 1 )
+    #define xMessageBufferReceiveMultiple( xMessageBuffer, pvRxData, xBufferLengthBytes, pxMessageOffsets, xMaxMessages, xTicksToWait ) \
+    xStreamBufferReceiveMultiple( ( xMessageBuffer ), ( pvRxData ), ( xBufferLengthBytes ), ( pxMessageOffsets ), ( xMaxMessages ), ( xTicksToWait ) )
+
+    #define xMessageBufferReceiveMultipleFromISR( xMessageBuffer, pvRxData, xBufferLengthBytes, pxMessageOffsets, xMaxMessages, pxHigherPriorityTaskWoken ) \
+    xStreamBufferReceiveMultipleFromISR( ( xMessageBuffer ), ( pvRxData ), ( xBufferLengthBytes ), ( pxMessageOffsets ), ( xMaxMessages ), ( pxHigherPriorityTaskWoken ) )
+#endif
+
 /* *INDENT-OFF* */
 #if defined( __cplusplus )
     } /* extern "C" */
@@ -90,6 +90,26 @@
     #define configSTACK_ALLOCATION_FROM_SEPARATE_HEAP    0
 #endif
 
+#ifndef configUSE_HEAP_ACCOUNTING
+    #define configUSE_HEAP_ACCOUNTING    0
+#endif
+
+#ifndef configHEAP_HISTOGRAM_BUCKETS
+    #define configHEAP_HISTOGRAM_BUCKETS    12
+#endif
+
+#ifndef configUSE_HEAP_MAGAZINES
+    #define configUSE_HEAP_MAGAZINES    0
+#endif
+
+#ifndef configHEAP_MAGAZINE_CLASSES
+    #define configHEAP_MAGAZINE_CLASSES    4
+#endif
+
+#ifndef configHEAP_MAGAZINE_DEPTH
+    #define configHEAP_MAGAZINE_DEPTH    4
+#endif
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     extern "C" {
@@ -150,6 +170,21 @@ typedef struct xHeapStats
     size_t xNumberOfSuccessfulFrees;        /* The number of calls to vPortFree() that has successfully freed a block of memory. */
 } HeapStats_t;
 
+#if ( configUSE_HEAP_ACCOUNTING == 1 )
+
+/* Used to pass the size histogram of heap blocks out of
+ * vPortGetHeapHistogram().  Bucket 0 counts blocks smaller than
+ * xBucketLimitInBytes[ 0 ], each following bucket covers sizes up to twice the
+ * limit of the one before, and the last bucket counts every larger block.
+ * Block sizes include the block header and any alignment padding. */
+    typedef struct xHeapHistogram
+    {
+        size_t xBucketLimitInBytes[ configHEAP_HISTOGRAM_BUCKETS ]; /* The exclusive upper bound of the block sizes counted by each bucket.  The last bucket has no upper bound, so holds the maximum value of size_t. */
+        size_t xAllocatedBlocks[ configHEAP_HISTOGRAM_BUCKETS ];    /* The number of blocks in each bucket that are currently allocated. */
+        size_t xTotalAllocations[ configHEAP_HISTOGRAM_BUCKETS ];   /* The number of successful allocations in each bucket since the system booted. */
+    } HeapHistogram_t;
+#endif
+
 /*
  * Used to define multiple heap regions for use by heap_5.c.  This function
  * must be called before any calls to pvPortMalloc() - not creating a task,
@@ -169,6 +204,32 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEG
  */
 void vPortGetHeapStats( HeapStats_t * pxHeapStats );
 
+#if ( configUSE_HEAP_ACCOUNTING == 1 )
+
+/*
+ * Returns a HeapHistogram_t structure filled with the number of allocated
+ * blocks of each size.  Only implemented by heap_4.c.
+ */
+    void vPortGetHeapHistogram( HeapHistogram_t * pxHeapHistogram );
+
+/*
+ * Called by the kernel when a task that still owns heap blocks is deleted.
+ * Those blocks are no longer charged to any task, so freeing them later does
+ * not reference the deleted task.  Only implemented by heap_4.c.
+ */
+    void vPortHeapForgetOwner( void * pvOwner ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_HEAP_MAGAZINES == 1 )
+
+/*
+ * Called by the kernel when a task is deleted to return the blocks cached in
+ * the task's magazine, and the magazine itself, to the heap.  Only implemented
+ * by heap_4.c.
+ */
+    void vPortHeapReleaseMagazine( void * pvMagazine ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Map to the memory management routines required for the port.
  */
@@ -188,6 +249,53 @@ size_t xPortGetMinimumEverFreeHeapSize( void ) PRIVILEGED_FUNCTION;
     #define vPortFreeStack       vPortFree
 #endif
 
+#if ( configUSE_BLOCK_POOLS == 1 )
+
+/* Used to pass information about one size class out of vPortGetBlockPoolStats(). */
+    typedef struct xBLOCK_POOL_STATS
+    {
+        size_t xBlockSizeInBytes;              /* The size of every block in the class, after rounding up for alignment. */
+        size_t xNumberOfBlocks;                /* The number of blocks the class was given by configBLOCK_POOL_COUNTS. */
+        size_t xNumberOfFreeBlocks;            /* The number of blocks in the class that are not currently allocated. */
+        size_t xMinimumEverFreeBlocks;         /* The lowest value xNumberOfFreeBlocks has had since the system booted. */
+        size_t xNumberOfSuccessfulAllocations; /* The number of blocks handed out by the class. */
+        size_t xNumberOfSuccessfulFrees;       /* The number of blocks returned to the class. */
+    } BlockPoolStats_t;
+
+/*
+ * Fixed size block pools implemented by heap_pool.c, which is built alongside
+ * one of the heap_n.c files.  configBLOCK_POOL_SIZES lists the size classes in
+ * ascending order and configBLOCK_POOL_COUNTS the number of blocks in each.
+ * pvPortBlockPoolAlloc() returns a block from the smallest class that both
+ * fits xWantedSize and has a free block, or NULL if there is none, and
+ * vPortBlockPoolFree() returns a block to its class.  Both complete in a time
+ * bounded by the number of size classes, never walk a free list, and only mask
+ * interrupts for the few instructions needed to pop or push one block, so both
+ * can be called from tasks and from interrupts.
+ */
+    void * pvPortBlockPoolAlloc( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+    void vPortBlockPoolFree( void * pv ) PRIVILEGED_FUNCTION;
+    BaseType_t xPortIsBlockPoolAddress( const void * pv ) PRIVILEGED_FUNCTION;
+    UBaseType_t uxPortGetBlockPoolClassCount( void ) PRIVILEGED_FUNCTION;
+    void vPortGetBlockPoolStats( UBaseType_t uxSizeClass,
+                                 BlockPoolStats_t * pxBlockPoolStats ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * The kernel allocates its object control structures (TCBs, queues, timers
+ * and event groups) through pvPortMallocObject() and vPortFreeObject().  When
+ * configKERNEL_OBJECTS_FROM_BLOCK_POOLS is 1 they are taken from the block
+ * pools where a class is large enough and has a free block, and from the heap
+ * otherwise.
+ */
+#if ( configKERNEL_OBJECTS_FROM_BLOCK_POOLS == 1 )
+    void * pvPortMallocObject( size_t xSize ) PRIVILEGED_FUNCTION;
+    void vPortFreeObject( void * pv ) PRIVILEGED_FUNCTION;
+#else
+    #define pvPortMallocObject    pvPortMalloc
+    #define vPortFreeObject       vPortFree
+#endif
+
 #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
 
 /**
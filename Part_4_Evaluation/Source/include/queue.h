@@ -885,6 +885,362 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                           void * const pvBuffer,
                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueReserveSend(
+ *                               QueueHandle_t xQueue,
+ *                               void ** const ppvItem,
+ *                               TickType_t xTicksToWait
+ *                          );
+ * @endcode
+ *
+ * Reserve the slot at the back of a queue so the item can be written into the
+ * queue storage directly, rather than being built in a buffer and copied in
+ * by xQueueSend().  The item does not become visible to receivers until
+ * xQueueCommitSend() is called.
+ *
+ * Only one slot can be reserved in a queue at a time.  While it is reserved
+ * the queue appears full to every other sender, including xQueueOverwrite(),
+ * so the reservation should be committed promptly.
+ *
+ * configUSE_QUEUE_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.  It must not be used on a semaphore or a queue
+ * that is accessed by co-routines.
+ *
+ * @param xQueue The handle to the queue on which the slot is to be reserved.
+ *
+ * @param ppvItem Set to point to the reserved slot, which is uxItemSize bytes
+ * long, if pdPASS is returned.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for a slot to become free, should the queue be full or another
+ * slot already be reserved.
+ *
+ * @return pdPASS if a slot was reserved, otherwise errQUEUE_FULL.
+ *
+ * Example usage:
+ * @code{c}
+ * void vProducer( QueueHandle_t xQueue )
+ * {
+ * struct AMessage *pxMessage;
+ *
+ *  if( xQueueReserveSend( xQueue, ( void ** ) &pxMessage, portMAX_DELAY ) == pdPASS )
+ *  {
+ *      // Fill in the message where it will be stored.
+ *      pxMessage->ucMessageID = 0x12;
+ *
+ *      // Make the message available to receivers.
+ *      xQueueCommitSend( xQueue );
+ *  }
+ * }
+ * @endcode
+ * \defgroup xQueueReserveSend xQueueReserveSend
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    BaseType_t xQueueReserveSend( QueueHandle_t xQueue,
+                                  void ** const ppvItem,
+                                  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueCommitSend( QueueHandle_t xQueue );
+ * @endcode
+ *
+ * Post the item written into the slot obtained from xQueueReserveSend() to
+ * the back of the queue, unblocking a task that is waiting to receive from
+ * the queue (or notifying the queue set the queue is a member of) in the same
+ * way as xQueueSend().
+ *
+ * @param xQueue The handle to the queue passed to xQueueReserveSend().
+ *
+ * @return pdPASS if a reserved slot was committed, otherwise pdFAIL.
+ *
+ * \defgroup xQueueCommitSend xQueueCommitSend
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    BaseType_t xQueueCommitSend( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueAcquireReceive(
+ *                                  QueueHandle_t xQueue,
+ *                                  void ** const ppvItem,
+ *                                  TickType_t xTicksToWait
+ *                              );
+ * @endcode
+ *
+ * Remove the item at the front of a queue and obtain a pointer to it in the
+ * queue storage, rather than having it copied out by xQueueReceive().  The
+ * slot is not reused until xQueueReleaseReceive() is called.
+ *
+ * Only one item can be acquired from a queue at a time.  While it is held the
+ * queue appears empty to every other receiver, and the held slot is not
+ * available to senders, so the item should be released promptly.
+ *
+ * configUSE_QUEUE_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.  It must not be used on a semaphore or a queue
+ * that is accessed by co-routines.  It can be used on a queue selected from a
+ * queue set, in which case xTicksToWait should be zero.
+ *
+ * @param xQueue The handle to the queue from which the item is to be
+ * acquired.
+ *
+ * @param ppvItem Set to point to the acquired item, which is uxItemSize bytes
+ * long, if pdPASS is returned.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item to receive should the queue be empty.
+ *
+ * @return pdPASS if an item was acquired, otherwise errQUEUE_EMPTY.
+ *
+ * \defgroup xQueueAcquireReceive xQueueAcquireReceive
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    BaseType_t xQueueAcquireReceive( QueueHandle_t xQueue,
+                                     void ** const ppvItem,
+                                     TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueReleaseReceive( QueueHandle_t xQueue );
+ * @endcode
+ *
+ * Hand the slot holding the item obtained from xQueueAcquireReceive() back to
+ * the queue, unblocking a task that is waiting to send to the queue.  The
+ * item must not be accessed after it has been released.
+ *
+ * @param xQueue The handle to the queue passed to xQueueAcquireReceive().
+ *
+ * @return pdPASS if an acquired item was released, otherwise pdFAIL.
+ *
+ * \defgroup xQueueReleaseReceive xQueueReleaseReceive
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    BaseType_t xQueueReleaseReceive( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * size_t xQueueSendMultiple(
+ *                            QueueHandle_t xQueue,
+ *                            const void * pvItems,
+ *                            size_t xItemCount,
+ *                            TickType_t xTicksToWait
+ *                       );
+ * @endcode
+ *
+ * Post up to xItemCount items to the back of a queue in one operation.  The
+ * items are copied in, and the highest priority task waiting to receive from
+ * the queue (if any) is unblocked, from a single critical section - so the
+ * cost of the call is much lower than that of the same number of calls to
+ * xQueueSend().
+ *
+ * As many of the items as there is room for are sent.  The call only blocks
+ * if the queue is full, and returns as soon as at least one item has been
+ * sent, so the return value must be checked to see if the remaining items
+ * need sending again.
+ *
+ * At most one receiving task is unblocked per call, however many items are
+ * sent, so the function is best suited to queues that are read by a single
+ * task.  If the queue is a member of a queue set the set is still notified
+ * of every item.
+ *
+ * configUSE_QUEUE_BATCHING must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.  It must not be used on a semaphore or mutex.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItems A pointer to an array of xItemCount items, each the size
+ * the queue was created to hold.
+ *
+ * @param xItemCount The number of items in the pvItems array.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space to become available on the queue, should it be full.
+ *
+ * @return The number of items sent, which is zero if the queue remained full
+ * for xTicksToWait ticks.
+ *
+ * Example usage:
+ * @code{c}
+ * void vATask( void *pvParameters )
+ * {
+ * uint32_t ulSamples[ 8 ];
+ * size_t xSent = 0;
+ *
+ *  // ... Fill ulSamples.
+ *
+ *  // Post all eight samples, blocking while the queue is full.
+ *  while( xSent < 8 )
+ *  {
+ *      xSent += xQueueSendMultiple( xQueue, &( ulSamples[ xSent ] ), 8 - xSent, portMAX_DELAY );
+ *  }
+ * }
+ * @endcode
+ * \defgroup xQueueSendMultiple xQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_BATCHING == 1 )
+    size_t xQueueSendMultiple( QueueHandle_t xQueue,
+                               const void * pvItems,
+                               size_t xItemCount,
+                               TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * size_t xQueueSendMultipleFromISR(
+ *                                   QueueHandle_t xQueue,
+ *                                   const void * pvItems,
+ *                                   size_t xItemCount,
+ *                                   BaseType_t *pxHigherPriorityTaskWoken
+ *                              );
+ * @endcode
+ *
+ * A version of xQueueSendMultiple() that can be called from an interrupt
+ * service routine.  It never blocks - as many of the items as there is room
+ * for are sent and the rest are left with the caller.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItems A pointer to an array of xItemCount items.
+ *
+ * @param xItemCount The number of items in the pvItems array.
+ *
+ * @param pxHigherPriorityTaskWoken xQueueSendMultipleFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if sending the items caused a task to
+ * unblock, and the unblocked task has a priority higher than the currently
+ * running task.  If xQueueSendMultipleFromISR() sets this value to pdTRUE then
+ * a context switch should be requested before the interrupt is exited.
+ *
+ * @return The number of items sent.
+ *
+ * \defgroup xQueueSendMultipleFromISR xQueueSendMultipleFromISR
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_BATCHING == 1 )
+    size_t xQueueSendMultipleFromISR( QueueHandle_t xQueue,
+                                      const void * pvItems,
+                                      size_t xItemCount,
+                                      BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * size_t xQueueReceiveMultiple(
+ *                               QueueHandle_t xQueue,
+ *                               void * const pvBuffer,
+ *                               size_t xBufferItems,
+ *                               TickType_t xTicksToWait
+ *                          );
+ * @endcode
+ *
+ * Receive up to xBufferItems items from a queue in one operation.  The items
+ * are copied out, and the highest priority task waiting to send to the queue
+ * (if any) is unblocked, from a single critical section.
+ *
+ * The call only blocks if the queue is empty, and returns as soon as at least
+ * one item has been received.  Items are received in the same order as they
+ * would be by repeated calls to xQueueReceive().
+ *
+ * configUSE_QUEUE_BATCHING must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.  It must not be used on a semaphore or mutex.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to a buffer into which the received items will be
+ * copied.  It must have room for xBufferItems items.
+ *
+ * @param xBufferItems The maximum number of items to receive.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item to receive should the queue be empty.
+ *
+ * @return The number of items received, which is zero if the queue remained
+ * empty for xTicksToWait ticks.
+ *
+ * Example usage:
+ * @code{c}
+ * void vLoggingTask( void *pvParameters )
+ * {
+ * struct ALogEntry xEntries[ 16 ];
+ * size_t x, xReceived;
+ *
+ *  for( ;; )
+ *  {
+ *      // Wait for entries to arrive, then drain up to 16 of them at once.
+ *      xReceived = xQueueReceiveMultiple( xLogQueue, xEntries, 16, portMAX_DELAY );
+ *
+ *      for( x = 0; x < xReceived; x++ )
+ *      {
+ *          // Process xEntries[ x ].
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xQueueReceiveMultiple xQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_BATCHING == 1 )
+    size_t xQueueReceiveMultiple( QueueHandle_t xQueue,
+                                  void * const pvBuffer,
+                                  size_t xBufferItems,
+                                  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * size_t xQueueReceiveMultipleFromISR(
+ *                                      QueueHandle_t xQueue,
+ *                                      void * const pvBuffer,
+ *                                      size_t xBufferItems,
+ *                                      BaseType_t *pxHigherPriorityTaskWoken
+ *                                 );
+ * @endcode
+ *
+ * A version of xQueueReceiveMultiple() that can be called from an interrupt
+ * service routine.  It never blocks.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to a buffer with room for xBufferItems items.
+ *
+ * @param xBufferItems The maximum number of items to receive.
+ *
+ * @param pxHigherPriorityTaskWoken xQueueReceiveMultipleFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if receiving the items caused a task
+ * that was waiting to send to the queue to unblock, and the unblocked task has
+ * a priority higher than the currently running task.
+ *
+ * @return The number of items received.
+ *
+ * \defgroup xQueueReceiveMultipleFromISR xQueueReceiveMultipleFromISR
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_BATCHING == 1 )
+    size_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue,
+                                         void * const pvBuffer,
+                                         size_t xBufferItems,
+                                         BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * queue. h
  * @code{c}
@@ -1593,6 +1949,15 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
  * semaphore) operation must not be performed on a member of a queue set unless
  * a call to xQueueSelectFromSet() has first returned a handle to that set member.
  *
+ * Note 5:  If configUSE_QUEUE_SET_READY_LIST is set to 1 in FreeRTOSConfig.h
+ * then events are not stored in a queue.  Instead each member counts its own
+ * events and members with events are linked into a list held by the set, so a
+ * member is never held in the set twice, xQueueSelectFromSet() takes the member
+ * at the head of the list in constant time, and events cannot be lost because
+ * the set is full.  Note 3 does not apply, and uxEventQueueLength is ignored.
+ * Members with more than one event are selected in turn rather than strictly
+ * in the order the events occurred.
+ *
  * @param uxEventQueueLength Queue sets store events that occur on
  * the queues and semaphores contained in the set.  uxEventQueueLength specifies
  * the maximum number of events that can be queued at once.  To be absolutely
@@ -1654,7 +2019,9 @@ BaseType_t xQueueAddToSet( QueueSetMemberHandle_t xQueueOrSemaphore,
  *
  * @return If the queue or semaphore was successfully removed from the queue set
  * then pdPASS is returned.  If the queue was not in the queue set, or the
- * queue (or semaphore) was not empty, then pdFAIL is returned.
+ * queue (or semaphore) was not empty, then pdFAIL is returned.  If
+ * configUSE_QUEUE_SET_READY_LIST is 1, pdFAIL is also returned if the set still
+ * holds events for the queue (or semaphore).
  */
 BaseType_t xQueueRemoveFromSet( QueueSetMemberHandle_t xQueueOrSemaphore,
                                 QueueSetHandle_t xQueueSet ) PRIVILEGED_FUNCTION;
@@ -1705,6 +2072,9 @@ QueueSetMemberHandle_t xQueueSelectFromSetFromISR( QueueSetHandle_t xQueueSet )
 void vQueueWaitForMessageRestricted( QueueHandle_t xQueue,
                                      TickType_t xTicksToWait,
                                      const BaseType_t xWaitIndefinitely ) PRIVILEGED_FUNCTION;
+UBaseType_t uxQueueReceiveRestricted( QueueHandle_t xQueue,
+                                      void * const pvBuffer,
+                                      const UBaseType_t uxMaxItems ) PRIVILEGED_FUNCTION;
 BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
                                BaseType_t xNewQueue ) PRIVILEGED_FUNCTION;
 void vQueueSetQueueNumber( QueueHandle_t xQueue,
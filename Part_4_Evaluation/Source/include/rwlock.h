@@ -0,0 +1,293 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Reader-writer locks protect data that is read far more often than it is
+ * written.  Any number of tasks can hold the lock for reading at the same
+ * time, but a task that holds the lock for writing holds it alone.
+ *
+ * Writers are preferred:  once a writer is waiting for the lock no further
+ * readers can take it, and a writer that is waiting when the lock is released
+ * is handed the lock before any waiting reader can take it.  Waiting writers,
+ * and waiting readers, are served in priority order, and in the order they
+ * started to wait when their priorities are equal.
+ *
+ * A task that holds the lock for writing inherits the priority of higher
+ * priority tasks that are waiting for the lock, exactly as the holder of a
+ * mutex does.  Tasks that hold the lock for reading do not inherit priorities.
+ *
+ * When configUSE_TICKETS is 1, tasks of equal priority are chosen by lottery,
+ * so the writer also inherits the lottery tickets of a waiting task that holds
+ * more tickets than it does.  The writer gets its own tickets back when it
+ * gives the lock, or, when the waiting task times out, keeps only as many as
+ * the tasks at the head of the waiting lists hold.  As with priorities, a
+ * writer that holds other mutexes or locks keeps the inherited tickets until
+ * it has given them all back.
+ *
+ * ***NOTE***:  Reader-writer locks can only be used from tasks, not from
+ * interrupts, and are not recursive.  A task that holds the lock for reading
+ * must not try to take it for writing.
+ *
+ * configUSE_RWLOCKS must be set to 1 in FreeRTOSConfig.h, and rwlock.c must be
+ * built, for reader-writer locks to be available.
+ */
+
+#ifndef RWLOCK_H
+#define RWLOCK_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include rwlock.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * Type by which reader-writer locks are referenced.  For example, a call to
+ * xRWLockCreate() returns an RWLockHandle_t variable that can then be used as
+ * a parameter to xRWLockTakeRead(), xRWLockTakeWrite(), etc.
+ */
+struct RWLockDefinition;
+typedef struct RWLockDefinition * RWLockHandle_t;
+
+/**
+ * rwlock.h
+ *
+ * @code{c}
+ * RWLockHandle_t xRWLockCreate( void );
+ * @endcode
+ *
+ * Creates a new reader-writer lock using dynamically allocated memory.
+ *
+ * configSUPPORT_DYNAMIC_ALLOCATION must be set to 1 or left undefined in
+ * FreeRTOSConfig.h for xRWLockCreate() to be available.
+ *
+ * @return If the lock is created successfully then a handle to the created
+ * lock is returned.  If there was insufficient heap memory available to create
+ * the lock then NULL is returned.
+ *
+ * \defgroup xRWLockCreate xRWLockCreate
+ * \ingroup RWLockManagement
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    RWLockHandle_t xRWLockCreate( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * rwlock.h
+ *
+ * @code{c}
+ * RWLockHandle_t xRWLockCreateStatic( StaticRWLock_t *pxRWLockBuffer );
+ * @endcode
+ *
+ * Creates a new reader-writer lock using statically allocated memory.
+ *
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * xRWLockCreateStatic() to be available.
+ *
+ * @param pxRWLockBuffer Must point to a variable of type StaticRWLock_t,
+ * which will be used to hold the lock's data structure.
+ *
+ * @return If the lock is created successfully then a handle to the created
+ * lock is returned.  If pxRWLockBuffer is NULL then NULL is returned.
+ *
+ * \defgroup xRWLockCreateStatic xRWLockCreateStatic
+ * \ingroup RWLockManagement
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    RWLockHandle_t xRWLockCreateStatic( StaticRWLock_t * const pxRWLockBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * rwlock.h
+ *
+ * @code{c}
+ * void vRWLockDelete( RWLockHandle_t xRWLock );
+ * @endcode
+ *
+ * Deletes a reader-writer lock that was previously created using a call to
+ * xRWLockCreate() or xRWLockCreateStatic().  The lock must not be held, or
+ * waited for, when it is deleted.
+ *
+ * @param xRWLock The handle of the lock to be deleted.
+ *
+ * \defgroup vRWLockDelete vRWLockDelete
+ * \ingroup RWLockManagement
+ */
+void vRWLockDelete( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ *
+ * @code{c}
+ * BaseType_t xRWLockTakeRead( RWLockHandle_t xRWLock, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Takes a reader-writer lock for reading, blocking for up to xTicksToWait
+ * ticks while a writer holds the lock or is waiting for it.
+ *
+ * @param xRWLock The handle of the lock being taken.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should
+ * remain in the Blocked state to wait for the lock.
+ *
+ * @return pdPASS if the lock was taken for reading, otherwise pdFAIL.
+ *
+ * Example usage:
+ * @code{c}
+ * RWLockHandle_t xTableLock;
+ *
+ * uint32_t ulLookUp( size_t xIndex )
+ * {
+ * uint32_t ulValue = 0;
+ *
+ *  if( xRWLockTakeRead( xTableLock, pdMS_TO_TICKS( 10 ) ) == pdPASS )
+ *  {
+ *      // Any number of tasks can be in here at the same time.
+ *      ulValue = ulTable[ xIndex ];
+ *      xRWLockGiveRead( xTableLock );
+ *  }
+ *
+ *  return ulValue;
+ * }
+ * @endcode
+ * \defgroup xRWLockTakeRead xRWLockTakeRead
+ * \ingroup RWLockManagement
+ */
+BaseType_t xRWLockTakeRead( RWLockHandle_t xRWLock,
+                            TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ *
+ * @code{c}
+ * BaseType_t xRWLockGiveRead( RWLockHandle_t xRWLock );
+ * @endcode
+ *
+ * Releases a reader-writer lock that the calling task took for reading.  If
+ * it was the last reader, and a writer is waiting, the lock is handed to the
+ * writer.
+ *
+ * @param xRWLock The handle of the lock being released.
+ *
+ * @return pdPASS if the lock was released, or pdFAIL if no task held the lock
+ * for reading.
+ *
+ * \defgroup xRWLockGiveRead xRWLockGiveRead
+ * \ingroup RWLockManagement
+ */
+BaseType_t xRWLockGiveRead( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ *
+ * @code{c}
+ * BaseType_t xRWLockTakeWrite( RWLockHandle_t xRWLock, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Takes a reader-writer lock for writing, blocking for up to xTicksToWait
+ * ticks while any other task holds the lock.  While it waits the calling task
+ * stops further readers from taking the lock.
+ *
+ * @param xRWLock The handle of the lock being taken.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should
+ * remain in the Blocked state to wait for the lock.
+ *
+ * @return pdPASS if the lock was taken for writing, otherwise pdFAIL.
+ *
+ * \defgroup xRWLockTakeWrite xRWLockTakeWrite
+ * \ingroup RWLockManagement
+ */
+BaseType_t xRWLockTakeWrite( RWLockHandle_t xRWLock,
+                             TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ *
+ * @code{c}
+ * BaseType_t xRWLockGiveWrite( RWLockHandle_t xRWLock );
+ * @endcode
+ *
+ * Releases a reader-writer lock that the calling task took for writing.  The
+ * lock is handed to the highest priority waiting writer if there is one,
+ * otherwise all waiting readers are unblocked.
+ *
+ * @param xRWLock The handle of the lock being released.
+ *
+ * @return pdPASS if the lock was released, or pdFAIL if the calling task did
+ * not hold the lock for writing.
+ *
+ * \defgroup xRWLockGiveWrite xRWLockGiveWrite
+ * \ingroup RWLockManagement
+ */
+BaseType_t xRWLockGiveWrite( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ *
+ * @code{c}
+ * UBaseType_t uxRWLockGetReaderCount( RWLockHandle_t xRWLock );
+ * @endcode
+ *
+ * @param xRWLock The handle of the lock being queried.
+ *
+ * @return The number of tasks that hold the lock for reading.
+ *
+ * \defgroup uxRWLockGetReaderCount uxRWLockGetReaderCount
+ * \ingroup RWLockManagement
+ */
+UBaseType_t uxRWLockGetReaderCount( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ *
+ * @code{c}
+ * TaskHandle_t xRWLockGetWriter( RWLockHandle_t xRWLock );
+ * @endcode
+ *
+ * @param xRWLock The handle of the lock being queried.
+ *
+ * @return The handle of the task that holds the lock for writing, or NULL if
+ * no task holds the lock for writing.
+ *
+ * \defgroup xRWLockGetWriter xRWLockGetWriter
+ * \ingroup RWLockManagement
+ */
+TaskHandle_t xRWLockGetWriter( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( RWLOCK_H ) */
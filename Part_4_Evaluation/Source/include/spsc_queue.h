@@ -0,0 +1,304 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * SPSC (single producer, single consumer) queues pass fixed size items, by
+ * copy, from one interrupt or task to one task.  They are intended for the
+ * common case of an interrupt handing data to the task that processes it.
+ *
+ * ***NOTE***:  Like stream buffers, an SPSC queue assumes there is only one
+ * writer (the producer) and only one reader (the consumer).  Because of that
+ * the producer and consumer each only update their own index into the queue,
+ * so sending and receiving an item neither masks interrupts nor enters a
+ * critical section.  The consumer is woken using a direct to task notification
+ * at index configSPSC_QUEUE_NOTIFICATION_INDEX, which is only sent when the
+ * queue goes from empty to not empty - so that notification index must not be
+ * used for anything else by the consuming task.  It defaults to the last index
+ * in the notification array.  If configTASK_NOTIFICATION_ARRAY_ENTRIES is
+ * greater than 1 it must not be set to 0, which is the index used by
+ * xTaskNotifyGive(), ulTaskNotifyTake() and stream and message buffers.
+ *
+ * The producer cannot block - if the queue is full the send fails.
+ *
+ * configUSE_SPSC_QUEUES must be set to 1 in FreeRTOSConfig.h, and spsc_queue.c
+ * must be built, for SPSC queues to be available.
+ */
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include spsc_queue.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * Type by which SPSC queues are referenced.  For example, a call to
+ * xSpscQueueCreate() returns an SpscQueueHandle_t variable that can then be
+ * used as a parameter to xSpscQueueSendFromISR(), xSpscQueueReceive(), etc.
+ */
+struct SpscQueueDefinition;
+typedef struct SpscQueueDefinition * SpscQueueHandle_t;
+
+/**
+ * The number of bytes of storage needed by an SPSC queue that can hold
+ * uxQueueLength items of uxItemSize bytes each.  One slot more than the queue
+ * length is needed.  Use this to size the buffer passed to
+ * xSpscQueueCreateStatic().
+ */
+#define spscQUEUE_STORAGE_SIZE( uxQueueLength, uxItemSize )    ( ( ( size_t ) ( uxQueueLength ) + ( size_t ) 1 ) * ( size_t ) ( uxItemSize ) )
+
+/**
+ * spsc_queue.h
+ *
+ * @code{c}
+ * SpscQueueHandle_t xSpscQueueCreate( UBaseType_t uxQueueLength, UBaseType_t uxItemSize );
+ * @endcode
+ *
+ * Creates a new SPSC queue using dynamically allocated memory.
+ *
+ * configSUPPORT_DYNAMIC_ALLOCATION must be set to 1 or left undefined in
+ * FreeRTOSConfig.h for xSpscQueueCreate() to be available.
+ *
+ * @param uxQueueLength The maximum number of items the queue can hold at any
+ * one time.
+ *
+ * @param uxItemSize The size, in bytes, of each item in the queue.
+ *
+ * @return If the queue is created successfully then a handle to the created
+ * queue is returned.  If there was insufficient heap memory available to
+ * create the queue then NULL is returned.
+ *
+ * \defgroup xSpscQueueCreate xSpscQueueCreate
+ * \ingroup SpscQueueManagement
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    SpscQueueHandle_t xSpscQueueCreate( UBaseType_t uxQueueLength,
+                                        UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * spsc_queue.h
+ *
+ * @code{c}
+ * SpscQueueHandle_t xSpscQueueCreateStatic( UBaseType_t uxQueueLength,
+ *                                           UBaseType_t uxItemSize,
+ *                                           uint8_t *pucQueueStorageArea,
+ *                                           StaticSpscQueue_t *pxStaticSpscQueue );
+ * @endcode
+ *
+ * Creates a new SPSC queue using statically allocated memory.
+ *
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * xSpscQueueCreateStatic() to be available.
+ *
+ * @param uxQueueLength The maximum number of items the queue can hold at any
+ * one time.
+ *
+ * @param uxItemSize The size, in bytes, of each item in the queue.
+ *
+ * @param pucQueueStorageArea Must point to a uint8_t array that is at least
+ * spscQUEUE_STORAGE_SIZE( uxQueueLength, uxItemSize ) bytes big.
+ *
+ * @param pxStaticSpscQueue Must point to a variable of type StaticSpscQueue_t,
+ * which will be used to hold the queue's data structure.
+ *
+ * @return If the queue is created successfully then a handle to the created
+ * queue is returned.  If either pucQueueStorageArea or pxStaticSpscQueue are
+ * NULL then NULL is returned.
+ *
+ * Example use:
+ * @code{c}
+ * #define QUEUE_LENGTH 32
+ *
+ * static uint8_t ucStorage[ spscQUEUE_STORAGE_SIZE( QUEUE_LENGTH, sizeof( uint16_t ) ) ];
+ * static StaticSpscQueue_t xQueueStruct;
+ *
+ * void MyFunction( void )
+ * {
+ * SpscQueueHandle_t xQueue;
+ *
+ *  xQueue = xSpscQueueCreateStatic( QUEUE_LENGTH, sizeof( uint16_t ), ucStorage, &xQueueStruct );
+ * }
+ * @endcode
+ * \defgroup xSpscQueueCreateStatic xSpscQueueCreateStatic
+ * \ingroup SpscQueueManagement
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    SpscQueueHandle_t xSpscQueueCreateStatic( UBaseType_t uxQueueLength,
+                                              UBaseType_t uxItemSize,
+                                              uint8_t * const pucQueueStorageArea,
+                                              StaticSpscQueue_t * const pxStaticSpscQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * spsc_queue.h
+ *
+ * @code{c}
+ * void vSpscQueueDelete( SpscQueueHandle_t xQueue );
+ * @endcode
+ *
+ * Deletes an SPSC queue.  Neither the producer nor the consumer may be using
+ * the queue when it is deleted.
+ *
+ * @param xQueue The handle of the queue to be deleted.
+ *
+ * \defgroup vSpscQueueDelete vSpscQueueDelete
+ * \ingroup SpscQueueManagement
+ */
+void vSpscQueueDelete( SpscQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * spsc_queue.h
+ *
+ * @code{c}
+ * BaseType_t xSpscQueueSend( SpscQueueHandle_t xQueue, const void *pvItemToQueue );
+ * @endcode
+ *
+ * Sends an item to an SPSC queue from the producing task.  Use
+ * xSpscQueueSendFromISR() when the producer is an interrupt.
+ *
+ * @param xQueue The handle of the queue to which the item is to be sent.
+ *
+ * @param pvItemToQueue A pointer to the item that is to be placed on the
+ * queue.  uxItemSize bytes are copied from pvItemToQueue into the queue.
+ *
+ * @return pdPASS if the item was sent, or errQUEUE_FULL if the queue was full.
+ *
+ * \defgroup xSpscQueueSend xSpscQueueSend
+ * \ingroup SpscQueueManagement
+ */
+BaseType_t xSpscQueueSend( SpscQueueHandle_t xQueue,
+                           const void * pvItemToQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * spsc_queue.h
+ *
+ * @code{c}
+ * BaseType_t xSpscQueueSendFromISR( SpscQueueHandle_t xQueue,
+ *                                   const void *pvItemToQueue,
+ *                                   BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Sends an item to an SPSC queue from the producing interrupt service
+ * routine.
+ *
+ * @param xQueue The handle of the queue to which the item is to be sent.
+ *
+ * @param pvItemToQueue A pointer to the item that is to be placed on the
+ * queue.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if sending the item caused
+ * the consuming task to leave the Blocked state, and the consuming task has a
+ * priority above the currently executing task.  If pdTRUE is set then a
+ * context switch should be requested before the interrupt is exited.
+ *
+ * @return pdPASS if the item was sent, or errQUEUE_FULL if the queue was full.
+ *
+ * Example use:
+ * @code{c}
+ * // An interrupt that passes each received character to a task.
+ * void vAnInterruptServiceRoutine( void )
+ * {
+ * char cRxedChar;
+ * BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ *
+ *  cRxedChar = UART_RX_REGISTER;
+ *  xSpscQueueSendFromISR( xRxQueue, &cRxedChar, &xHigherPriorityTaskWoken );
+ *
+ *  portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ * @endcode
+ * \defgroup xSpscQueueSendFromISR xSpscQueueSendFromISR
+ * \ingroup SpscQueueManagement
+ */
+BaseType_t xSpscQueueSendFromISR( SpscQueueHandle_t xQueue,
+                                  const void * pvItemToQueue,
+                                  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * spsc_queue.h
+ *
+ * @code{c}
+ * BaseType_t xSpscQueueReceive( SpscQueueHandle_t xQueue,
+ *                               void *pvBuffer,
+ *                               TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Receives an item from an SPSC queue.  Must only be called by the consuming
+ * task, which is recorded the first time this function is called.
+ *
+ * @param xQueue The handle of the queue from which the item is to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received item will be
+ * copied.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in
+ * the Blocked state to wait for an item, should the queue be empty.
+ *
+ * @return pdPASS if an item was received, otherwise errQUEUE_EMPTY.
+ *
+ * \defgroup xSpscQueueReceive xSpscQueueReceive
+ * \ingroup SpscQueueManagement
+ */
+BaseType_t xSpscQueueReceive( SpscQueueHandle_t xQueue,
+                              void * const pvBuffer,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * spsc_queue.h
+ *
+ * @code{c}
+ * UBaseType_t uxSpscQueueMessagesWaiting( const SpscQueueHandle_t xQueue );
+ * @endcode
+ *
+ * Returns the number of items in an SPSC queue.  As the producer and consumer
+ * do not lock the queue the value is only a snapshot.
+ *
+ * @param xQueue The handle of the queue being queried.
+ *
+ * @return The number of items in the queue.
+ *
+ * \defgroup uxSpscQueueMessagesWaiting uxSpscQueueMessagesWaiting
+ * \ingroup SpscQueueManagement
+ */
+UBaseType_t uxSpscQueueMessagesWaiting( const SpscQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( SPSC_QUEUE_H ) */
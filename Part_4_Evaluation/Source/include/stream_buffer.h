@@ -78,6 +78,21 @@ typedef void (* StreamBufferCallbackFunction_t)( StreamBufferHandle_t xStreamBuf
                                                  BaseType_t xIsInsideISR,
                                                  BaseType_t * const pxHigherPriorityTaskWoken );
 
+/**
+ * Type used to describe the region of a stream buffer's storage area that can
+ * be written or read in place.  The region may wrap around the end of the
+ * storage area, so it is described as up to two contiguous spans.  pucSecond
+ * is NULL and xSecondLength is 0 if the region does not wrap.  See
+ * xStreamBufferSendReserve() and xStreamBufferReceiveAcquire().
+ */
+typedef struct StreamBufferSpans
+{
+    uint8_t * pucFirst;    /*< Start of the first span. */
+    size_t xFirstLength;   /*< Number of bytes in the first span. */
+    uint8_t * pucSecond;   /*< Start of the second span, which is always the start of the storage area, or NULL. */
+    size_t xSecondLength;  /*< Number of bytes in the second span. */
+} StreamBufferSpans_t;
+
 /**
  * stream_buffer.h
  *
@@ -879,6 +894,399 @@ BaseType_t xStreamBufferSendCompletedFromISR( StreamBufferHandle_t xStreamBuffer
 BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuffer,
                                                  BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+ *                                  StreamBufferSpans_t * const pxSpans,
+ *                                  size_t xMaxBytes,
+ *                                  TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Obtains direct access to free space in a stream buffer so data can be
+ * written in place, rather than being copied in by xStreamBufferSend().  The
+ * free space may wrap around the end of the buffer's storage area, so it is
+ * returned as up to two spans in *pxSpans.  The data is not visible to the
+ * reader until xStreamBufferSendCommit() is called.
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferSendReserve() to be available.
+ *
+ * A stream buffer may return fewer than xMaxBytes if less space is free.  A
+ * message buffer either returns space for the whole xMaxBytes byte message or
+ * returns 0.
+ *
+ * Only one reservation can be outstanding at a time, and it must be committed
+ * before any other send function is called on the same buffer.  As with
+ * xStreamBufferSend(), there must be only one writer.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to write to.
+ *
+ * @param pxSpans Set to the spans that can be written if the function returns
+ * a non-zero value.
+ *
+ * @param xMaxBytes The maximum number of bytes to reserve.  Must be greater
+ * than 0.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for enough space to become available, as per
+ * xStreamBufferSend().
+ *
+ * @return The total length of the spans, or 0 if no space could be reserved.
+ *
+ * Example use:
+ * @code{c}
+ * void vAFunction( StreamBufferHandle_t xStreamBuffer )
+ * {
+ * StreamBufferSpans_t xSpans;
+ * size_t xReserved;
+ *
+ *  xReserved = xStreamBufferSendReserve( xStreamBuffer, &xSpans, 64, pdMS_TO_TICKS( 100 ) );
+ *
+ *  if( xReserved > 0 )
+ *  {
+ *      // Fill the spans directly, for example from a peripheral.
+ *      vFillFromPeripheral( xSpans.pucFirst, xSpans.xFirstLength );
+ *      vFillFromPeripheral( xSpans.pucSecond, xSpans.xSecondLength );
+ *
+ *      // Make the data available to the reader.
+ *      xStreamBufferSendCommit( xStreamBuffer, xReserved );
+ *  }
+ * }
+ * @endcode
+ * \defgroup xStreamBufferSendReserve xStreamBufferSendReserve
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+    size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+                                     StreamBufferSpans_t * const pxSpans,
+                                     size_t xMaxBytes,
+                                     TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                         StreamBufferSpans_t * const pxSpans,
+ *                                         size_t xMaxBytes );
+ * @endcode
+ *
+ * A version of xStreamBufferSendReserve() that can be called from an
+ * interrupt service routine.  It never blocks.
+ *
+ * \defgroup xStreamBufferSendReserveFromISR xStreamBufferSendReserveFromISR
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+    size_t xStreamBufferSendReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+                                            StreamBufferSpans_t * const pxSpans,
+                                            size_t xMaxBytes ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+ *                                 size_t xBytesWritten );
+ * @endcode
+ *
+ * Makes data written into the spans returned by xStreamBufferSendReserve()
+ * visible to the reader by advancing the buffer's head.  If the number of bytes
+ * in the buffer then reaches the trigger level, a task blocked waiting to
+ * receive is unblocked, exactly as by xStreamBufferSend().
+ *
+ * For a message buffer the message length is written in front of the message
+ * at this point, so xBytesWritten becomes the length of the message.
+ *
+ * @param xStreamBuffer The handle of the stream buffer that was written to.
+ *
+ * @param xBytesWritten The number of bytes written, starting at the beginning
+ * of the first span.  Must not exceed the value returned by
+ * xStreamBufferSendReserve().  Committing 0 bytes abandons the reservation.
+ *
+ * @return xBytesWritten.
+ *
+ * \defgroup xStreamBufferSendCommit xStreamBufferSendCommit
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+    size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xBytesWritten ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                        size_t xBytesWritten,
+ *                                        BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xStreamBufferSendCommit() that can be called from an interrupt
+ * service routine.  *pxHigherPriorityTaskWoken is set to pdTRUE if committing
+ * the data unblocked a task with a priority above that of the running task, as
+ * per xStreamBufferSendFromISR().
+ *
+ * \defgroup xStreamBufferSendCommitFromISR xStreamBufferSendCommitFromISR
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+    size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                           size_t xBytesWritten,
+                                           BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceiveAcquire( StreamBufferHandle_t xStreamBuffer,
+ *                                     StreamBufferSpans_t * const pxSpans,
+ *                                     size_t xMaxBytes,
+ *                                     TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Obtains direct access to the data held in a stream buffer so it can be read
+ * in place, rather than being copied out by xStreamBufferReceive().  The data
+ * may wrap around the end of the buffer's storage area, so it is returned as
+ * up to two spans in *pxSpans.  The data remains in the buffer until
+ * xStreamBufferReceiveRelease() is called.
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferReceiveAcquire() to be available.
+ *
+ * A stream buffer returns up to xMaxBytes of the available data.  A message
+ * buffer returns the whole of the next message, or 0 if the message is longer
+ * than xMaxBytes, in which case the message is left in the buffer.
+ *
+ * Only one acquisition can be outstanding at a time, and it must be released
+ * before any other receive function is called on the same buffer.  As with
+ * xStreamBufferReceive(), there must be only one reader.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to read from.
+ *
+ * @param pxSpans Set to the spans holding the data if the function returns a
+ * non-zero value.
+ *
+ * @param xMaxBytes The maximum number of bytes to acquire.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for data to become available, as per
+ * xStreamBufferReceive().
+ *
+ * @return The total length of the spans, or 0 if no data was acquired.
+ *
+ * Example use:
+ * @code{c}
+ * void vAFunction( StreamBufferHandle_t xStreamBuffer )
+ * {
+ * StreamBufferSpans_t xSpans;
+ * size_t xAcquired;
+ *
+ *  xAcquired = xStreamBufferReceiveAcquire( xStreamBuffer, &xSpans, 64, pdMS_TO_TICKS( 100 ) );
+ *
+ *  if( xAcquired > 0 )
+ *  {
+ *      // Process the data in place.
+ *      vProcess( xSpans.pucFirst, xSpans.xFirstLength );
+ *      vProcess( xSpans.pucSecond, xSpans.xSecondLength );
+ *
+ *      // Free the space for the writer.
+ *      xStreamBufferReceiveRelease( xStreamBuffer, xAcquired );
+ *  }
+ * }
+ * @endcode
+ * \defgroup xStreamBufferReceiveAcquire xStreamBufferReceiveAcquire
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+    size_t xStreamBufferReceiveAcquire( StreamBufferHandle_t xStreamBuffer,
+                                        StreamBufferSpans_t * const pxSpans,
+                                        size_t xMaxBytes,
+                                        TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceiveAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                            StreamBufferSpans_t * const pxSpans,
+ *                                            size_t xMaxBytes );
+ * @endcode
+ *
+ * A version of xStreamBufferReceiveAcquire() that can be called from an
+ * interrupt service routine.  It never blocks.
+ *
+ * \defgroup xStreamBufferReceiveAcquireFromISR xStreamBufferReceiveAcquireFromISR
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+    size_t xStreamBufferReceiveAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+                                               StreamBufferSpans_t * const pxSpans,
+                                               size_t xMaxBytes ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceiveRelease( StreamBufferHandle_t xStreamBuffer,
+ *                                     size_t xBytesRead );
+ * @endcode
+ *
+ * Removes data acquired by xStreamBufferReceiveAcquire() from the buffer by
+ * advancing its tail, and unblocks a task waiting for space to become
+ * available, exactly as by xStreamBufferReceive().
+ *
+ * @param xStreamBuffer The handle of the stream buffer that was read from.
+ *
+ * @param xBytesRead The number of bytes to remove, starting at the beginning
+ * of the first span.  For a stream buffer this must not exceed the value
+ * returned by xStreamBufferReceiveAcquire().  For a message buffer it must be
+ * exactly that value, as messages are removed whole.  Releasing 0 bytes leaves
+ * all the acquired data in the buffer.
+ *
+ * @return xBytesRead.
+ *
+ * \defgroup xStreamBufferReceiveRelease xStreamBufferReceiveRelease
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+    size_t xStreamBufferReceiveRelease( StreamBufferHandle_t xStreamBuffer,
+                                        size_t xBytesRead ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceiveReleaseFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                            size_t xBytesRead,
+ *                                            BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xStreamBufferReceiveRelease() that can be called from an
+ * interrupt service routine.  *pxHigherPriorityTaskWoken is set to pdTRUE if
+ * releasing the data unblocked a task with a priority above that of the running
+ * task, as per xStreamBufferReceiveFromISR().
+ *
+ * \defgroup xStreamBufferReceiveReleaseFromISR xStreamBufferReceiveReleaseFromISR
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+    size_t xStreamBufferReceiveReleaseFromISR( StreamBufferHandle_t xStreamBuffer,
+                                               size_t xBytesRead,
+                                               BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceiveMultiple( StreamBufferHandle_t xStreamBuffer,
+ *                                      void * pvRxData,
+ *                                      size_t xBufferLengthBytes,
+ *                                      size_t * const pxMessageOffsets,
+ *                                      size_t xMaxMessages,
+ *                                      TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Receives as many whole messages from a message buffer as fit into pvRxData,
+ * up to xMaxMessages, in a single call.  The messages are copied back to back
+ * into pvRxData, and the buffer's tail is moved and a blocked writer is
+ * notified once for the whole batch, rather than once per message as happens
+ * when xMessageBufferReceive() is called repeatedly.
+ *
+ * configUSE_MESSAGE_BUFFER_BATCHING must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferReceiveMultiple() to be available.  It must only be used with
+ * message buffers - use xMessageBufferReceiveMultiple().
+ *
+ * Messages are received in order, so receiving stops at the first message that
+ * does not fit in the space left in pvRxData.  If the first message does not
+ * fit then no messages are received and it is left in the buffer.
+ *
+ * @param xStreamBuffer The handle of the message buffer to receive from.
+ *
+ * @param pvRxData A pointer to the buffer into which the messages are copied.
+ *
+ * @param xBufferLengthBytes The length of the buffer pointed to by pvRxData.
+ *
+ * @param pxMessageOffsets A pointer to an array of at least xMaxMessages + 1
+ * entries.  On return entry n holds the offset within pvRxData of message n,
+ * and the entry after the last message received holds the total number of
+ * bytes copied, so the length of message n is
+ * pxMessageOffsets[ n + 1 ] - pxMessageOffsets[ n ].
+ *
+ * @param xMaxMessages The maximum number of messages to receive.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for a message to become available, as per
+ * xMessageBufferReceive().  The task does not wait for more than one message.
+ *
+ * @return The number of messages received.
+ *
+ * Example use:
+ * @code{c}
+ * void vAFunction( MessageBufferHandle_t xMessageBuffer )
+ * {
+ * uint8_t ucRxData[ 256 ];
+ * size_t xOffsets[ 17 ], xMessages, x;
+ *
+ *  xMessages = xMessageBufferReceiveMultiple( xMessageBuffer, ucRxData, sizeof( ucRxData ), xOffsets, 16, pdMS_TO_TICKS( 20 ) );
+ *
+ *  for( x = 0; x < xMessages; x++ )
+ *  {
+ *      vProcessMessage( &( ucRxData[ xOffsets[ x ] ] ), xOffsets[ x + 1 ] - xOffsets[ x ] );
+ *  }
+ * }
+ * @endcode
+ * \defgroup xStreamBufferReceiveMultiple xStreamBufferReceiveMultiple
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_MESSAGE_BUFFER_BATCHING == 1 )
+    size_t xStreamBufferReceiveMultiple( StreamBufferHandle_t xStreamBuffer,
+                                         void * pvRxData,
+                                         size_t xBufferLengthBytes,
+                                         size_t * const pxMessageOffsets,
+                                         size_t xMaxMessages,
+                                         TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceiveMultipleFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                             void * pvRxData,
+ *                                             size_t xBufferLengthBytes,
+ *                                             size_t * const pxMessageOffsets,
+ *                                             size_t xMaxMessages,
+ *                                             BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xStreamBufferReceiveMultiple() that can be called from an
+ * interrupt service routine.  *pxHigherPriorityTaskWoken is set to pdTRUE if
+ * receiving the messages unblocked a task with a priority above that of the
+ * running task, as per xStreamBufferReceiveFromISR().
+ *
+ * \defgroup xStreamBufferReceiveMultipleFromISR xStreamBufferReceiveMultipleFromISR
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_MESSAGE_BUFFER_BATCHING == 1 )
+    size_t xStreamBufferReceiveMultipleFromISR( StreamBufferHandle_t xStreamBuffer,
+                                                void * pvRxData,
+                                                size_t xBufferLengthBytes,
+                                                size_t * const pxMessageOffsets,
+                                                size_t xMaxMessages,
+                                                BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
 /* Functions below here are not part of the public API. */
 StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes,
                                                  size_t xTriggerLevelBytes,
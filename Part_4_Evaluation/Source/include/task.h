@@ -149,6 +149,52 @@ typedef struct xTASK_PARAMETERS
     #endif
 } TaskParameters_t;
 
+/* One entry of the application's static task table, which lists the tasks
+ * vTaskStartScheduler() creates from statically allocated memory when
+ * configUSE_STATIC_TASK_TABLE is 1.  Tables are normally generated with the
+ * macros in task_table.h rather than written out by hand. */
+typedef struct xTASK_TABLE_ENTRY
+{
+    TaskFunction_t pxTaskCode;
+    const char * pcName; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    uint32_t ulStackDepth;
+    void * pvParameters;
+    UBaseType_t uxPriority;
+    UBaseType_t uxTicketNumber;   /* The lottery tickets held by the task. */
+    StackType_t * puxStackBuffer; /* Must hold at least ulStackDepth words. */
+    StaticTask_t * pxTaskBuffer;
+    TaskHandle_t * pxCreatedTask; /* Set to the task's handle when the task is created.  May be NULL. */
+} TaskTableEntry_t;
+
+#if ( configUSE_HEAP_ACCOUNTING == 1 )
+
+/* Used with vTaskGetHeapUsage(), and within TaskStatus_t, to report the heap
+ * memory charged to a task.  A block is charged to the task that allocated it,
+ * so a task that creates another task is charged for the new task's TCB and
+ * stack.  Sizes include the heap's block header and alignment padding. */
+    typedef struct xTASK_HEAP_USAGE
+    {
+        size_t xCurrentBytes;      /* The number of bytes currently allocated by the task and not yet freed. */
+        size_t xPeakBytes;         /* The highest value xCurrentBytes has had since the task was created. */
+        size_t xQuotaBytes;        /* The most xCurrentBytes may grow to, as set by vTaskSetHeapQuota(), or 0 if there is no limit. */
+        size_t xFailedAllocations; /* The number of allocations that were refused because the quota would have been exceeded. */
+    } TaskHeapUsage_t;
+#endif
+
+#if ( configUSE_STACK_PROFILING == 1 )
+
+/* Used with uxTaskGetStackProfile() to report how much stack the tasks that
+ * have existed since the scheduler started needed.  Tasks are grouped by name,
+ * so a task that is deleted and created again has a single entry. */
+    typedef struct xTASK_STACK_PROFILE
+    {
+        char pcTaskName[ configMAX_TASK_NAME_LEN ]; /* The name of the task, or tasks, the entry describes. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+        configSTACK_DEPTH_TYPE uxStackDepth;        /* The largest stack, in words, given to a task of this name. */
+        configSTACK_DEPTH_TYPE uxPeakUsage;         /* The most stack, in words, a task of this name has used. */
+        configSTACK_DEPTH_TYPE uxRecommendedDepth;  /* uxPeakUsage plus configSTACK_PROFILE_MARGIN_PERCENT percent. */
+    } TaskStackProfile_t;
+#endif
+
 /* Used with the uxTaskGetSystemState() function to return the state of each task
  * in the system. */
 typedef struct xTASK_STATUS
@@ -166,6 +212,9 @@ typedef struct xTASK_STATUS
         StackType_t * pxEndOfStack;               /* Points to the end address of the task's stack area. */
     #endif
     configSTACK_DEPTH_TYPE usStackHighWaterMark;  /* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
+    #if ( configUSE_HEAP_ACCOUNTING == 1 )
+        TaskHeapUsage_t xHeapUsage;               /* The heap memory charged to the task.  Only present if configUSE_HEAP_ACCOUNTING is defined as 1 in FreeRTOSConfig.h. */
+    #endif
 } TaskStatus_t;
 
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
@@ -371,7 +420,8 @@ typedef enum
  *                               void *pvParameters,
  *                               UBaseType_t uxPriority,
  *                               StackType_t *puxStackBuffer,
- *                               StaticTask_t *pxTaskBuffer );
+ *                               StaticTask_t *pxTaskBuffer,
+ *                               int pxTicketNumber );
  * @endcode
  *
  * Create a new task and add it to the list of tasks that are ready to run.
@@ -411,6 +461,9 @@ typedef enum
  * then be used to hold the task's data structures, removing the need for the
  * memory to be allocated dynamically.
  *
+ * @param pxTicketNumber The number of lottery tickets the task holds, as for
+ * xTaskCreate().
+ *
  * @return If neither puxStackBuffer nor pxTaskBuffer are NULL, then the task
  * will be created and a handle to the created task is returned.  If either
  * puxStackBuffer or pxTaskBuffer are NULL then the task will not be created and
@@ -459,7 +512,8 @@ typedef enum
  *                    ( void * ) 1,    // Parameter passed into the task.
  *                    tskIDLE_PRIORITY,// Priority at which the task is created.
  *                    xStack,          // Array to use as the task's stack.
- *                    &xTaskBuffer );  // Variable to hold the task's data structure.
+ *                    &xTaskBuffer,    // Variable to hold the task's data structure.
+ *                    10 );            // Lottery tickets held by the task.
  *
  *      // puxStackBuffer and pxTaskBuffer were not NULL, so the task will have
  *      // been created, and xHandle will be the task's handle.  Use the handle
@@ -477,7 +531,8 @@ typedef enum
                                     void * const pvParameters,
                                     UBaseType_t uxPriority,
                                     StackType_t * const puxStackBuffer,
-                                    StaticTask_t * const pxTaskBuffer ) PRIVILEGED_FUNCTION;
+                                    StaticTask_t * const pxTaskBuffer,
+                                    int pxTicketNumber ) PRIVILEGED_FUNCTION;
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
 /**
@@ -905,6 +960,172 @@ BaseType_t xTaskDelayUntil( TickType_t * const pxPreviousWakeTime,
  */
 BaseType_t xTaskAbortDelay( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetDelaySlack( TaskHandle_t xTask, TickType_t xSlackTicks );
+ * @endcode
+ *
+ * configUSE_TIMER_SLACK must be defined as 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Allow a task to leave the Blocked state up to xSlackTicks ticks after the
+ * time at which it would otherwise do so, whether it entered the Blocked
+ * state by calling vTaskDelay() or xTaskDelayUntil(), or by waiting for an
+ * event with a timeout.  The kernel uses the slack to unblock tasks whose wake
+ * times fall close together on the same tick, so with configUSE_TICKLESS_IDLE
+ * the processor is woken less often.  A task is never unblocked early.
+ *
+ * The slack of a task is 0 when it is created.  A change also applies to a
+ * task that is already in the Blocked state.
+ *
+ * @param xTask The handle of the task whose slack is set.  Passing a NULL
+ * handle sets the slack of the calling task.
+ *
+ * @param xSlackTicks The number of ticks by which the task may be late leaving
+ * the Blocked state.
+ *
+ * Example usage:
+ * @code{c}
+ * void vSensorTask( void * pvParameters )
+ * {
+ *   // The sensor is read about once a second, but the exact time does not
+ *   // matter, so allow the delay to end up to 100ms late.
+ *   vTaskSetDelaySlack( NULL, pdMS_TO_TICKS( 100 ) );
+ *
+ *   for( ;; )
+ *   {
+ *       vReadSensor();
+ *       vTaskDelay( pdMS_TO_TICKS( 1000 ) );
+ *   }
+ * }
+ * @endcode
+ * \defgroup vTaskSetDelaySlack vTaskSetDelaySlack
+ * \ingroup TaskCtrl
+ */
+void vTaskSetDelaySlack( TaskHandle_t xTask,
+                         TickType_t xSlackTicks ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * TickType_t xTaskGetDelaySlack( TaskHandle_t xTask );
+ * @endcode
+ *
+ * configUSE_TIMER_SLACK must be defined as 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Obtain the slack set for a task by vTaskSetDelaySlack().
+ *
+ * @param xTask The handle of the task being queried.  Passing a NULL handle
+ * results in the slack of the calling task being returned.
+ *
+ * @return The number of ticks by which the task may be late leaving the
+ * Blocked state.
+ *
+ * \defgroup xTaskGetDelaySlack xTaskGetDelaySlack
+ * \ingroup TaskCtrl
+ */
+TickType_t xTaskGetDelaySlack( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetHeapQuota( TaskHandle_t xTask, size_t xQuotaBytes );
+ * @endcode
+ *
+ * configUSE_HEAP_ACCOUNTING must be defined as 1 in FreeRTOSConfig.h, and
+ * heap_4.c must be used, for this function to be available.
+ *
+ * Limit the heap memory a task can have allocated at any one time.  Once an
+ * allocation would take the memory charged to the task above xQuotaBytes,
+ * pvPortMalloc() returns NULL without searching the heap, and the failure is
+ * counted in the task's TaskHeapUsage_t.  Memory the task already holds is
+ * not affected by lowering the quota.
+ *
+ * Allocations made before the scheduler is started are not charged to any
+ * task.
+ *
+ * @param xTask The handle of the task whose quota is set.  Passing a NULL
+ * handle sets the quota of the calling task.
+ *
+ * @param xQuotaBytes The quota in bytes, including the heap's block headers,
+ * or 0 to remove the limit.
+ *
+ * Example usage:
+ * @code{c}
+ * void vAFunction( void )
+ * {
+ * TaskHandle_t xHandle;
+ *
+ *   xTaskCreate( vParserTask, "Parser", STACK_SIZE, NULL, tskIDLE_PRIORITY, &xHandle );
+ *
+ *   // The parser builds its tables on the heap, but must never starve the
+ *   // rest of the system.
+ *   vTaskSetHeapQuota( xHandle, 4096 );
+ * }
+ * @endcode
+ * \defgroup vTaskSetHeapQuota vTaskSetHeapQuota
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_HEAP_ACCOUNTING == 1 )
+    void vTaskSetHeapQuota( TaskHandle_t xTask,
+                            size_t xQuotaBytes ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetHeapUsage( TaskHandle_t xTask, TaskHeapUsage_t * pxHeapUsage );
+ * @endcode
+ *
+ * configUSE_HEAP_ACCOUNTING must be defined as 1 in FreeRTOSConfig.h, and
+ * heap_4.c must be used, for this function to be available.
+ *
+ * Obtain the heap memory currently and at most charged to a task, its quota,
+ * and the number of allocations its quota has refused.  The same information
+ * is returned for every task by uxTaskGetSystemState().
+ *
+ * @param xTask The handle of the task being queried.  Passing a NULL handle
+ * results in the usage of the calling task being returned.
+ *
+ * @param pxHeapUsage The TaskHeapUsage_t structure that is filled in.
+ *
+ * \defgroup vTaskGetHeapUsage vTaskGetHeapUsage
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_HEAP_ACCOUNTING == 1 )
+    void vTaskGetHeapUsage( TaskHandle_t xTask,
+                            TaskHeapUsage_t * pxHeapUsage ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskFreeRecycledTasks( void );
+ * @endcode
+ *
+ * configUSE_TASK_RECYCLING must be defined as 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * When configUSE_TASK_RECYCLING is 1, xTaskCreate() gives any task that asks
+ * for a stack no deeper than configTASK_RECYCLE_STACK_DEPTH words a stack of
+ * exactly that depth.  When such a task is deleted its TCB and stack are kept,
+ * up to configTASK_RECYCLE_POOL_LENGTH of them, and the next xTaskCreate()
+ * reuses them without allocating memory.  The idle task repaints a kept stack
+ * for the stack overflow checks, so xTaskCreate() only paints a reused stack
+ * itself if the idle task has not run since the stack's task was deleted.
+ *
+ * vTaskFreeRecycledTasks() returns the TCBs and stacks currently kept for
+ * reuse to the heap, for example once a burst of short lived tasks is over.
+ *
+ * \defgroup vTaskFreeRecycledTasks vTaskFreeRecycledTasks
+ * \ingroup Tasks
+ */
+#if ( configUSE_TASK_RECYCLING == 1 )
+    void vTaskFreeRecycledTasks( void ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -1587,6 +1808,12 @@ configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask ) PRIVIL
  * Sets pxHookFunction to be the task hook function used by the task xTask.
  * Passing xTask as NULL has the effect of setting the calling tasks hook
  * function.
+ *
+ * ***NOTE***:  When configUSE_COMPACT_TCB is 1 the tag is held in a side table
+ * shared by all tasks, and at most configTASK_SIDE_TABLE_LENGTH tasks can have
+ * a tag or a thread local storage pointer set at once.  Once the table is full
+ * the tag of a further task is not stored, which fails configASSERT() if it is
+ * defined.
  */
         void vTaskSetApplicationTaskTag( TaskHandle_t xTask,
                                          TaskHookFunction_t pxHookFunction ) PRIVILEGED_FUNCTION;
@@ -1622,7 +1849,13 @@ configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask ) PRIVIL
  * configNUM_THREAD_LOCAL_STORAGE_POINTERS setting in FreeRTOSConfig.h.  The
  * kernel does not use the pointers itself, so the application writer can use
  * the pointers for any purpose they wish.  The following two functions are
- * used to set and query a pointer respectively. */
+ * used to set and query a pointer respectively.
+ *
+ * ***NOTE***:  When configUSE_COMPACT_TCB is 1 the pointers are held in a side
+ * table shared by all tasks, and at most configTASK_SIDE_TABLE_LENGTH tasks can
+ * have a pointer or a task tag set at once.  Once the table is full a pointer
+ * set for a further task is not stored, which fails configASSERT() if it is
+ * defined, and reads of it return NULL. */
     void vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet,
                                             BaseType_t xIndex,
                                             void * pvValue ) PRIVILEGED_FUNCTION;
@@ -1685,6 +1918,27 @@ configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask ) PRIVIL
                                         uint32_t * pulIdleTaskStackSize ); /*lint !e526 Symbol not defined as it is an application callback. */
 #endif
 
+#if ( configUSE_STATIC_TASK_TABLE == 1 )
+
+/**
+ * task.h
+ * @code{c}
+ * void vApplicationGetTaskTable( const TaskTableEntry_t ** ppxTaskTable, UBaseType_t * puxTaskTableLength )
+ * @endcode
+ *
+ * This function is used to provide the application's static task table to
+ * FreeRTOS.  vTaskStartScheduler() creates every task in the table, using the
+ * statically allocated TCB and stack named in each entry, before the scheduler
+ * starts.  This function is required when configUSE_STATIC_TASK_TABLE is set,
+ * and is normally defined by taskDEFINE_TASK_TABLE() from task_table.h.
+ *
+ * @param ppxTaskTable Set to point to the first entry of the table
+ * @param puxTaskTableLength Set to the number of entries in the table
+ */
+    void vApplicationGetTaskTable( const TaskTableEntry_t ** ppxTaskTable,
+                                   UBaseType_t * puxTaskTableLength ); /*lint !e526 Symbol not defined as it is an application callback. */
+#endif
+
 /**
  * task.h
  * @code{c}
@@ -1918,6 +2172,129 @@ void vTaskList( char * pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unquali
  */
 void vTaskGetRunTimeStats( char * pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetTCBSizeReport( char *pcWriteBuffer );
+ * @endcode
+ *
+ * configUSE_STATS_FORMATTING_FUNCTIONS must be defined as 1 for this function
+ * to be available.
+ *
+ * Writes a table of the fields the task control block (TCB) holds in the
+ * current configuration, with the offset and size in bytes of each, followed by
+ * the padding the compiler added and the size of the whole TCB.  The TCB is
+ * the memory each task uses in addition to its stack, so the report shows the
+ * effect of settings such as configMAX_TASK_NAME_LEN,
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES and configUSE_COMPACT_TCB.  When the
+ * compact TCB moves fields into the side table the size of the table, which is
+ * shared by all tasks, is reported on the last line.
+ *
+ * The size of the TCB is also available at compile time as
+ * sizeof( StaticTask_t ).
+ *
+ * @param pcWriteBuffer A buffer into which the table will be written, in ASCII
+ * form.  This buffer is assumed to be large enough to contain the generated
+ * report.  The report has a 46 byte line for each field the TCB holds, plus
+ * at most four more lines, and the TCB holds at most 27 fields, so 1450 bytes
+ * is sufficient for any configuration.
+ *
+ * \defgroup vTaskGetTCBSizeReport vTaskGetTCBSizeReport
+ * \ingroup TaskUtils
+ */
+void vTaskGetTCBSizeReport( char * pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+/**
+ * task. h
+ * @code{c}
+ * UBaseType_t uxTaskGetStackProfile( TaskStackProfile_t * const pxProfileArray, const UBaseType_t uxArraySize );
+ * @endcode
+ *
+ * configUSE_STACK_PROFILING must be defined as 1 for this function to be
+ * available.
+ *
+ * Stack profiling is used to size task stacks from measurements rather than
+ * guesses.  While configUSE_STACK_PROFILING is 1 the kernel records the peak
+ * stack usage, by task name, of every task that exists while the application
+ * runs - deleted tasks are recorded as they are deleted, tasks that still exist
+ * are recorded each time this function is called.  Each entry includes a
+ * recommended stack depth, which is the peak usage plus
+ * configSTACK_PROFILE_MARGIN_PERCENT percent.  Run the application through its
+ * most demanding paths, read the profile, then pass the recommended depths to
+ * xTaskCreate() (or the static task table) to reclaim the RAM that larger
+ * stacks waste.
+ *
+ * Once the stacks are sized, production builds can set
+ * configPAINT_STACK_GUARD_ONLY to 1.  New stacks are then only painted for
+ * configSTACK_GUARD_DEPTH words (and at least the 20 bytes read by stack
+ * overflow check method 2) at their limit, rather than in full, so tasks are
+ * created faster.  The high water mark functions then report no more than the
+ * guard, which is still enough to show whether a task came close to its
+ * limit.
+ *
+ * Up to configSTACK_PROFILE_LENGTH task names are recorded.  Tasks with other
+ * names are not recorded once the profile is full.
+ *
+ * Profiling requires the stacks to be painted in full when tasks are created,
+ * so it cannot be used with configPAINT_STACK_GUARD_ONLY, and on ports whose
+ * stack grows down it requires configRECORD_STACK_HIGH_ADDRESS.
+ *
+ * @param pxProfileArray An array of TaskStackProfile_t structures into which
+ * the profile is copied.
+ *
+ * @param uxArraySize The number of structures pxProfileArray can hold.
+ *
+ * @return The number of structures copied into pxProfileArray.
+ *
+ * Example usage:
+ * @code{c}
+ *  void vPrintStackProfile( void )
+ *  {
+ *  static TaskStackProfile_t xProfile[ configSTACK_PROFILE_LENGTH ];
+ *  UBaseType_t x, uxEntries;
+ *
+ *      uxEntries = uxTaskGetStackProfile( xProfile, configSTACK_PROFILE_LENGTH );
+ *
+ *      for( x = 0; x < uxEntries; x++ )
+ *      {
+ *          printf( "%s: %u of %u words used, use %u\r\n",
+ *                  xProfile[ x ].pcTaskName,
+ *                  ( unsigned int ) xProfile[ x ].uxPeakUsage,
+ *                  ( unsigned int ) xProfile[ x ].uxStackDepth,
+ *                  ( unsigned int ) xProfile[ x ].uxRecommendedDepth );
+ *      }
+ *  }
+ * @endcode
+ * \defgroup uxTaskGetStackProfile uxTaskGetStackProfile
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_STACK_PROFILING == 1 )
+    UBaseType_t uxTaskGetStackProfile( TaskStackProfile_t * const pxProfileArray,
+                                       const UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetStackProfileReport( char *pcWriteBuffer );
+ * @endcode
+ *
+ * configUSE_STACK_PROFILING and configUSE_STATS_FORMATTING_FUNCTIONS must both
+ * be defined as 1 for this function to be available.
+ *
+ * Writes the profile returned by uxTaskGetStackProfile() as a table with one
+ * line per task name, giving the name, the stack depth the task was given, the
+ * peak stack usage and the recommended stack depth, all in words.
+ *
+ * @param pcWriteBuffer A buffer into which the table will be written, in ASCII
+ * form.  This buffer is assumed to be large enough to contain the generated
+ * report.  Approximately 40 bytes per task name should be sufficient.
+ *
+ * \defgroup vTaskGetStackProfileReport vTaskGetStackProfileReport
+ * \ingroup TaskUtils
+ */
+void vTaskGetStackProfileReport( char * pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
 /**
  * task. h
  * @code{c}
@@ -2956,7 +3333,7 @@ BaseType_t xTaskIncrementTick( void ) PRIVILEGED_FUNCTION;
  * portTICK_PERIOD_MS can be used to convert kernel ticks into a real time
  * period.
  */
-void vTaskPlaceOnEventList( List_t * const pxEventList,
+void vTaskPlaceOnEventList( EventList_t * const pxEventList,
                             const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
                                      const TickType_t xItemValue,
@@ -2973,7 +3350,7 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
  * indefinitely, whereas vTaskPlaceOnEventList() does.
  *
  */
-void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
+void vTaskPlaceOnEventListRestricted( EventList_t * const pxEventList,
                                       TickType_t xTicksToWait,
                                       const BaseType_t xWaitIndefinitely ) PRIVILEGED_FUNCTION;
 
@@ -3001,7 +3378,7 @@ void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
  * @return pdTRUE if the task being removed has a higher priority than the task
  * making the call, otherwise pdFALSE.
  */
-BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskRemoveFromEventList( EventList_t * const pxEventList ) PRIVILEGED_FUNCTION;
 void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
                                         const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
 
@@ -3021,6 +3398,39 @@ portDONT_DISCARD void vTaskSwitchContext( void ) PRIVILEGED_FUNCTION;
  */
 TickType_t uxTaskResetEventItemValue( void ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+
+/*
+ * A task's event list item value is only as wide as TickType_t, so when
+ * configUSE_WIDE_EVENT_GROUPS is 1 the 64 event bits a task waits for, and
+ * then the event bits that unblocked it, are held in the TCB instead.  Passing
+ * NULL for xTask accesses the value of the calling task.
+ */
+    void vTaskSetWideEventItemValue( TaskHandle_t xTask,
+                                     uint64_t ullValue ) PRIVILEGED_FUNCTION;
+    uint64_t ullTaskGetWideEventItemValue( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_HEAP_ACCOUNTING == 1 )
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
+ * THE HEAP IMPLEMENTATION, WITH THE SCHEDULER SUSPENDED.
+ *
+ * xTaskCheckHeapQuota() returns pdFALSE, and counts the failure, if allocating
+ * xWantedSize bytes would exceed the calling task's quota.
+ * pvTaskChargeHeapUsage() charges a block to the calling task and returns the
+ * owner to record in the block, which is NULL before the scheduler has
+ * started.  vTaskCreditHeapUsage() removes the charge when the block is freed.
+ */
+    BaseType_t xTaskCheckHeapQuota( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+    void * pvTaskChargeHeapUsage( size_t xBlockSize ) PRIVILEGED_FUNCTION;
+    void vTaskCreditHeapUsage( void * pvOwner,
+                               size_t xBlockSize ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Return the handle of the calling task.
  */
@@ -3061,6 +3471,27 @@ BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder ) PRIVILEGE
 void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder,
                                           UBaseType_t uxHighestPriorityWaitingTask ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_TICKETS == 1 )
+
+/*
+ * For internal use only.  The lottery equivalents of the three functions
+ * above, used by the reader-writer lock.  Raises the tickets of the lock holder
+ * to those of the calling task should the holder have fewer, and restores them
+ * when the lock is given back or the waiting task times out.
+ */
+    BaseType_t xTaskTicketInherit( TaskHandle_t const pxTicketHolder ) PRIVILEGED_FUNCTION;
+    void vTaskTicketDisinherit( TaskHandle_t const pxTicketHolder ) PRIVILEGED_FUNCTION;
+    void vTaskTicketDisinheritAfterTimeout( TaskHandle_t const pxTicketHolder,
+                                            UBaseType_t uxHighestTicketsWaitingTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Returns the number of lottery tickets the task
+ * currently holds, including any it has inherited.
+ */
+    UBaseType_t uxTaskGetTickets( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TICKETS */
+
 /*
  * Get the uxTaskNumber assigned to the task referenced by the xTask parameter.
  */
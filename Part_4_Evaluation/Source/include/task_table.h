@@ -0,0 +1,151 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Macros that turn a single list of an application's tasks into statically
+ * allocated stacks and TCBs, a handle for each task, and the static task table
+ * that vTaskStartScheduler() creates the tasks from when
+ * configUSE_STATIC_TASK_TABLE is set to 1.  Everything is sized and placed at
+ * compile time, so the memory used by the tasks is known at link time, and if
+ * the idle and timer tasks are also statically allocated the application can
+ * start without any heap.
+ *
+ * The list is an X-macro.  Each entry takes the same arguments as
+ * xTaskCreate(), in the same order, except that the handle is named rather than
+ * passed by address:
+ *
+ * @code{c}
+ * #define mainTASK_TABLE( TASK )                                                       \
+ *     TASK( vTask1, "vTask1", STACK_SIZE, ( void * ) "Task 1", TASK_1_PRIORITY, xHandle_1, 94 ) \
+ *     TASK( vTask2, "vTask2", STACK_SIZE, ( void * ) "Task 2", TASK_2_PRIORITY, xHandle_2, 5 )  \
+ *     TASK( vTask3, "vTask3", STACK_SIZE, ( void * ) "Task 3", TASK_3_PRIORITY, xHandle_3, 1 )
+ *
+ * // In exactly one source file.  This defines xHandle_1, xHandle_2 and
+ * // xHandle_3, the tasks' stacks and TCBs, and vApplicationGetTaskTable().
+ * taskDEFINE_TASK_TABLE( mainTASK_TABLE )
+ *
+ * // In a header, to make the handles available to other source files.
+ * taskDECLARE_TASK_TABLE( mainTASK_TABLE )
+ *
+ * void main( void )
+ * {
+ *     // The tasks are created here, and their handles set, before the
+ *     // scheduler starts.
+ *     vTaskStartScheduler();
+ * }
+ * @endcode
+ *
+ * The table entries are initialised at compile time, so the parameter passed
+ * to each task must be a constant, such as NULL, a string literal or the
+ * address of a variable.  When the table is defined in a C++ source file it is
+ * constexpr.
+ *
+ * The priority and ticket number of each task are checked at compile time, with
+ * static_assert() in C++ and an array that cannot be declared in C.  A ticket
+ * number above 100, which prvInitialiseNewTask() would treat as no tickets, or
+ * a priority of configMAX_PRIORITIES or more, stops the build.
+ *
+ * taskTASK_TABLE_RAM_BYTES() gives the bytes used by the tasks' stacks and
+ * TCBs as a constant expression, for example to check the footprint with a
+ * static assertion.
+ */
+
+#ifndef TASK_TABLE_H
+#define TASK_TABLE_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include task_table.h"
+#endif
+
+#include "task.h"
+
+#if ( configUSE_STATIC_TASK_TABLE != 1 )
+    #error configUSE_STATIC_TASK_TABLE must be set to 1 in FreeRTOSConfig.h to use task_table.h.
+#endif
+
+#if defined( __cplusplus )
+    #define taskTABLE_CONSTANT                              constexpr
+    #define taskTABLE_STATIC_ASSERT( xCondition, xName )    static_assert( xCondition, #xName );
+#else
+    #define taskTABLE_CONSTANT                              const
+    #define taskTABLE_STATIC_ASSERT( xCondition, xName )    typedef char xName[ ( xCondition ) ? 1 : -1 ];
+#endif
+
+/* The functions passed to the application's X-macro.  Each is expanded once for
+ * every task in the table. */
+#define taskTABLE_CHECK( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, xHandle, uxTicketNumber )                      \
+    taskTABLE_STATIC_ASSERT( ( ( uxPriority ) & ~( ( UBaseType_t ) portPRIVILEGE_BIT ) ) < configMAX_PRIORITIES, xHandle##_PriorityTooHigh ) \
+    taskTABLE_STATIC_ASSERT( ( uxTicketNumber ) <= 100, xHandle##_TooManyTickets )
+
+#define taskTABLE_STORAGE( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, xHandle, uxTicketNumber ) \
+    static StackType_t xHandle##_uxStack[ ulStackDepth ];                                                      \
+    static StaticTask_t xHandle##_xTCB;                                                                         \
+    TaskHandle_t xHandle = NULL;
+
+#define taskTABLE_ENTRY( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, xHandle, uxTicketNumber )                  \
+    { ( pxTaskCode ), ( pcName ), ( uint32_t ) ( ulStackDepth ), ( pvParameters ), ( UBaseType_t ) ( uxPriority ), ( UBaseType_t ) ( uxTicketNumber ), \
+      xHandle##_uxStack, &( xHandle##_xTCB ), &( xHandle ) },
+
+#define taskTABLE_HANDLE_DECLARATION( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, xHandle, uxTicketNumber ) \
+    extern TaskHandle_t xHandle;
+
+#define taskTABLE_STACK_WORDS( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, xHandle, uxTicketNumber )    +( ulStackDepth )
+#define taskTABLE_ONE( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, xHandle, uxTicketNumber )            +1
+
+/*
+ * Define the stacks, TCBs and handles of the tasks listed by TABLE, and the
+ * vApplicationGetTaskTable() callback that passes the table to the kernel.
+ * Must be used in exactly one source file, at file scope.
+ */
+#define taskDEFINE_TASK_TABLE( TABLE )                                                                                              \
+    TABLE( taskTABLE_CHECK )                                                                                                        \
+    TABLE( taskTABLE_STORAGE )                                                                                                      \
+    static taskTABLE_CONSTANT TaskTableEntry_t xApplicationTaskTable[] = { TABLE( taskTABLE_ENTRY ) };                               \
+    void vApplicationGetTaskTable( const TaskTableEntry_t ** ppxTaskTable,                                                          \
+                                   UBaseType_t * puxTaskTableLength )                                                               \
+    {                                                                                                                               \
+        *ppxTaskTable = xApplicationTaskTable;                                                                                      \
+        *puxTaskTableLength = ( UBaseType_t ) ( sizeof( xApplicationTaskTable ) / sizeof( xApplicationTaskTable[ 0 ] ) );           \
+    }
+
+/*
+ * Declare the handles of the tasks listed by TABLE, for use in other source
+ * files.
+ */
+#define taskDECLARE_TASK_TABLE( TABLE )    TABLE( taskTABLE_HANDLE_DECLARATION )
+
+/*
+ * The number of tasks listed by TABLE, and the bytes of RAM their stacks and
+ * TCBs occupy, as constant expressions.
+ */
+#define taskTASK_TABLE_LENGTH( TABLE )       ( ( UBaseType_t ) ( 0 TABLE( taskTABLE_ONE ) ) )
+#define taskTASK_TABLE_RAM_BYTES( TABLE )                                                   \
+    ( ( ( size_t ) ( 0 TABLE( taskTABLE_STACK_WORDS ) ) * sizeof( StackType_t ) ) + \
+      ( ( size_t ) taskTASK_TABLE_LENGTH( TABLE ) * sizeof( StaticTask_t ) ) )
+
+#endif /* TASK_TABLE_H */
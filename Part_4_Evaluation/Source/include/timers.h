@@ -1323,6 +1323,43 @@ TickType_t xTimerGetPeriod( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
  */
 TickType_t xTimerGetExpiryTime( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
 
+/**
+ * void vTimerSetSlack( TimerHandle_t xTimer, TickType_t xSlackTicks );
+ *
+ * configUSE_TIMER_SLACK must be set to 1 in FreeRTOSConfig.h for this function
+ * to be available.
+ *
+ * Allow a timer's callback to be called up to xSlackTicks ticks after the
+ * timer's expiry time.  The timer service task sleeps until the earliest time
+ * by which a timer must be processed, then processes every timer that has
+ * expired, so timers with overlapping windows are handled in one wakeup.  A
+ * timer never expires early, and the expiry time and period of an auto-reload
+ * timer are not shifted by the slack.
+ *
+ * The slack of a timer is 0 when it is created.  A change takes effect the next
+ * time the timer service task recalculates its block time.
+ *
+ * @param xTimer The handle of the timer being updated.
+ *
+ * @param xSlackTicks The number of ticks by which the timer may be late.
+ */
+void vTimerSetSlack( TimerHandle_t xTimer,
+                     TickType_t xSlackTicks ) PRIVILEGED_FUNCTION;
+
+/**
+ * TickType_t xTimerGetSlack( TimerHandle_t xTimer );
+ *
+ * configUSE_TIMER_SLACK must be set to 1 in FreeRTOSConfig.h for this function
+ * to be available.
+ *
+ * Returns the slack of a timer set by vTimerSetSlack().
+ *
+ * @param xTimer The handle of the timer being queried.
+ *
+ * @return The number of ticks by which the timer may be late.
+ */
+TickType_t xTimerGetSlack( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
 /*
  * Functions beyond this part are not part of the public API and are intended
  * for use by the kernel only.
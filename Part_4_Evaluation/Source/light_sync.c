@@ -0,0 +1,855 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "light_sync.h"
+
+/* Lint e961, e9021 and e750 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021. */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include light semaphore and light event flag functionality. */
+#if ( configUSE_LIGHT_SYNC == 1 )
+
+    #if ( configUSE_TASK_NOTIFICATIONS != 1 )
+        #error configUSE_TASK_NOTIFICATIONS must be set to 1 to build light_sync.c
+    #endif
+
+    #if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 )
+        #error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to build light_sync.c
+    #endif
+
+    #if ( configLIGHT_SYNC_NOTIFICATION_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES )
+        #error configLIGHT_SYNC_NOTIFICATION_INDEX must be less than configTASK_NOTIFICATION_ARRAY_ENTRIES
+    #endif
+
+/* A waiting task clears the state and value of its notification at this index,
+ * which would discard notifications sent by xTaskNotifyGive(), stream buffers
+ * and message buffers if index 0 were used while another index is free. */
+    #if ( ( configLIGHT_SYNC_NOTIFICATION_INDEX == 0 ) && ( configTASK_NOTIFICATION_ARRAY_ENTRIES > 1 ) )
+        #error configLIGHT_SYNC_NOTIFICATION_INDEX must be set to a notification index other than 0 in FreeRTOSConfig.h, as index 0 is used by xTaskNotifyGive(), ulTaskNotifyTake() and stream and message buffers.
+    #endif
+
+/* Bits that can be set in ucFlags. */
+    #define lightFLAGS_IS_STATICALLY_ALLOCATED    ( ( uint8_t ) 1 ) /* Set if the object was created using statically allocated memory. */
+
+/* Bits that can be set in a waiter's ucOptions. */
+    #define lightWAIT_FOR_ALL_BITS                ( ( uint8_t ) 1 ) /* The waiter needs all of ulValue to be set, rather than any. */
+    #define lightCLEAR_ON_EXIT                    ( ( uint8_t ) 2 ) /* The bits the waiter waited for are cleared when it is released. */
+
+/*-----------------------------------------------------------*/
+
+/*
+ * A task that has to wait for a light semaphore or light event flags places a
+ * waiter on its own stack and links it into the object's list of waiters, so
+ * the objects themselves only need to hold a pointer to the first waiter.
+ * Waiters are released in the order they started to wait.  A released waiter
+ * is removed from the list and has xReleased set before its task is notified,
+ * so a task that times out can tell whether it was released just before it
+ * gave up.
+ */
+    typedef struct LightWaiter
+    {
+        struct LightWaiter * pxNext; /*< The next task waiting on the same object. */
+        TaskHandle_t xTask;          /*< The waiting task. */
+        uint32_t ulValue;            /*< For event flags, the bits being waited for, then the value of the flags when the waiter was released. */
+        uint8_t ucOptions;           /*< For event flags, lightWAIT_FOR_ALL_BITS and lightCLEAR_ON_EXIT. */
+        volatile BaseType_t xReleased;
+    } LightWaiter_t;
+
+    typedef struct LightSemaphoreDefinition
+    {
+        UBaseType_t uxCount;              /*< The number of times the semaphore can be taken without blocking. */
+        UBaseType_t uxMaxCount;           /*< The count at which xLightSemaphoreGive() fails. */
+        LightWaiter_t * pxWaiters;        /*< The tasks waiting to take the semaphore, oldest first. */
+        uint8_t ucFlags;                  /*< Holds lightFLAGS_IS_STATICALLY_ALLOCATED. */
+    } LightSemaphore_t;
+
+    typedef struct LightEventFlagsDefinition
+    {
+        uint32_t ulFlags;                 /*< The current value of the flags. */
+        LightWaiter_t * pxWaiters;        /*< The tasks waiting for flags to be set, oldest first. */
+        uint8_t ucFlags;                  /*< Holds lightFLAGS_IS_STATICALLY_ALLOCATED. */
+    } LightEventFlags_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Adds pxWaiter to the end of the list of waiters starting at *ppxWaiters and
+ * clears any notification left over from an earlier wait.  Must be called from
+ * a critical section.
+ */
+    static void prvAddWaiter( LightWaiter_t ** ppxWaiters,
+                              LightWaiter_t * const pxWaiter ) PRIVILEGED_FUNCTION;
+
+/*
+ * Blocks the calling task until pxWaiter is released or xTicksToWait expires,
+ * then removes pxWaiter from the list if it was not released.  Returns pdTRUE
+ * if the waiter was released.
+ */
+    static BaseType_t prvWaitForRelease( LightWaiter_t ** ppxWaiters,
+                                         LightWaiter_t * const pxWaiter,
+                                         TimeOut_t * const pxTimeOut,
+                                         TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Sets the flags in ulBitsToSet and releases every waiter whose condition is
+ * then met, clearing the bits of any that asked for that once all have been
+ * released.  The task of each released waiter is notified through
+ * pxHigherPriorityTaskWoken if that is not NULL, as from an interrupt.  Must
+ * be called from a critical section.  Returns the value of the flags before
+ * any bits were cleared.
+ */
+    static uint32_t prvSetFlags( LightEventFlags_t * const pxEventFlags,
+                                 uint32_t ulBitsToSet,
+                                 BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if ulFlags meets the condition of a waiter that wants
+ * ulBitsToWaitFor with the options in ucOptions.
+ */
+    static BaseType_t prvConditionMet( uint32_t ulFlags,
+                                       uint32_t ulBitsToWaitFor,
+                                       uint8_t ucOptions ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        LightSemaphoreHandle_t xLightSemaphoreCreate( UBaseType_t uxMaxCount,
+                                                      UBaseType_t uxInitialCount )
+        {
+            LightSemaphore_t * pxSemaphore;
+
+            configASSERT( uxMaxCount > ( UBaseType_t ) 0 );
+            configASSERT( uxInitialCount <= uxMaxCount );
+
+            pxSemaphore = ( LightSemaphore_t * ) pvPortMalloc( sizeof( LightSemaphore_t ) ); /*lint !e9087 !e9079 see comment above. */
+
+            if( pxSemaphore != NULL )
+            {
+                ( void ) memset( ( void * ) pxSemaphore, 0x00, sizeof( LightSemaphore_t ) );
+                pxSemaphore->uxCount = uxInitialCount;
+                pxSemaphore->uxMaxCount = uxMaxCount;
+                traceLIGHT_SEMAPHORE_CREATE( pxSemaphore );
+            }
+            else
+            {
+                traceLIGHT_SEMAPHORE_CREATE_FAILED();
+            }
+
+            return pxSemaphore;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        LightSemaphoreHandle_t xLightSemaphoreCreateStatic( UBaseType_t uxMaxCount,
+                                                            UBaseType_t uxInitialCount,
+                                                            StaticLightSemaphore_t * const pxSemaphoreBuffer )
+        {
+            LightSemaphore_t * const pxSemaphore = ( LightSemaphore_t * ) pxSemaphoreBuffer; /*lint !e740 !e9087 Safe cast as StaticLightSemaphore_t is opaque LightSemaphore_t. */
+
+            configASSERT( pxSemaphoreBuffer );
+            configASSERT( uxMaxCount > ( UBaseType_t ) 0 );
+            configASSERT( uxInitialCount <= uxMaxCount );
+
+            #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticLightSemaphore_t equals the size of the
+                 * real light semaphore structure. */
+                volatile size_t xSize = sizeof( StaticLightSemaphore_t );
+                configASSERT( xSize == sizeof( LightSemaphore_t ) );
+            } /*lint !e529 xSize is referenced is configASSERT() is defined. */
+            #endif /* configASSERT_DEFINED */
+
+            if( pxSemaphore != NULL )
+            {
+                ( void ) memset( ( void * ) pxSemaphore, 0x00, sizeof( LightSemaphore_t ) );
+                pxSemaphore->uxCount = uxInitialCount;
+                pxSemaphore->uxMaxCount = uxMaxCount;
+                pxSemaphore->ucFlags = lightFLAGS_IS_STATICALLY_ALLOCATED;
+                traceLIGHT_SEMAPHORE_CREATE( pxSemaphore );
+            }
+            else
+            {
+                traceLIGHT_SEMAPHORE_CREATE_FAILED();
+            }
+
+            return pxSemaphore;
+        }
+
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    void vLightSemaphoreDelete( LightSemaphoreHandle_t xSemaphore )
+    {
+        LightSemaphore_t * const pxSemaphore = xSemaphore;
+
+        configASSERT( pxSemaphore );
+
+        /* A task waiting on the semaphore would be left waiting on memory that
+         * has been freed. */
+        configASSERT( pxSemaphore->pxWaiters == NULL );
+
+        if( ( pxSemaphore->ucFlags & lightFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) pdFALSE )
+        {
+            #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+            {
+                vPortFree( ( void * ) pxSemaphore ); /*lint !e9087 Standard free() semantics require void *, plus pxSemaphore was allocated by pvPortMalloc(). */
+            }
+            #else
+            {
+                /* Should not be possible to get here, ucFlags must be corrupt.
+                 * Force an assert. */
+                configASSERT( xSemaphore == ( LightSemaphoreHandle_t ) ~0 );
+            }
+            #endif
+        }
+        else
+        {
+            /* The structure was statically allocated, so just scrub it. */
+            ( void ) memset( pxSemaphore, 0x00, sizeof( LightSemaphore_t ) );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xLightSemaphoreTake( LightSemaphoreHandle_t xSemaphore,
+                                    TickType_t xTicksToWait )
+    {
+        LightSemaphore_t * const pxSemaphore = xSemaphore;
+        LightWaiter_t xWaiter;
+        TimeOut_t xTimeOut;
+        BaseType_t xReturn = pdFAIL, xMustWait = pdFALSE;
+
+        configASSERT( pxSemaphore );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        taskENTER_CRITICAL();
+        {
+            if( pxSemaphore->uxCount > ( UBaseType_t ) 0 )
+            {
+                ( pxSemaphore->uxCount )--;
+                xReturn = pdPASS;
+            }
+            else if( xTicksToWait != ( TickType_t ) 0 )
+            {
+                vTaskSetTimeOutState( &xTimeOut );
+                prvAddWaiter( &( pxSemaphore->pxWaiters ), &xWaiter );
+                xMustWait = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xMustWait != pdFALSE )
+        {
+            traceBLOCKING_ON_LIGHT_SEMAPHORE_TAKE( xSemaphore );
+
+            /* A waiter that is released has been handed the count directly by
+             * the task or interrupt that gave the semaphore. */
+            xReturn = prvWaitForRelease( &( pxSemaphore->pxWaiters ), &xWaiter, &xTimeOut, xTicksToWait );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xReturn != pdFAIL )
+        {
+            traceLIGHT_SEMAPHORE_TAKE( xSemaphore );
+        }
+        else
+        {
+            traceLIGHT_SEMAPHORE_TAKE_FAILED( xSemaphore );
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xLightSemaphoreTakeFromISR( LightSemaphoreHandle_t xSemaphore )
+    {
+        LightSemaphore_t * const pxSemaphore = xSemaphore;
+        UBaseType_t uxSavedInterruptStatus;
+        BaseType_t xReturn;
+
+        configASSERT( pxSemaphore );
+
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            if( pxSemaphore->uxCount > ( UBaseType_t ) 0 )
+            {
+                ( pxSemaphore->uxCount )--;
+                xReturn = pdPASS;
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xLightSemaphoreGive( LightSemaphoreHandle_t xSemaphore )
+    {
+        LightSemaphore_t * const pxSemaphore = xSemaphore;
+        LightWaiter_t * pxWaiter;
+        BaseType_t xReturn = pdPASS;
+
+        configASSERT( pxSemaphore );
+
+        taskENTER_CRITICAL();
+        {
+            pxWaiter = pxSemaphore->pxWaiters;
+
+            if( pxWaiter != NULL )
+            {
+                /* The count is handed straight to the oldest waiter, so a task
+                 * that takes the semaphore in the meantime cannot steal it. */
+                pxSemaphore->pxWaiters = pxWaiter->pxNext;
+                pxWaiter->xReleased = pdTRUE;
+                ( void ) xTaskNotifyGiveIndexed( pxWaiter->xTask, configLIGHT_SYNC_NOTIFICATION_INDEX );
+            }
+            else if( pxSemaphore->uxCount < pxSemaphore->uxMaxCount )
+            {
+                ( pxSemaphore->uxCount )++;
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xReturn != pdFAIL )
+        {
+            traceLIGHT_SEMAPHORE_GIVE( xSemaphore );
+        }
+        else
+        {
+            traceLIGHT_SEMAPHORE_GIVE_FAILED( xSemaphore );
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xLightSemaphoreGiveFromISR( LightSemaphoreHandle_t xSemaphore,
+                                           BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        LightSemaphore_t * const pxSemaphore = xSemaphore;
+        LightWaiter_t * pxWaiter;
+        UBaseType_t uxSavedInterruptStatus;
+        BaseType_t xReturn = pdPASS;
+
+        configASSERT( pxSemaphore );
+
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            pxWaiter = pxSemaphore->pxWaiters;
+
+            if( pxWaiter != NULL )
+            {
+                pxSemaphore->pxWaiters = pxWaiter->pxNext;
+                pxWaiter->xReleased = pdTRUE;
+                vTaskNotifyGiveIndexedFromISR( pxWaiter->xTask, configLIGHT_SYNC_NOTIFICATION_INDEX, pxHigherPriorityTaskWoken );
+            }
+            else if( pxSemaphore->uxCount < pxSemaphore->uxMaxCount )
+            {
+                ( pxSemaphore->uxCount )++;
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        traceLIGHT_SEMAPHORE_GIVE_FROM_ISR( xSemaphore, xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxLightSemaphoreGetCount( LightSemaphoreHandle_t xSemaphore )
+    {
+        const LightSemaphore_t * const pxSemaphore = xSemaphore;
+
+        configASSERT( pxSemaphore );
+
+        return pxSemaphore->uxCount;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        LightEventFlagsHandle_t xLightEventFlagsCreate( void )
+        {
+            LightEventFlags_t * pxEventFlags;
+
+            pxEventFlags = ( LightEventFlags_t * ) pvPortMalloc( sizeof( LightEventFlags_t ) ); /*lint !e9087 !e9079 see comment above. */
+
+            if( pxEventFlags != NULL )
+            {
+                ( void ) memset( ( void * ) pxEventFlags, 0x00, sizeof( LightEventFlags_t ) );
+                traceLIGHT_EVENT_FLAGS_CREATE( pxEventFlags );
+            }
+            else
+            {
+                traceLIGHT_EVENT_FLAGS_CREATE_FAILED();
+            }
+
+            return pxEventFlags;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        LightEventFlagsHandle_t xLightEventFlagsCreateStatic( StaticLightEventFlags_t * const pxEventFlagsBuffer )
+        {
+            LightEventFlags_t * const pxEventFlags = ( LightEventFlags_t * ) pxEventFlagsBuffer; /*lint !e740 !e9087 Safe cast as StaticLightEventFlags_t is opaque LightEventFlags_t. */
+
+            configASSERT( pxEventFlagsBuffer );
+
+            #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticLightEventFlags_t equals the size of
+                 * the real light event flags structure. */
+                volatile size_t xSize = sizeof( StaticLightEventFlags_t );
+                configASSERT( xSize == sizeof( LightEventFlags_t ) );
+            } /*lint !e529 xSize is referenced is configASSERT() is defined. */
+            #endif /* configASSERT_DEFINED */
+
+            if( pxEventFlags != NULL )
+            {
+                ( void ) memset( ( void * ) pxEventFlags, 0x00, sizeof( LightEventFlags_t ) );
+                pxEventFlags->ucFlags = lightFLAGS_IS_STATICALLY_ALLOCATED;
+                traceLIGHT_EVENT_FLAGS_CREATE( pxEventFlags );
+            }
+            else
+            {
+                traceLIGHT_EVENT_FLAGS_CREATE_FAILED();
+            }
+
+            return pxEventFlags;
+        }
+
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    void vLightEventFlagsDelete( LightEventFlagsHandle_t xEventFlags )
+    {
+        LightEventFlags_t * const pxEventFlags = xEventFlags;
+
+        configASSERT( pxEventFlags );
+
+        /* A task waiting on the flags would be left waiting on memory that has
+         * been freed. */
+        configASSERT( pxEventFlags->pxWaiters == NULL );
+
+        if( ( pxEventFlags->ucFlags & lightFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) pdFALSE )
+        {
+            #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+            {
+                vPortFree( ( void * ) pxEventFlags ); /*lint !e9087 Standard free() semantics require void *, plus pxEventFlags was allocated by pvPortMalloc(). */
+            }
+            #else
+            {
+                /* Should not be possible to get here, ucFlags must be corrupt.
+                 * Force an assert. */
+                configASSERT( xEventFlags == ( LightEventFlagsHandle_t ) ~0 );
+            }
+            #endif
+        }
+        else
+        {
+            /* The structure was statically allocated, so just scrub it. */
+            ( void ) memset( pxEventFlags, 0x00, sizeof( LightEventFlags_t ) );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulLightEventFlagsWait( LightEventFlagsHandle_t xEventFlags,
+                                    uint32_t ulBitsToWaitFor,
+                                    BaseType_t xClearOnExit,
+                                    BaseType_t xWaitForAllBits,
+                                    TickType_t xTicksToWait )
+    {
+        LightEventFlags_t * const pxEventFlags = xEventFlags;
+        LightWaiter_t xWaiter;
+        TimeOut_t xTimeOut;
+        uint32_t ulReturn;
+        BaseType_t xMustWait = pdFALSE;
+
+        configASSERT( pxEventFlags );
+        configASSERT( ulBitsToWaitFor != ( uint32_t ) 0 );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        xWaiter.ulValue = ulBitsToWaitFor;
+        xWaiter.ucOptions = ( uint8_t ) 0;
+
+        if( xWaitForAllBits != pdFALSE )
+        {
+            xWaiter.ucOptions |= lightWAIT_FOR_ALL_BITS;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xClearOnExit != pdFALSE )
+        {
+            xWaiter.ucOptions |= lightCLEAR_ON_EXIT;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        taskENTER_CRITICAL();
+        {
+            ulReturn = pxEventFlags->ulFlags;
+
+            if( prvConditionMet( ulReturn, ulBitsToWaitFor, xWaiter.ucOptions ) != pdFALSE )
+            {
+                if( xClearOnExit != pdFALSE )
+                {
+                    pxEventFlags->ulFlags &= ~ulBitsToWaitFor;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else if( xTicksToWait != ( TickType_t ) 0 )
+            {
+                vTaskSetTimeOutState( &xTimeOut );
+                prvAddWaiter( &( pxEventFlags->pxWaiters ), &xWaiter );
+                xMustWait = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xMustWait != pdFALSE )
+        {
+            traceLIGHT_EVENT_FLAGS_WAIT_BLOCK( xEventFlags, ulBitsToWaitFor );
+
+            if( prvWaitForRelease( &( pxEventFlags->pxWaiters ), &xWaiter, &xTimeOut, xTicksToWait ) != pdFALSE )
+            {
+                /* The task that released the waiter recorded the value of the
+                 * flags at that time, before clearing any bits. */
+                ulReturn = xWaiter.ulValue;
+            }
+            else
+            {
+                ulReturn = pxEventFlags->ulFlags;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceLIGHT_EVENT_FLAGS_WAIT_END( xEventFlags, ulBitsToWaitFor, ulReturn );
+
+        return ulReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulLightEventFlagsSet( LightEventFlagsHandle_t xEventFlags,
+                                   uint32_t ulBitsToSet )
+    {
+        LightEventFlags_t * const pxEventFlags = xEventFlags;
+        uint32_t ulReturn;
+
+        configASSERT( pxEventFlags );
+
+        traceLIGHT_EVENT_FLAGS_SET( xEventFlags, ulBitsToSet );
+
+        taskENTER_CRITICAL();
+        {
+            ulReturn = prvSetFlags( pxEventFlags, ulBitsToSet, NULL );
+        }
+        taskEXIT_CRITICAL();
+
+        return ulReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulLightEventFlagsSetFromISR( LightEventFlagsHandle_t xEventFlags,
+                                          uint32_t ulBitsToSet,
+                                          BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        LightEventFlags_t * const pxEventFlags = xEventFlags;
+        UBaseType_t uxSavedInterruptStatus;
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        uint32_t ulReturn;
+
+        configASSERT( pxEventFlags );
+
+        traceLIGHT_EVENT_FLAGS_SET_FROM_ISR( xEventFlags, ulBitsToSet );
+
+        /* Unlike xEventGroupSetBitsFromISR(), which defers to the timer task,
+         * the waiters are released here.  The time this takes grows with the
+         * number of waiters, which is expected to be small. */
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            ulReturn = prvSetFlags( pxEventFlags, ulBitsToSet, &xHigherPriorityTaskWoken );
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        if( ( pxHigherPriorityTaskWoken != NULL ) && ( xHigherPriorityTaskWoken != pdFALSE ) )
+        {
+            *pxHigherPriorityTaskWoken = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return ulReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulLightEventFlagsClear( LightEventFlagsHandle_t xEventFlags,
+                                     uint32_t ulBitsToClear )
+    {
+        LightEventFlags_t * const pxEventFlags = xEventFlags;
+        uint32_t ulReturn;
+
+        configASSERT( pxEventFlags );
+
+        traceLIGHT_EVENT_FLAGS_CLEAR( xEventFlags, ulBitsToClear );
+
+        taskENTER_CRITICAL();
+        {
+            ulReturn = pxEventFlags->ulFlags;
+            pxEventFlags->ulFlags &= ~ulBitsToClear;
+        }
+        taskEXIT_CRITICAL();
+
+        return ulReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulLightEventFlagsGet( LightEventFlagsHandle_t xEventFlags )
+    {
+        const LightEventFlags_t * const pxEventFlags = xEventFlags;
+
+        configASSERT( pxEventFlags );
+
+        return pxEventFlags->ulFlags;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvAddWaiter( LightWaiter_t ** ppxWaiters,
+                              LightWaiter_t * const pxWaiter )
+    {
+        LightWaiter_t ** ppxLink = ppxWaiters;
+
+        pxWaiter->pxNext = NULL;
+        pxWaiter->xTask = xTaskGetCurrentTaskHandle();
+        pxWaiter->xReleased = pdFALSE;
+
+        /* Walk to the end of the list so waiters are released in the order in
+         * which they started to wait. */
+        while( *ppxLink != NULL )
+        {
+            ppxLink = &( ( *ppxLink )->pxNext );
+        }
+
+        *ppxLink = pxWaiter;
+
+        /* Any notification still pending on the index is from a wait that has
+         * already ended, so must not end this one. */
+        ( void ) xTaskNotifyStateClearIndexed( NULL, configLIGHT_SYNC_NOTIFICATION_INDEX );
+        ( void ) ulTaskNotifyValueClearIndexed( NULL, configLIGHT_SYNC_NOTIFICATION_INDEX, ~( ( uint32_t ) 0 ) );
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvWaitForRelease( LightWaiter_t ** ppxWaiters,
+                                         LightWaiter_t * const pxWaiter,
+                                         TimeOut_t * const pxTimeOut,
+                                         TickType_t xTicksToWait )
+    {
+        LightWaiter_t ** ppxLink;
+
+        while( pxWaiter->xReleased == pdFALSE )
+        {
+            if( xTaskCheckForTimeOut( pxTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                break;
+            }
+            else
+            {
+                ( void ) ulTaskNotifyTakeIndexed( configLIGHT_SYNC_NOTIFICATION_INDEX, pdTRUE, xTicksToWait );
+            }
+        }
+
+        taskENTER_CRITICAL();
+        {
+            /* The waiter may have been released after the time out was
+             * detected, in which case it is no longer in the list and the
+             * release must be honoured. */
+            if( pxWaiter->xReleased == pdFALSE )
+            {
+                ppxLink = ppxWaiters;
+
+                while( *ppxLink != pxWaiter )
+                {
+                    configASSERT( *ppxLink );
+                    ppxLink = &( ( *ppxLink )->pxNext );
+                }
+
+                *ppxLink = pxWaiter->pxNext;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return pxWaiter->xReleased;
+    }
+/*-----------------------------------------------------------*/
+
+    static uint32_t prvSetFlags( LightEventFlags_t * const pxEventFlags,
+                                 uint32_t ulBitsToSet,
+                                 BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        LightWaiter_t ** ppxLink = &( pxEventFlags->pxWaiters );
+        LightWaiter_t * pxWaiter;
+        uint32_t ulFlags, ulBitsToClear = ( uint32_t ) 0;
+
+        pxEventFlags->ulFlags |= ulBitsToSet;
+        ulFlags = pxEventFlags->ulFlags;
+
+        while( *ppxLink != NULL )
+        {
+            pxWaiter = *ppxLink;
+
+            if( prvConditionMet( ulFlags, pxWaiter->ulValue, pxWaiter->ucOptions ) != pdFALSE )
+            {
+                if( ( pxWaiter->ucOptions & lightCLEAR_ON_EXIT ) != ( uint8_t ) 0 )
+                {
+                    ulBitsToClear |= pxWaiter->ulValue;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Unlink the waiter and tell it the value that released it. */
+                *ppxLink = pxWaiter->pxNext;
+                pxWaiter->ulValue = ulFlags;
+                pxWaiter->xReleased = pdTRUE;
+
+                if( pxHigherPriorityTaskWoken != NULL )
+                {
+                    vTaskNotifyGiveIndexedFromISR( pxWaiter->xTask, configLIGHT_SYNC_NOTIFICATION_INDEX, pxHigherPriorityTaskWoken );
+                }
+                else
+                {
+                    ( void ) xTaskNotifyGiveIndexed( pxWaiter->xTask, configLIGHT_SYNC_NOTIFICATION_INDEX );
+                }
+            }
+            else
+            {
+                ppxLink = &( pxWaiter->pxNext );
+            }
+        }
+
+        /* Bits are only cleared once every waiter has seen them, so all tasks
+         * waiting for the same bits are released together. */
+        pxEventFlags->ulFlags &= ~ulBitsToClear;
+
+        return ulFlags;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvConditionMet( uint32_t ulFlags,
+                                       uint32_t ulBitsToWaitFor,
+                                       uint8_t ucOptions )
+    {
+        BaseType_t xReturn;
+
+        if( ( ucOptions & lightWAIT_FOR_ALL_BITS ) != ( uint8_t ) 0 )
+        {
+            xReturn = ( ( ulFlags & ulBitsToWaitFor ) == ulBitsToWaitFor ) ? pdTRUE : pdFALSE;
+        }
+        else
+        {
+            xReturn = ( ( ulFlags & ulBitsToWaitFor ) != ( uint32_t ) 0 ) ? pdTRUE : pdFALSE;
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_LIGHT_SYNC */
@@ -224,3 +224,413 @@ UBaseType_t uxListRemove( ListItem_t * const pxItemToRemove )
     return pxList->uxNumberOfItems;
 }
 /*-----------------------------------------------------------*/
+
+#if ( listINCLUDE_WHEEL == 1 )
+
+/* The largest distance ahead of the wheel time that the top level of the
+ * wheel can represent.  Items further ahead are filed as if they expired at
+ * this distance, and are refiled when that slot cascades. */
+    #define listWHEEL_MAX_DELTA    ( ( TickType_t ) ( ( ( uint32_t ) 1U << ( listWHEEL_SLOT_BITS * ( uint32_t ) configLIST_WHEEL_LEVELS ) ) - 1U ) )
+
+/*
+ * Return the bit number of the lowest set bit in a non-zero word in constant
+ * time, without relying on a count trailing zeros instruction.
+ */
+    static UBaseType_t prvLowestSetBit( uint32_t ulBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Find the first slot on uxLevel, starting at uxStartSlot and wrapping round
+ * the level, that holds at least one item.  Returns pdTRUE and sets
+ * *puxDistance to the number of slots between uxStartSlot and the slot found
+ * if there is one, otherwise returns pdFALSE.
+ */
+    static BaseType_t prvFindOccupiedSlot( ListWheel_t * const pxWheel,
+                                           UBaseType_t uxLevel,
+                                           UBaseType_t uxStartSlot,
+                                           UBaseType_t * const puxDistance ) PRIVILEGED_FUNCTION;
+
+/*
+ * Move every item out of a slot and insert it again relative to the current
+ * wheel time, which places it on a lower level.
+ */
+    static void prvCascadeSlot( ListWheel_t * const pxWheel,
+                                UBaseType_t uxLevel,
+                                UBaseType_t uxSlot ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    static UBaseType_t prvLowestSetBit( uint32_t ulBits )
+    {
+        static const uint8_t ucDeBruijnBitPosition[ 32 ] =
+        {
+            0U,  1U,  28U, 2U,  29U, 14U, 24U, 3U, 30U, 22U, 20U, 15U, 25U, 17U, 4U,  8U,
+            31U, 27U, 13U, 23U, 21U, 19U, 16U, 7U, 26U, 12U, 18U, 6U,  11U, 5U,  10U, 9U
+        };
+
+        /* Isolate the lowest set bit, then use a de Bruijn sequence to map it
+         * to its bit number. */
+        return ( UBaseType_t ) ucDeBruijnBitPosition[ ( uint32_t ) ( ( ulBits & ( ~ulBits + 1UL ) ) * 0x077CB531UL ) >> 27 ];
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvFindOccupiedSlot( ListWheel_t * const pxWheel,
+                                           UBaseType_t uxLevel,
+                                           UBaseType_t uxStartSlot,
+                                           UBaseType_t * const puxDistance )
+    {
+        uint32_t ulOccupied = pxWheel->ulOccupiedSlots[ uxLevel ];
+        uint32_t ulRotated;
+        UBaseType_t uxDistance, uxSlot;
+        BaseType_t xReturn = pdFALSE;
+
+        while( ulOccupied != 0UL )
+        {
+            /* Rotate the occupied bits so uxStartSlot is bit 0, then the
+             * lowest set bit is the distance to the next occupied slot. */
+            if( uxStartSlot == ( UBaseType_t ) 0U )
+            {
+                ulRotated = ulOccupied;
+            }
+            else
+            {
+                ulRotated = ( ulOccupied >> uxStartSlot ) | ( ulOccupied << ( listWHEEL_SLOTS - uxStartSlot ) );
+            }
+
+            uxDistance = prvLowestSetBit( ulRotated );
+            uxSlot = ( uxStartSlot + uxDistance ) & listWHEEL_SLOT_MASK;
+
+            if( listLIST_IS_EMPTY( listWHEEL_GET_SLOT( pxWheel, ( uxLevel << listWHEEL_SLOT_BITS ) + uxSlot ) ) == pdFALSE )
+            {
+                *puxDistance = uxDistance;
+                xReturn = pdTRUE;
+                break;
+            }
+            else
+            {
+                /* Every item in the slot has been removed since the bit was
+                 * set. */
+                ulOccupied &= ~( 1UL << uxSlot );
+                pxWheel->ulOccupiedSlots[ uxLevel ] = ulOccupied;
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCascadeSlot( ListWheel_t * const pxWheel,
+                                UBaseType_t uxLevel,
+                                UBaseType_t uxSlot )
+    {
+        List_t * const pxSlot = listWHEEL_GET_SLOT( pxWheel, ( uxLevel << listWHEEL_SLOT_BITS ) + uxSlot );
+        ListItem_t * pxItem;
+
+        pxWheel->ulOccupiedSlots[ uxLevel ] &= ~( 1UL << uxSlot );
+
+        while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+        {
+            pxItem = listGET_HEAD_ENTRY( pxSlot );
+            ( void ) uxListRemove( pxItem );
+            vListWheelInsert( pxWheel, pxItem );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vListInitialiseWheel( ListWheel_t * const pxWheel,
+                               TickType_t xStartTime )
+    {
+        UBaseType_t uxIndex;
+
+        for( uxIndex = ( UBaseType_t ) 0U; uxIndex < listWHEEL_TOTAL_SLOTS; uxIndex++ )
+        {
+            vListInitialise( listWHEEL_GET_SLOT( pxWheel, uxIndex ) );
+        }
+
+        for( uxIndex = ( UBaseType_t ) 0U; uxIndex < ( UBaseType_t ) configLIST_WHEEL_LEVELS; uxIndex++ )
+        {
+            pxWheel->ulOccupiedSlots[ uxIndex ] = 0UL;
+        }
+
+        pxWheel->xWheelTime = xStartTime;
+    }
+/*-----------------------------------------------------------*/
+
+    void vListWheelInsert( ListWheel_t * const pxWheel,
+                           ListItem_t * const pxNewListItem )
+    {
+        const TickType_t xExpiryTime = listGET_LIST_ITEM_VALUE( pxNewListItem );
+        const TickType_t xDelta = xExpiryTime - pxWheel->xWheelTime;
+        TickType_t xSlotTime = xExpiryTime;
+        UBaseType_t uxLevel, uxSlot;
+
+        /* Use the lowest level whose span covers the time remaining until the
+         * item expires. */
+        for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( ( UBaseType_t ) configLIST_WHEEL_LEVELS - 1U ); uxLevel++ )
+        {
+            if( ( xDelta >> ( listWHEEL_SLOT_BITS * ( uxLevel + 1U ) ) ) == ( TickType_t ) 0U )
+            {
+                break;
+            }
+        }
+
+        if( xDelta > listWHEEL_MAX_DELTA )
+        {
+            /* Too far ahead for the top level.  File the item in the furthest
+             * slot instead, from which it will be refiled when it cascades. */
+            xSlotTime = pxWheel->xWheelTime + listWHEEL_MAX_DELTA;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        uxSlot = ( UBaseType_t ) ( xSlotTime >> ( listWHEEL_SLOT_BITS * uxLevel ) ) & listWHEEL_SLOT_MASK;
+
+        vListInsertEnd( listWHEEL_GET_SLOT( pxWheel, ( uxLevel << listWHEEL_SLOT_BITS ) + uxSlot ), pxNewListItem );
+        pxWheel->ulOccupiedSlots[ uxLevel ] |= ( 1UL << uxSlot );
+    }
+/*-----------------------------------------------------------*/
+
+    ListItem_t * pxListWheelGetExpired( ListWheel_t * const pxWheel,
+                                        TickType_t xTimeNow )
+    {
+        ListItem_t * pxExpired = NULL;
+        TickType_t xStep, xRemaining, xBoundary;
+        UBaseType_t uxSlot, uxLevel, uxDistance, uxShift;
+        List_t * pxSlot;
+        BaseType_t xWheelEmpty;
+
+        for( ; ; )
+        {
+            /* Everything in the level 0 slot of the wheel time is due. */
+            uxSlot = ( UBaseType_t ) pxWheel->xWheelTime & listWHEEL_SLOT_MASK;
+            pxSlot = listWHEEL_GET_SLOT( pxWheel, uxSlot );
+
+            if( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+            {
+                pxExpired = listGET_HEAD_ENTRY( pxSlot );
+                break;
+            }
+
+            pxWheel->ulOccupiedSlots[ 0 ] &= ~( 1UL << uxSlot );
+
+            if( pxWheel->xWheelTime == xTimeNow )
+            {
+                break;
+            }
+
+            xRemaining = xTimeNow - pxWheel->xWheelTime;
+
+            xWheelEmpty = pdTRUE;
+
+            for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( UBaseType_t ) configLIST_WHEEL_LEVELS; uxLevel++ )
+            {
+                if( pxWheel->ulOccupiedSlots[ uxLevel ] != 0UL )
+                {
+                    xWheelEmpty = pdFALSE;
+                    break;
+                }
+            }
+
+            if( xWheelEmpty != pdFALSE )
+            {
+                /* Nothing to expire or cascade on the way. */
+                pxWheel->xWheelTime = xTimeNow;
+                break;
+            }
+
+            /* Step to whichever comes first out of xTimeNow, the next tick
+             * that has items in level 0, and the next tick at which the lowest
+             * higher level that holds items cascades.  Levels that are empty
+             * need not be cascaded, so a wheel that only holds distant items is
+             * advanced a whole slot of the lowest occupied level at a time. */
+            xStep = xRemaining;
+
+            if( prvFindOccupiedSlot( pxWheel, 0U, ( uxSlot + 1U ) & listWHEEL_SLOT_MASK, &uxDistance ) != pdFALSE )
+            {
+                if( ( TickType_t ) ( uxDistance + 1U ) < xStep )
+                {
+                    xStep = ( TickType_t ) ( uxDistance + 1U );
+                }
+            }
+
+            for( uxLevel = ( UBaseType_t ) 1U; uxLevel < ( UBaseType_t ) configLIST_WHEEL_LEVELS; uxLevel++ )
+            {
+                if( pxWheel->ulOccupiedSlots[ uxLevel ] != 0UL )
+                {
+                    uxShift = listWHEEL_SLOT_BITS * uxLevel;
+
+                    /* A level whose slots are wider than the tick count range
+                     * only cascades when the wheel time wraps to 0. */
+                    if( uxShift < ( UBaseType_t ) ( sizeof( TickType_t ) * 8U ) )
+                    {
+                        xBoundary = ( TickType_t ) ( ( ( TickType_t ) ~pxWheel->xWheelTime ) & ( TickType_t ) ( ( ( TickType_t ) 1U << uxShift ) - 1U ) );
+                    }
+                    else
+                    {
+                        xBoundary = ( TickType_t ) ~pxWheel->xWheelTime;
+                    }
+
+                    if( xBoundary < xStep )
+                    {
+                        xStep = xBoundary + ( TickType_t ) 1U;
+                    }
+
+                    break;
+                }
+            }
+
+            pxWheel->xWheelTime += xStep;
+
+            if( ( ( UBaseType_t ) pxWheel->xWheelTime & listWHEEL_SLOT_MASK ) == ( UBaseType_t ) 0U )
+            {
+                /* Level n cascades each time the slot of level n - 1 wraps
+                 * back to 0. */
+                for( uxLevel = ( UBaseType_t ) 1U; uxLevel < ( UBaseType_t ) configLIST_WHEEL_LEVELS; uxLevel++ )
+                {
+                    uxSlot = ( UBaseType_t ) ( pxWheel->xWheelTime >> ( listWHEEL_SLOT_BITS * uxLevel ) ) & listWHEEL_SLOT_MASK;
+                    prvCascadeSlot( pxWheel, uxLevel, uxSlot );
+
+                    if( uxSlot != ( UBaseType_t ) 0U )
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+
+        return pxExpired;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xListWheelGetNextExpiry( ListWheel_t * const pxWheel,
+                                        TickType_t * const pxNextExpiryTime )
+    {
+        const TickType_t xWheelTime = pxWheel->xWheelTime;
+        TickType_t xEarliest = 0, xSlotStart;
+        UBaseType_t uxLevel, uxShift, uxDistance;
+        BaseType_t xFound = pdFALSE;
+
+        /* Each level 0 slot holds the items that expire on a single tick, so
+         * the first occupied one gives an exact time. */
+        if( prvFindOccupiedSlot( pxWheel, 0U, ( UBaseType_t ) xWheelTime & listWHEEL_SLOT_MASK, &uxDistance ) != pdFALSE )
+        {
+            xEarliest = ( TickType_t ) uxDistance;
+            xFound = pdTRUE;
+        }
+
+        /* On the higher levels a slot spans many ticks.  Rather than search
+         * the items of a slot, which would make the cost of the call depend on
+         * the number of items, use the time at which the first occupied slot of
+         * the level starts, as none of its items expire before then.  That is
+         * also the time at which the slot is cascaded to a lower level, so the
+         * time returned becomes exact once the earliest item reaches level 0.
+         * The slot after the current one starts first, and the current slot
+         * itself last, as it holds the items furthest ahead. */
+        for( uxLevel = ( UBaseType_t ) 1U; uxLevel < ( UBaseType_t ) configLIST_WHEEL_LEVELS; uxLevel++ )
+        {
+            uxShift = listWHEEL_SLOT_BITS * uxLevel;
+
+            if( prvFindOccupiedSlot( pxWheel, uxLevel, ( ( UBaseType_t ) ( xWheelTime >> uxShift ) + 1U ) & listWHEEL_SLOT_MASK, &uxDistance ) != pdFALSE )
+            {
+                xSlotStart = ( TickType_t ) ( ( ( xWheelTime >> uxShift ) + ( TickType_t ) uxDistance + ( TickType_t ) 1U ) << uxShift ) - xWheelTime;
+
+                if( ( xFound == pdFALSE ) || ( xSlotStart < xEarliest ) )
+                {
+                    xEarliest = xSlotStart;
+                    xFound = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        if( xFound != pdFALSE )
+        {
+            *pxNextExpiryTime = xWheelTime + xEarliest;
+        }
+
+        return xFound;
+    }
+
+#endif /* listINCLUDE_WHEEL */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRIORITY_EVENT_LISTS == 1 )
+
+    void vListInitialisePriorityList( PriorityList_t * const pxPriorityList )
+    {
+        UBaseType_t uxPriority;
+
+        pxPriorityList->ulOccupiedPriorities = 0UL;
+
+        for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+        {
+            vListInitialise( &( pxPriorityList->xBuckets[ uxPriority ] ) );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vListPriorityInsert( PriorityList_t * const pxPriorityList,
+                              ListItem_t * const pxNewListItem,
+                              UBaseType_t uxPriority )
+    {
+        configASSERT( uxPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+        /* Nothing is ever read from a bucket with listGET_OWNER_OF_NEXT_ENTRY()
+         * so its index stays at the end marker and listINSERT_END() appends the
+         * item behind those already waiting at the same priority. */
+        listINSERT_END( &( pxPriorityList->xBuckets[ uxPriority ] ), pxNewListItem );
+        pxPriorityList->ulOccupiedPriorities |= ( uint32_t ) 1UL << uxPriority;
+    }
+/*-----------------------------------------------------------*/
+
+    ListItem_t * pxListPriorityGetHighest( PriorityList_t * const pxPriorityList )
+    {
+        ListItem_t * pxHighest = NULL;
+        UBaseType_t uxPriority;
+        List_t * pxBucket;
+
+        while( pxPriorityList->ulOccupiedPriorities != 0UL )
+        {
+            #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+            {
+                portGET_HIGHEST_PRIORITY( uxPriority, pxPriorityList->ulOccupiedPriorities );
+            }
+            #else
+            {
+                uxPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+
+                while( ( pxPriorityList->ulOccupiedPriorities & ( ( uint32_t ) 1UL << uxPriority ) ) == 0UL )
+                {
+                    --uxPriority;
+                }
+            }
+            #endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+            pxBucket = &( pxPriorityList->xBuckets[ uxPriority ] );
+
+            if( listLIST_IS_EMPTY( pxBucket ) == pdFALSE )
+            {
+                pxHighest = listGET_HEAD_ENTRY( pxBucket );
+                break;
+            }
+            else
+            {
+                /* The items in the bucket timed out or were otherwise removed
+                 * with uxListRemove(), so the bit is stale. */
+                pxPriorityList->ulOccupiedPriorities &= ~( ( uint32_t ) 1UL << uxPriority );
+            }
+        }
+
+        return pxHighest;
+    }
+
+#endif /* configUSE_PRIORITY_EVENT_LISTS */
+/*-----------------------------------------------------------*/
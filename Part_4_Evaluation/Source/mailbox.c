@@ -0,0 +1,506 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "mailbox.h"
+
+/* Lint e961, e9021 and e750 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021. */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include mailbox functionality. */
+#if ( configUSE_MAILBOXES == 1 )
+
+/* Bits that can be set in ucFlags. */
+    #define mailboxFLAGS_IS_STATICALLY_ALLOCATED    ( ( uint8_t ) 1 ) /* Set if the mailbox was created using statically allocated memory. */
+
+/* The sequence number is odd while a write is in progress. */
+    #define mailboxWRITE_IN_PROGRESS( ulSequence )    ( ( ( ulSequence ) & ( uint32_t ) 1 ) != ( uint32_t ) 0 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * A writer makes the sequence number odd, copies the new item in, then makes
+ * the sequence number even again.  A reader copies the item out without any
+ * locking and keeps the copy only if the sequence number was even before the
+ * copy and unchanged after it - otherwise the item changed part way through
+ * the copy and the copy may be torn.  Only the few instructions that claim the
+ * mailbox for a writer run with interrupts masked, however large the item.
+ *
+ * A task writes with the scheduler suspended so a higher priority task can
+ * never be left retrying a read while the write it is waiting on cannot
+ * complete.  An interrupt that finds a task part way through a write cannot
+ * wait for it, so its read or write fails instead.
+ */
+    typedef struct MailboxDefinition
+    {
+        volatile uint32_t ulSequence; /*< Twice the number of writes, plus one while a write is in progress. */
+        size_t xItemSize;             /*< The size of the item the mailbox holds. */
+        uint8_t * pucItem;            /*< Points to the mailbox's item. */
+        uint8_t ucFlags;              /*< Holds mailboxFLAGS_IS_STATICALLY_ALLOCATED. */
+    } Mailbox_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called by both the dynamic and static creation functions to fill in the
+ * structure's members.
+ */
+    static void prvInitialiseNewMailbox( Mailbox_t * const pxMailbox,
+                                         uint8_t * const pucItem,
+                                         size_t xItemSize,
+                                         uint8_t ucFlags ) PRIVILEGED_FUNCTION;
+
+/*
+ * Claims the mailbox for writing by making its sequence number odd.  Fails,
+ * leaving the mailbox unchanged, if another write is already in progress,
+ * which can only be the case when called from an interrupt.  Returns the
+ * sequence number to store once the write is complete.
+ */
+    static BaseType_t prvClaimForWrite( Mailbox_t * const pxMailbox,
+                                        uint32_t * const pulNextSequence ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copies the item out of the mailbox once.  Returns pdPASS if the copy is
+ * whole, having returned the number of writes the copy reflects in
+ * *pulSequence, or pdFAIL if the mailbox has never been written or the item
+ * changed during the copy.
+ */
+    static BaseType_t prvTryRead( const Mailbox_t * const pxMailbox,
+                                  void * const pvBuffer,
+                                  uint32_t * const pulSequence ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        MailboxHandle_t xMailboxCreate( size_t xItemSize )
+        {
+            Mailbox_t * pxNewMailbox = NULL;
+
+            configASSERT( xItemSize > ( size_t ) 0 );
+
+            /* Check for addition overflow. */
+            if( ( sizeof( Mailbox_t ) + xItemSize ) > xItemSize )
+            {
+                /* Allocate the structure and the item in one go, with the
+                 * item immediately after the structure. */
+                pxNewMailbox = ( Mailbox_t * ) pvPortMalloc( sizeof( Mailbox_t ) + xItemSize ); /*lint !e9087 !e9079 pvPortMalloc() always ensures returned memory blocks are aligned per the requirements of the MCU stack.  In this case pvPortMalloc() must return a pointer that is guaranteed to meet the alignment requirements of the Mailbox_t structure - which in this case is an int8_t *.  Therefore, whenever the stack alignment requirements are greater than or equal to the pointer to char requirements the cast is safe. */
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxNewMailbox != NULL )
+            {
+                prvInitialiseNewMailbox( pxNewMailbox,
+                                         ( ( uint8_t * ) pxNewMailbox ) + sizeof( Mailbox_t ), /*lint !e9016 Indexing past structure valid for uint8_t pointer. */
+                                         xItemSize,
+                                         ( uint8_t ) 0 );
+            }
+            else
+            {
+                traceMAILBOX_CREATE_FAILED();
+            }
+
+            return pxNewMailbox;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        MailboxHandle_t xMailboxCreateStatic( size_t xItemSize,
+                                              uint8_t * const pucItemStorageArea,
+                                              StaticMailbox_t * const pxStaticMailbox )
+        {
+            Mailbox_t * const pxMailbox = ( Mailbox_t * ) pxStaticMailbox; /*lint !e740 !e9087 Safe cast as StaticMailbox_t is opaque Mailbox_t. */
+            MailboxHandle_t xReturn;
+
+            configASSERT( pucItemStorageArea );
+            configASSERT( pxStaticMailbox );
+            configASSERT( xItemSize > ( size_t ) 0 );
+
+            #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticMailbox_t equals the size of the real
+                 * mailbox structure. */
+                volatile size_t xSize = sizeof( StaticMailbox_t );
+                configASSERT( xSize == sizeof( Mailbox_t ) );
+            } /*lint !e529 xSize is referenced is configASSERT() is defined. */
+            #endif /* configASSERT_DEFINED */
+
+            if( ( pucItemStorageArea != NULL ) && ( pxStaticMailbox != NULL ) )
+            {
+                prvInitialiseNewMailbox( pxMailbox,
+                                         pucItemStorageArea,
+                                         xItemSize,
+                                         mailboxFLAGS_IS_STATICALLY_ALLOCATED );
+
+                xReturn = ( MailboxHandle_t ) pxStaticMailbox; /*lint !e9087 Data hiding requires cast to opaque type. */
+            }
+            else
+            {
+                xReturn = NULL;
+                traceMAILBOX_CREATE_STATIC_FAILED( xReturn );
+            }
+
+            return xReturn;
+        }
+
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    void vMailboxDelete( MailboxHandle_t xMailbox )
+    {
+        Mailbox_t * pxMailbox = xMailbox;
+
+        configASSERT( pxMailbox );
+
+        traceMAILBOX_DELETE( xMailbox );
+
+        if( ( pxMailbox->ucFlags & mailboxFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) pdFALSE )
+        {
+            #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+            {
+                /* Both the structure and the item were allocated using a single
+                 * call to pvPortMalloc(), hence only one call to vPortFree() is
+                 * required. */
+                vPortFree( ( void * ) pxMailbox ); /*lint !e9087 Standard free() semantics require void *, plus pxMailbox was allocated by pvPortMalloc(). */
+            }
+            #else
+            {
+                /* Should not be possible to get here, ucFlags must be corrupt.
+                 * Force an assert. */
+                configASSERT( xMailbox == ( MailboxHandle_t ) ~0 );
+            }
+            #endif
+        }
+        else
+        {
+            /* The structure and item were statically allocated, so just scrub
+             * the structure. */
+            ( void ) memset( pxMailbox, 0x00, sizeof( Mailbox_t ) );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vMailboxWrite( MailboxHandle_t xMailbox,
+                        const void * pvItem )
+    {
+        Mailbox_t * const pxMailbox = xMailbox;
+        uint32_t ulNextSequence;
+        BaseType_t xClaimed;
+
+        configASSERT( pxMailbox );
+        configASSERT( pvItem );
+
+        /* Other tasks cannot run, so cannot see the write part way through,
+         * but interrupts remain enabled for the duration of the copy. */
+        vTaskSuspendAll();
+        {
+            xClaimed = prvClaimForWrite( pxMailbox, &ulNextSequence );
+
+            /* Interrupts always complete their writes before the task they
+             * interrupted runs again, and other tasks cannot run, so the claim
+             * cannot fail. */
+            configASSERT( xClaimed != pdFAIL );
+
+            if( xClaimed != pdFAIL )
+            {
+                ( void ) memcpy( ( void * ) pxMailbox->pucItem, pvItem, pxMailbox->xItemSize ); /*lint !e9087 memcpy() requires void *. */
+
+                /* The item must be complete before the sequence number says
+                 * so. */
+                portMEMORY_BARRIER();
+                pxMailbox->ulSequence = ulNextSequence;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        traceMAILBOX_WRITE( xMailbox );
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xMailboxWriteFromISR( MailboxHandle_t xMailbox,
+                                     const void * pvItem )
+    {
+        Mailbox_t * const pxMailbox = xMailbox;
+        uint32_t ulNextSequence;
+        BaseType_t xReturn;
+
+        configASSERT( pxMailbox );
+        configASSERT( pvItem );
+
+        xReturn = prvClaimForWrite( pxMailbox, &ulNextSequence );
+
+        if( xReturn != pdFAIL )
+        {
+            ( void ) memcpy( ( void * ) pxMailbox->pucItem, pvItem, pxMailbox->xItemSize ); /*lint !e9087 memcpy() requires void *. */
+
+            portMEMORY_BARRIER();
+            pxMailbox->ulSequence = ulNextSequence;
+
+            traceMAILBOX_WRITE_FROM_ISR( xMailbox );
+        }
+        else
+        {
+            traceMAILBOX_WRITE_FROM_ISR_FAILED( xMailbox );
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xMailboxRead( MailboxHandle_t xMailbox,
+                             void * pvBuffer,
+                             uint32_t * pulSequence )
+    {
+        const Mailbox_t * const pxMailbox = xMailbox;
+        uint32_t ulSequence = 0;
+        BaseType_t xReturn = pdFAIL;
+
+        configASSERT( pxMailbox );
+        configASSERT( pvBuffer );
+
+        /* Nothing to read if the mailbox has never been written. */
+        while( pxMailbox->ulSequence != ( uint32_t ) 0 )
+        {
+            if( prvTryRead( pxMailbox, pvBuffer, &ulSequence ) != pdFAIL )
+            {
+                xReturn = pdPASS;
+                break;
+            }
+            else
+            {
+                /* An interrupt wrote to the mailbox during the copy, so try
+                 * again.  The write is already complete as this task is
+                 * running again. */
+                traceMAILBOX_READ_RETRY( xMailbox );
+            }
+        }
+
+        if( xReturn != pdFAIL )
+        {
+            if( pulSequence != NULL )
+            {
+                *pulSequence = ulSequence;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceMAILBOX_READ( xMailbox );
+        }
+        else
+        {
+            traceMAILBOX_READ_FAILED( xMailbox );
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xMailboxReadFromISR( MailboxHandle_t xMailbox,
+                                    void * pvBuffer,
+                                    uint32_t * pulSequence )
+    {
+        const Mailbox_t * const pxMailbox = xMailbox;
+        uint32_t ulSequence;
+        BaseType_t xReturn;
+
+        configASSERT( pxMailbox );
+        configASSERT( pvBuffer );
+
+        /* An interrupt cannot wait for a write it interrupted to complete, so
+         * only tries once. */
+        xReturn = prvTryRead( pxMailbox, pvBuffer, &ulSequence );
+
+        if( xReturn != pdFAIL )
+        {
+            if( pulSequence != NULL )
+            {
+                *pulSequence = ulSequence;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceMAILBOX_READ_FROM_ISR( xMailbox );
+        }
+        else
+        {
+            traceMAILBOX_READ_FROM_ISR_FAILED( xMailbox );
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulMailboxGetSequence( MailboxHandle_t xMailbox )
+    {
+        const Mailbox_t * const pxMailbox = xMailbox;
+
+        configASSERT( pxMailbox );
+
+        /* The number of completed writes. */
+        return pxMailbox->ulSequence >> 1;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xMailboxGetItemSize( MailboxHandle_t xMailbox )
+    {
+        const Mailbox_t * const pxMailbox = xMailbox;
+
+        configASSERT( pxMailbox );
+
+        return pxMailbox->xItemSize;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvInitialiseNewMailbox( Mailbox_t * const pxMailbox,
+                                         uint8_t * const pucItem,
+                                         size_t xItemSize,
+                                         uint8_t ucFlags )
+    {
+        ( void ) memset( ( void * ) pxMailbox, 0x00, sizeof( Mailbox_t ) ); /*lint !e9087 memset() requires void *. */
+
+        pxMailbox->pucItem = pucItem;
+        pxMailbox->xItemSize = xItemSize;
+        pxMailbox->ucFlags = ucFlags;
+
+        traceMAILBOX_CREATE( pxMailbox );
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvClaimForWrite( Mailbox_t * const pxMailbox,
+                                        uint32_t * const pulNextSequence )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        uint32_t ulSequence;
+        BaseType_t xReturn;
+
+        /* Only the read-modify-write of the sequence number needs to be
+         * protected, so this critical section does not grow with the size of
+         * the item.  Once the sequence number is odd no other writer will
+         * touch it until this write completes. */
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            ulSequence = pxMailbox->ulSequence;
+
+            if( mailboxWRITE_IN_PROGRESS( ulSequence ) == pdFALSE )
+            {
+                pxMailbox->ulSequence = ulSequence + ( uint32_t ) 1;
+                ulSequence += ( uint32_t ) 2;
+
+                /* Zero means the mailbox has never been written, so skip it
+                 * when the sequence number wraps. */
+                if( ulSequence == ( uint32_t ) 0 )
+                {
+                    ulSequence = ( uint32_t ) 2;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                *pulNextSequence = ulSequence;
+                xReturn = pdPASS;
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        /* The item must not be modified before the sequence number says it is
+         * being written. */
+        portMEMORY_BARRIER();
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvTryRead( const Mailbox_t * const pxMailbox,
+                                  void * const pvBuffer,
+                                  uint32_t * const pulSequence )
+    {
+        uint32_t ulSequence;
+        BaseType_t xReturn = pdFAIL;
+
+        ulSequence = pxMailbox->ulSequence;
+
+        if( ( ulSequence != ( uint32_t ) 0 ) && ( mailboxWRITE_IN_PROGRESS( ulSequence ) == pdFALSE ) )
+        {
+            portMEMORY_BARRIER();
+            ( void ) memcpy( pvBuffer, ( const void * ) pxMailbox->pucItem, pxMailbox->xItemSize ); /*lint !e9087 memcpy() requires void *. */
+            portMEMORY_BARRIER();
+
+            /* The copy is whole if no write started while it was being made. */
+            if( pxMailbox->ulSequence == ulSequence )
+            {
+                *pulSequence = ulSequence >> 1;
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_MAILBOXES */
@@ -55,6 +55,20 @@
     #define configHEAP_CLEAR_MEMORY_ON_FREE    0
 #endif
 
+#if ( configUSE_HEAP_MAGAZINES == 1 )
+    #ifndef configHEAP_MAGAZINE_TLS_INDEX
+        #error If configUSE_HEAP_MAGAZINES is set to 1 then configHEAP_MAGAZINE_TLS_INDEX must also be defined as the thread local storage pointer index reserved for the magazines.
+    #endif
+
+    #if ( configHEAP_MAGAZINE_TLS_INDEX >= configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+        #error configHEAP_MAGAZINE_TLS_INDEX must be less than configNUM_THREAD_LOCAL_STORAGE_POINTERS.
+    #endif
+
+    #if ( configUSE_HEAP_ACCOUNTING == 1 )
+        #error configUSE_HEAP_MAGAZINES cannot be used with configUSE_HEAP_ACCOUNTING, as a block reused from a magazine is not charged to the task that reuses it.
+    #endif
+#endif
+
 /* Block sizes must not get too small. */
 #define heapMINIMUM_BLOCK_SIZE    ( ( size_t ) ( xHeapStructSize << 1 ) )
 
@@ -80,6 +94,22 @@
 #define heapALLOCATE_BLOCK( pxBlock )            ( ( pxBlock->xBlockSize ) |= heapBLOCK_ALLOCATED_BITMASK )
 #define heapFREE_BLOCK( pxBlock )                ( ( pxBlock->xBlockSize ) &= ~heapBLOCK_ALLOCATED_BITMASK )
 
+#if ( configUSE_HEAP_ACCOUNTING == 1 )
+
+/* Allocations are refused once the calling task's quota would be exceeded. */
+    #define heapQUOTA_ALLOWS( xWantedSize )    xTaskCheckHeapQuota( xWantedSize )
+
+/* The exclusive upper bound of the first histogram bucket. */
+    #define heapHISTOGRAM_FIRST_LIMIT          ( ( size_t ) 32 )
+#else
+    #define heapQUOTA_ALLOWS( xWantedSize )    pdTRUE
+#endif
+
+/* Magazine size class n holds blocks of at least ( heapMAGAZINE_FIRST_CLASS << n )
+ * bytes, including the BlockLink_t structure, and of less than twice that. */
+#define heapMAGAZINE_FIRST_CLASS    ( ( size_t ) 32 )
+#define heapMAGAZINE_LIMIT          ( heapMAGAZINE_FIRST_CLASS << configHEAP_MAGAZINE_CLASSES )
+
 /*-----------------------------------------------------------*/
 
 /* Allocate the memory for the heap. */
@@ -98,6 +128,9 @@ typedef struct A_BLOCK_LINK
 {
     struct A_BLOCK_LINK * pxNextFreeBlock; /*<< The next free block in the list. */
     size_t xBlockSize;                     /*<< The size of the free block. */
+    #if ( configUSE_HEAP_ACCOUNTING == 1 )
+        void * pvOwner;                    /*<< The task charged for the block while it is allocated, or NULL if none. */
+    #endif
 } BlockLink_t;
 
 /*-----------------------------------------------------------*/
@@ -116,6 +149,58 @@ static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) PRIVILEG
  */
 static void prvHeapInit( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Allocates a block from the free list with the scheduler suspended.  Unlike
+ * pvPortMalloc() it neither looks in the calling task's magazine nor calls
+ * the malloc failed hook, so the heap can use it for its own allocations.
+ */
+static void * prvHeapAllocate( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_HEAP_MAGAZINES == 1 )
+
+/*
+ * Each task that allocates small blocks is given a magazine, reached through the
+ * thread local storage pointer at index configHEAP_MAGAZINE_TLS_INDEX, that
+ * caches up to configHEAP_MAGAZINE_DEPTH freed blocks per size class.  Only
+ * the owning task uses its magazine while it runs, so blocks can be taken
+ * from and put into it without suspending the scheduler.  Cached blocks are
+ * still allocated as far as the heap is concerned.
+ */
+    typedef struct A_HEAP_MAGAZINE
+    {
+        UBaseType_t uxCount[ configHEAP_MAGAZINE_CLASSES ];
+        BlockLink_t * pxBlocks[ configHEAP_MAGAZINE_CLASSES ][ configHEAP_MAGAZINE_DEPTH ];
+    } HeapMagazine_t;
+
+/*
+ * Return a cached block large enough for xWantedSize bytes from the calling
+ * task's magazine, or NULL if there is none.
+ */
+    static void * prvMagazineTake( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Cache the block being freed in the calling task's magazine.  Returns pdFALSE
+ * if the block must be returned to the heap instead.
+ */
+    static BaseType_t prvMagazinePut( void * pv ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the magazine size class that holds blocks of xBlockSize bytes.
+ */
+    static UBaseType_t prvMagazineClass( size_t xBlockSize ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_HEAP_ACCOUNTING == 1 )
+
+/*
+ * Returns the index of the histogram bucket that counts blocks of xBlockSize
+ * bytes.
+ */
+    static UBaseType_t prvGetHistogramBucket( size_t xBlockSize ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*-----------------------------------------------------------*/
 
 /* The size of the structure placed at the beginning of each allocated memory
@@ -133,9 +218,66 @@ PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = 0U;
 PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = 0;
 PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = 0;
 
+#if ( configUSE_HEAP_ACCOUNTING == 1 )
+
+/* The first block in the heap, from which vPortHeapForgetOwner() walks every
+ * block in address order. */
+    PRIVILEGED_DATA static BlockLink_t * pxFirstBlock = NULL;
+
+/* The number of allocated blocks in each size bucket, now and since boot. */
+    PRIVILEGED_DATA static size_t xAllocatedBlocks[ configHEAP_HISTOGRAM_BUCKETS ];
+    PRIVILEGED_DATA static size_t xTotalAllocations[ configHEAP_HISTOGRAM_BUCKETS ];
+#endif
+
+#if ( configUSE_HEAP_MAGAZINES == 1 )
+
+/* Set once the heap could not provide a magazine, after which no further
+ * magazines are created. */
+    PRIVILEGED_DATA static BaseType_t xMagazineCreationFailed = pdFALSE;
+#endif
+
 /*-----------------------------------------------------------*/
 
 void * pvPortMalloc( size_t xWantedSize )
+{
+    void * pvReturn = NULL;
+
+    #if ( configUSE_HEAP_MAGAZINES == 1 )
+    {
+        /* Small blocks are first looked for in the calling task's magazine,
+         * which does not need the scheduler to be suspended. */
+        pvReturn = prvMagazineTake( xWantedSize );
+    }
+    #endif
+
+    if( pvReturn == NULL )
+    {
+        pvReturn = prvHeapAllocate( xWantedSize );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+    {
+        if( pvReturn == NULL )
+        {
+            vApplicationMallocFailedHook();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
+
+    configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void * prvHeapAllocate( size_t xWantedSize )
 {
     BlockLink_t * pxBlock;
     BlockLink_t * pxPreviousBlock;
@@ -183,7 +325,9 @@ void * pvPortMalloc( size_t xWantedSize )
          * the kernel, so it must be free. */
         if( heapBLOCK_SIZE_IS_VALID( xWantedSize ) != 0 )
         {
-            if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
+            /* A task that has reached its heap quota fails before the free list
+             * is searched. */
+            if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) && ( heapQUOTA_ALLOWS( xWantedSize ) != pdFALSE ) )
             {
                 /* Traverse the list from the start (lowest address) block until
                  * one of adequate size is found. */
@@ -245,6 +389,14 @@ void * pvPortMalloc( size_t xWantedSize )
 
                     /* The block is being returned - it is allocated and owned
                      * by the application and has no "next" block. */
+                    #if ( configUSE_HEAP_ACCOUNTING == 1 )
+                    {
+                        pxBlock->pvOwner = pvTaskChargeHeapUsage( pxBlock->xBlockSize );
+                        xAllocatedBlocks[ prvGetHistogramBucket( pxBlock->xBlockSize ) ]++;
+                        xTotalAllocations[ prvGetHistogramBucket( pxBlock->xBlockSize ) ]++;
+                    }
+                    #endif
+
                     heapALLOCATE_BLOCK( pxBlock );
                     pxBlock->pxNextFreeBlock = NULL;
                     xNumberOfSuccessfulAllocations++;
@@ -268,20 +420,6 @@ void * pvPortMalloc( size_t xWantedSize )
     }
     ( void ) xTaskResumeAll();
 
-    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
-    {
-        if( pvReturn == NULL )
-        {
-            vApplicationMallocFailedHook();
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
-    }
-    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
-
-    configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
     return pvReturn;
 }
 /*-----------------------------------------------------------*/
@@ -291,6 +429,21 @@ void vPortFree( void * pv )
     uint8_t * puc = ( uint8_t * ) pv;
     BlockLink_t * pxLink;
 
+    #if ( configUSE_HEAP_MAGAZINES == 1 )
+    {
+        /* A small block may be kept in the calling task's magazine for reuse
+         * rather than being returned to the heap. */
+        if( ( pv != NULL ) && ( prvMagazinePut( pv ) != pdFALSE ) )
+        {
+            pv = NULL;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif
+
     if( pv != NULL )
     {
         /* The memory being freed will have an BlockLink_t structure immediately
@@ -321,6 +474,14 @@ void vPortFree( void * pv )
                     /* Add this block to the list of free blocks. */
                     xFreeBytesRemaining += pxLink->xBlockSize;
                     traceFREE( pv, pxLink->xBlockSize );
+
+                    #if ( configUSE_HEAP_ACCOUNTING == 1 )
+                    {
+                        vTaskCreditHeapUsage( pxLink->pvOwner, pxLink->xBlockSize );
+                        xAllocatedBlocks[ prvGetHistogramBucket( pxLink->xBlockSize ) ]--;
+                    }
+                    #endif
+
                     prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
                     xNumberOfSuccessfulFrees++;
                 }
@@ -415,6 +576,12 @@ static void prvHeapInit( void ) /* PRIVILEGED_FUNCTION */
     pxFirstFreeBlock->xBlockSize = ( size_t ) ( uxAddress - ( portPOINTER_SIZE_TYPE ) pxFirstFreeBlock );
     pxFirstFreeBlock->pxNextFreeBlock = pxEnd;
 
+    #if ( configUSE_HEAP_ACCOUNTING == 1 )
+    {
+        pxFirstBlock = pxFirstFreeBlock;
+    }
+    #endif
+
     /* Only one block exists - and it covers the entire usable heap space. */
     xMinimumEverFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
     xFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
@@ -535,3 +702,295 @@ void vPortGetHeapStats( HeapStats_t * pxHeapStats )
     taskEXIT_CRITICAL();
 }
 /*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_ACCOUNTING == 1 )
+
+    void vPortGetHeapHistogram( HeapHistogram_t * pxHeapHistogram )
+    {
+        UBaseType_t uxBucket;
+        size_t xLimit = heapHISTOGRAM_FIRST_LIMIT;
+
+        vTaskSuspendAll();
+        {
+            for( uxBucket = 0; uxBucket < ( UBaseType_t ) configHEAP_HISTOGRAM_BUCKETS; uxBucket++ )
+            {
+                pxHeapHistogram->xBucketLimitInBytes[ uxBucket ] = xLimit;
+                pxHeapHistogram->xAllocatedBlocks[ uxBucket ] = xAllocatedBlocks[ uxBucket ];
+                pxHeapHistogram->xTotalAllocations[ uxBucket ] = xTotalAllocations[ uxBucket ];
+                xLimit <<= 1;
+            }
+
+            pxHeapHistogram->xBucketLimitInBytes[ configHEAP_HISTOGRAM_BUCKETS - 1 ] = heapSIZE_MAX;
+        }
+        ( void ) xTaskResumeAll();
+    }
+
+#endif /* configUSE_HEAP_ACCOUNTING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_ACCOUNTING == 1 )
+
+    void vPortHeapForgetOwner( void * pvOwner )
+    {
+        BlockLink_t * pxBlock;
+
+        vTaskSuspendAll();
+        {
+            /* Nothing can have been allocated if the heap has not been
+             * initialised. */
+            if( pxFirstBlock != NULL )
+            {
+                /* Free and allocated blocks together cover the whole heap, so
+                 * every block can be reached by stepping over each block in
+                 * turn until the end marker is reached. */
+                for( pxBlock = pxFirstBlock; pxBlock != pxEnd; pxBlock = ( void * ) ( ( ( uint8_t * ) pxBlock ) + ( pxBlock->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK ) ) )
+                {
+                    if( ( heapBLOCK_IS_ALLOCATED( pxBlock ) != 0 ) && ( pxBlock->pvOwner == pvOwner ) )
+                    {
+                        pxBlock->pvOwner = NULL;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+    }
+
+#endif /* configUSE_HEAP_ACCOUNTING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_ACCOUNTING == 1 )
+
+    static UBaseType_t prvGetHistogramBucket( size_t xBlockSize ) /* PRIVILEGED_FUNCTION */
+    {
+        UBaseType_t uxBucket = 0;
+        size_t xLimit = heapHISTOGRAM_FIRST_LIMIT;
+
+        while( ( xBlockSize >= xLimit ) && ( uxBucket < ( ( UBaseType_t ) configHEAP_HISTOGRAM_BUCKETS - ( UBaseType_t ) 1 ) ) )
+        {
+            xLimit <<= 1;
+            uxBucket++;
+        }
+
+        return uxBucket;
+    }
+
+#endif /* configUSE_HEAP_ACCOUNTING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_MAGAZINES == 1 )
+
+    static void * prvMagazineTake( size_t xWantedSize ) /* PRIVILEGED_FUNCTION */
+    {
+        HeapMagazine_t * pxMagazine;
+        BlockLink_t * pxBlock = NULL;
+        void * pvReturn = NULL;
+        UBaseType_t uxClass;
+
+        /* Magazines are only used while the scheduler is running, so cached
+         * blocks always belong to the task that is executing, and
+         * vPortHeapReleaseMagazine() can return blocks to the heap by
+         * suspending the scheduler. */
+        if( ( xWantedSize > 0 ) && ( xWantedSize < heapMAGAZINE_LIMIT ) && ( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING ) )
+        {
+            pxMagazine = ( HeapMagazine_t * ) pvTaskGetThreadLocalStoragePointer( NULL, configHEAP_MAGAZINE_TLS_INDEX );
+
+            if( pxMagazine != NULL )
+            {
+                /* Add the same header and alignment overhead as the heap. */
+                xWantedSize += xHeapStructSize + portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK );
+                uxClass = prvMagazineClass( xWantedSize );
+
+                /* The most recently cached block of the class the wanted size
+                 * falls in may be large enough.  Every block of the next class
+                 * up is.  The magazine is only used by this task, but the
+                 * block is popped in a critical section so it cannot be lost
+                 * should another task delete this one part way through. */
+                taskENTER_CRITICAL();
+                {
+                    if( ( pxMagazine->uxCount[ uxClass ] > ( UBaseType_t ) 0 ) &&
+                        ( ( pxMagazine->pxBlocks[ uxClass ][ pxMagazine->uxCount[ uxClass ] - ( UBaseType_t ) 1 ]->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK ) >= xWantedSize ) )
+                    {
+                        pxMagazine->uxCount[ uxClass ]--;
+                        pxBlock = pxMagazine->pxBlocks[ uxClass ][ pxMagazine->uxCount[ uxClass ] ];
+                    }
+                    else if( ( ( uxClass + ( UBaseType_t ) 1 ) < ( UBaseType_t ) configHEAP_MAGAZINE_CLASSES ) && ( pxMagazine->uxCount[ uxClass + ( UBaseType_t ) 1 ] > ( UBaseType_t ) 0 ) )
+                    {
+                        uxClass++;
+                        pxMagazine->uxCount[ uxClass ]--;
+                        pxBlock = pxMagazine->pxBlocks[ uxClass ][ pxMagazine->uxCount[ uxClass ] ];
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                if( pxBlock != NULL )
+                {
+                    pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+                    traceMALLOC( pvReturn, xWantedSize );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else if( xMagazineCreationFailed == pdFALSE )
+            {
+                /* The task's first small allocation creates its magazine, so
+                 * tasks that only free memory, such as the idle task freeing
+                 * deleted tasks, never cache blocks.  The magazine is taken
+                 * straight from the free list, so failing to create it does
+                 * not call the malloc failed hook, and the allocation the
+                 * application asked for is still attempted.  A heap too full
+                 * for one magazine is not asked for another. */
+                vTaskSuspendAll();
+                {
+                    pxMagazine = ( HeapMagazine_t * ) prvHeapAllocate( sizeof( HeapMagazine_t ) );
+
+                    if( pxMagazine != NULL )
+                    {
+                        ( void ) memset( ( void * ) pxMagazine, 0x00, sizeof( HeapMagazine_t ) );
+                        vTaskSetThreadLocalStoragePointer( NULL, configHEAP_MAGAZINE_TLS_INDEX, ( void * ) pxMagazine );
+                    }
+                    else
+                    {
+                        xMagazineCreationFailed = pdTRUE;
+                    }
+                }
+                ( void ) xTaskResumeAll();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pvReturn;
+    }
+
+#endif /* configUSE_HEAP_MAGAZINES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_MAGAZINES == 1 )
+
+    static BaseType_t prvMagazinePut( void * pv ) /* PRIVILEGED_FUNCTION */
+    {
+        HeapMagazine_t * pxMagazine;
+        BlockLink_t * pxLink = ( void * ) ( ( ( uint8_t * ) pv ) - xHeapStructSize );
+        BaseType_t xReturn = pdFALSE;
+        UBaseType_t uxClass;
+        size_t xBlockSize;
+
+        configASSERT( heapBLOCK_IS_ALLOCATED( pxLink ) != 0 );
+        configASSERT( pxLink->pxNextFreeBlock == NULL );
+
+        xBlockSize = pxLink->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK;
+
+        if( ( xBlockSize >= heapMAGAZINE_FIRST_CLASS ) && ( xBlockSize < heapMAGAZINE_LIMIT ) && ( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING ) )
+        {
+            pxMagazine = ( HeapMagazine_t * ) pvTaskGetThreadLocalStoragePointer( NULL, configHEAP_MAGAZINE_TLS_INDEX );
+            uxClass = prvMagazineClass( xBlockSize );
+
+            /* As in prvMagazineTake(), the block is pushed in a critical
+             * section so it is either in the magazine, and returned to the
+             * heap if this task is deleted, or still the caller's. */
+            taskENTER_CRITICAL();
+            {
+                if( ( pxMagazine != NULL ) && ( pxMagazine->uxCount[ uxClass ] < ( UBaseType_t ) configHEAP_MAGAZINE_DEPTH ) )
+                {
+                    pxMagazine->pxBlocks[ uxClass ][ pxMagazine->uxCount[ uxClass ] ] = pxLink;
+                    pxMagazine->uxCount[ uxClass ]++;
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xReturn != pdFALSE )
+            {
+                #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+                {
+                    ( void ) memset( pv, 0, xBlockSize - xHeapStructSize );
+                }
+                #endif
+
+                traceFREE( pv, xBlockSize );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_HEAP_MAGAZINES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_MAGAZINES == 1 )
+
+    static UBaseType_t prvMagazineClass( size_t xBlockSize ) /* PRIVILEGED_FUNCTION */
+    {
+        UBaseType_t uxClass = 0;
+
+        /* The largest class whose lower bound does not exceed xBlockSize. */
+        while( ( ( uxClass + ( UBaseType_t ) 1 ) < ( UBaseType_t ) configHEAP_MAGAZINE_CLASSES ) &&
+               ( xBlockSize >= ( heapMAGAZINE_FIRST_CLASS << ( uxClass + ( UBaseType_t ) 1 ) ) ) )
+        {
+            uxClass++;
+        }
+
+        return uxClass;
+    }
+
+#endif /* configUSE_HEAP_MAGAZINES */
+/*-----------------------------------------------------------*/
+#if ( configUSE_HEAP_MAGAZINES == 1 )
+
+    void vPortHeapReleaseMagazine( void * pvMagazine )
+    {
+        HeapMagazine_t * pxMagazine = ( HeapMagazine_t * ) pvMagazine;
+        UBaseType_t uxClass, uxBlock;
+
+        /* With the scheduler suspended vPortFree() returns the blocks straight
+         * to the heap instead of caching them in the calling task's own
+         * magazine. */
+        vTaskSuspendAll();
+        {
+            for( uxClass = 0; uxClass < ( UBaseType_t ) configHEAP_MAGAZINE_CLASSES; uxClass++ )
+            {
+                for( uxBlock = 0; uxBlock < pxMagazine->uxCount[ uxClass ]; uxBlock++ )
+                {
+                    vPortFree( ( void * ) ( ( ( uint8_t * ) pxMagazine->pxBlocks[ uxClass ][ uxBlock ] ) + xHeapStructSize ) );
+                }
+            }
+
+            vPortFree( pvMagazine );
+        }
+        ( void ) xTaskResumeAll();
+    }
+
+#endif /* configUSE_HEAP_MAGAZINES */
+/*-----------------------------------------------------------*/
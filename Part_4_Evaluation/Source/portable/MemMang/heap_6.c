@@ -0,0 +1,833 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * A sample implementation of pvPortMalloc() and vPortFree() that uses a two
+ * level segregated fit (TLSF) allocator, so both functions complete in a
+ * bounded time that does not depend on the number or the size of the free
+ * blocks.  Like heap_5.c the heap can be spread across multiple
+ * non-contiguous regions, and like heap_4.c and heap_5.c adjacent free blocks
+ * are combined (coalesced) as soon as they are freed.
+ *
+ * Free blocks are kept on a matrix of segregated lists.  The first level
+ * divides block sizes into powers of two, and the second level divides each
+ * power of two into heapSL_INDEX_COUNT equal ranges.  One bitmap per level
+ * records which lists are non-empty, so a list holding a block of adequate
+ * size is found with a couple of bit scans rather than by walking the free
+ * blocks.  Every block also records the block physically before it, so the
+ * neighbours of a block that is being freed are found without a search.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of https://www.FreeRTOS.org
+ * for more information.
+ *
+ * Usage notes:
+ *
+ * vPortDefineHeapRegions() ***must*** be called before pvPortMalloc(), exactly
+ * as when heap_5.c is used, and takes the same NULL zero sized region
+ * terminated array of HeapRegion_t structures.  heap_6.c does not require the
+ * regions to be listed in address order, but accepts arrays that are.
+ *
+ * HeapRegion_t xHeapRegions[] =
+ * {
+ *  { ( uint8_t * ) 0x80000000UL, 0x10000 }, << Defines a block of 0x10000 bytes starting at address 0x80000000
+ *  { ( uint8_t * ) 0x90000000UL, 0xa0000 }, << Defines a block of 0xa0000 bytes starting at address of 0x90000000
+ *  { NULL, 0 }                << Terminates the array.
+ * };
+ *
+ * vPortDefineHeapRegions( xHeapRegions ); << Pass the array into vPortDefineHeapRegions().
+ *
+ */
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+    #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+#ifndef configHEAP_CLEAR_MEMORY_ON_FREE
+    #define configHEAP_CLEAR_MEMORY_ON_FREE    0
+#endif
+
+/* Block sizes must not get too small - a free block has to hold the links
+ * to its neighbours in the free list. */
+#define heapMINIMUM_BLOCK_SIZE    ( ( size_t ) ( ( sizeof( BlockLink_t ) + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) ) )
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE         ( ( size_t ) 8 )
+
+/* Max value that fits in a size_t type. */
+#define heapSIZE_MAX              ( ~( ( size_t ) 0 ) )
+
+/* Check if multiplying a and b will result in overflow. */
+#define heapMULTIPLY_WILL_OVERFLOW( a, b )    ( ( ( a ) > 0 ) && ( ( b ) > ( heapSIZE_MAX / ( a ) ) ) )
+
+/* Check if adding a and b will result in overflow. */
+#define heapADD_WILL_OVERFLOW( a, b )         ( ( a ) > ( heapSIZE_MAX - ( b ) ) )
+
+/* MSB of the xBlockSize member of an BlockLink_t structure is used to track
+ * the allocation status of a block.  When MSB of the xBlockSize member of
+ * an BlockLink_t structure is set then the block belongs to the application.
+ * When the bit is free the block is still part of the free heap space. */
+#define heapBLOCK_ALLOCATED_BITMASK    ( ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 ) )
+#define heapBLOCK_SIZE_IS_VALID( xBlockSize )    ( ( ( xBlockSize ) & heapBLOCK_ALLOCATED_BITMASK ) == 0 )
+#define heapBLOCK_IS_ALLOCATED( pxBlock )        ( ( ( pxBlock->xBlockSize ) & heapBLOCK_ALLOCATED_BITMASK ) != 0 )
+#define heapALLOCATE_BLOCK( pxBlock )            ( ( pxBlock->xBlockSize ) |= heapBLOCK_ALLOCATED_BITMASK )
+#define heapFREE_BLOCK( pxBlock )                ( ( pxBlock->xBlockSize ) &= ~heapBLOCK_ALLOCATED_BITMASK )
+#define heapBLOCK_SIZE( pxBlock )                ( ( pxBlock->xBlockSize ) & ~heapBLOCK_ALLOCATED_BITMASK )
+
+/* The block that physically follows pxBlock in the same region.  The last
+ * block in every region is followed by an end marker that is always marked as
+ * allocated, so is never merged with the block before it. */
+#define heapNEXT_PHYSICAL_BLOCK( pxBlock )       ( ( BlockLink_t * ) ( ( ( uint8_t * ) ( pxBlock ) ) + heapBLOCK_SIZE( pxBlock ) ) )
+
+/* Each power of two range of block sizes is split into heapSL_INDEX_COUNT
+ * second level lists. */
+#define heapSL_INDEX_COUNT_LOG2    ( 4U )
+#define heapSL_INDEX_COUNT         ( ( UBaseType_t ) 1U << heapSL_INDEX_COUNT_LOG2 )
+
+/* Blocks smaller than heapSMALL_BLOCK_SIZE are all held in the first row of
+ * lists, one list per multiple of portBYTE_ALIGNMENT. */
+#if portBYTE_ALIGNMENT == 32
+    #define heapALIGNMENT_LOG2    ( 5U )
+#elif portBYTE_ALIGNMENT == 16
+    #define heapALIGNMENT_LOG2    ( 4U )
+#elif portBYTE_ALIGNMENT == 8
+    #define heapALIGNMENT_LOG2    ( 3U )
+#elif portBYTE_ALIGNMENT == 4
+    #define heapALIGNMENT_LOG2    ( 2U )
+#elif portBYTE_ALIGNMENT == 2
+    #define heapALIGNMENT_LOG2    ( 1U )
+#else
+    #define heapALIGNMENT_LOG2    ( 0U )
+#endif
+
+#define heapFL_INDEX_SHIFT    ( heapSL_INDEX_COUNT_LOG2 + heapALIGNMENT_LOG2 )
+#define heapSMALL_BLOCK_SIZE  ( ( size_t ) 1U << heapFL_INDEX_SHIFT )
+
+/* The largest block is limited so the bitmaps fit in 32 bits and the MSB of
+ * xBlockSize stays free for heapBLOCK_ALLOCATED_BITMASK.  A region larger than
+ * heapMAXIMUM_BLOCK_SIZE is truncated. */
+#if defined( SIZE_MAX ) && ( SIZE_MAX <= 0xFFFFU )
+    #define heapFL_INDEX_MAX    ( 14U )
+#else
+    #define heapFL_INDEX_MAX    ( 30U )
+#endif
+
+/* The first row holds the small blocks, and a block whose most significant set
+ * bit is N is held in row ( N - heapFL_INDEX_SHIFT + 1 ), so the largest block,
+ * with bit heapFL_INDEX_MAX set, needs row ( heapFL_INDEX_MAX -
+ * heapFL_INDEX_SHIFT + 1 ). */
+#define heapFL_INDEX_COUNT       ( ( UBaseType_t ) ( heapFL_INDEX_MAX - heapFL_INDEX_SHIFT + 2U ) )
+#define heapMAXIMUM_BLOCK_SIZE   ( ( ( ( size_t ) 1U << heapFL_INDEX_MAX ) - ( size_t ) 1U ) * ( size_t ) 2U + ( size_t ) 1U )
+
+#if ( ( heapFL_INDEX_MAX - heapFL_INDEX_SHIFT + 2U ) > 32U )
+    #error heap_6.c needs more than 32 first level rows, which do not fit in ulFirstLevelBitmap.
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* Define the block header.  pxPrevPhysicalBlock and xBlockSize are present in
+ * every block.  pxNextFreeBlock and pxPrevFreeBlock are only valid while the
+ * block is free, and occupy the start of the memory returned to the
+ * application while the block is allocated. */
+typedef struct A_BLOCK_LINK
+{
+    struct A_BLOCK_LINK * pxPrevPhysicalBlock; /*<< The block immediately before this one in memory, or NULL if this is the first block in its region. */
+    size_t xBlockSize;                         /*<< The size of the block, including the header. */
+    struct A_BLOCK_LINK * pxNextFreeBlock;     /*<< The next block in the same free list. */
+    struct A_BLOCK_LINK * pxPrevFreeBlock;     /*<< The previous block in the same free list. */
+} BlockLink_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Calculate the first and second level indexes of the free list that holds
+ * blocks of xBlockSize bytes.
+ */
+static void prvMappingInsert( size_t xBlockSize,
+                              UBaseType_t * puxFirstLevel,
+                              UBaseType_t * puxSecondLevel );
+
+/*
+ * Return a free block of at least xWantedSize bytes without removing it from
+ * its free list, or NULL if there is no such block.
+ */
+static BlockLink_t * prvFindSuitableBlock( size_t xWantedSize );
+
+/*
+ * Add a block to, or remove a block from, the free list that matches its
+ * size, updating the bitmaps as the list becomes non-empty or empty.
+ */
+static void prvInsertFreeBlock( BlockLink_t * pxBlock );
+static void prvRemoveFreeBlock( BlockLink_t * pxBlock );
+
+/*
+ * Return the index of the most or least significant set bit in ulValue, which
+ * must not be zero.
+ */
+static UBaseType_t prvFindLastSet( uint32_t ulValue );
+static UBaseType_t prvFindFirstSet( uint32_t ulValue );
+
+/*-----------------------------------------------------------*/
+
+/* The size of the part of the header that remains in allocated blocks, rounded
+ * up so the memory returned to the application is correctly byte aligned. */
+static const size_t xHeapStructSize = ( offsetof( BlockLink_t, pxNextFreeBlock ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* The segregated free lists and the bitmaps that record which are in use. */
+PRIVILEGED_DATA static BlockLink_t * pxFreeLists[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ];
+PRIVILEGED_DATA static uint32_t ulFirstLevelBitmap = 0U;
+PRIVILEGED_DATA static uint32_t ulSecondLevelBitmaps[ heapFL_INDEX_COUNT ];
+
+/* Set once vPortDefineHeapRegions() has been called. */
+PRIVILEGED_DATA static BaseType_t xHeapRegionsDefined = pdFALSE;
+
+/* Keeps track of the number of calls to allocate and free memory as well as the
+ * number of free bytes remaining, but says nothing about fragmentation. */
+PRIVILEGED_DATA static size_t xFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = 0;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = 0;
+
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    BlockLink_t * pxBlock;
+    BlockLink_t * pxNewBlockLink;
+    void * pvReturn = NULL;
+    size_t xAdditionalRequiredSize;
+
+    /* The heap must be initialised before the first call to
+     * pvPortMalloc(). */
+    configASSERT( xHeapRegionsDefined != pdFALSE );
+
+    if( xWantedSize > 0 )
+    {
+        /* The wanted size must be increased so it can contain the block header
+         * in addition to the requested amount of bytes, and rounded up so the
+         * block that follows is also aligned. */
+        xAdditionalRequiredSize = xHeapStructSize + ( ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) ) & portBYTE_ALIGNMENT_MASK );
+
+        if( heapADD_WILL_OVERFLOW( xWantedSize, xAdditionalRequiredSize ) == 0 )
+        {
+            xWantedSize += xAdditionalRequiredSize;
+
+            if( xWantedSize < heapMINIMUM_BLOCK_SIZE )
+            {
+                xWantedSize = heapMINIMUM_BLOCK_SIZE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            xWantedSize = 0;
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    vTaskSuspendAll();
+    {
+        /* Check the block size we are trying to allocate is not so large that it
+         * cannot be held in any free list. */
+        if( ( xWantedSize > 0 ) && ( xWantedSize <= heapMAXIMUM_BLOCK_SIZE ) && ( xWantedSize <= xFreeBytesRemaining ) )
+        {
+            pxBlock = prvFindSuitableBlock( xWantedSize );
+
+            if( pxBlock != NULL )
+            {
+                /* This block is being returned for use so must be taken out of
+                 * its free list. */
+                prvRemoveFreeBlock( pxBlock );
+
+                /* If the block is larger than required it can be split into
+                 * two. */
+                if( ( pxBlock->xBlockSize - xWantedSize ) >= heapMINIMUM_BLOCK_SIZE )
+                {
+                    /* This block is to be split into two.  Create a new block
+                     * following the number of bytes requested. The void cast is
+                     * used to prevent byte alignment warnings from the
+                     * compiler. */
+                    pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+                    configASSERT( ( ( ( size_t ) pxNewBlockLink ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+                    pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+                    pxNewBlockLink->pxPrevPhysicalBlock = pxBlock;
+                    heapNEXT_PHYSICAL_BLOCK( pxNewBlockLink )->pxPrevPhysicalBlock = pxNewBlockLink;
+                    pxBlock->xBlockSize = xWantedSize;
+
+                    prvInsertFreeBlock( pxNewBlockLink );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+                if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+                {
+                    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* The block is being returned - it is allocated and owned by
+                 * the application. */
+                heapALLOCATE_BLOCK( pxBlock );
+                pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+                xNumberOfSuccessfulAllocations++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceMALLOC( pvReturn, xWantedSize );
+    }
+    ( void ) xTaskResumeAll();
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+    {
+        if( pvReturn == NULL )
+        {
+            vApplicationMallocFailedHook();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
+
+    configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    uint8_t * puc = ( uint8_t * ) pv;
+    BlockLink_t * pxLink;
+    BlockLink_t * pxNeighbour;
+
+    if( pv != NULL )
+    {
+        /* The memory being freed will have the block header immediately
+         * before it. */
+        puc -= xHeapStructSize;
+
+        /* This casting is to keep the compiler from issuing warnings. */
+        pxLink = ( void * ) puc;
+
+        configASSERT( heapBLOCK_IS_ALLOCATED( pxLink ) != 0 );
+
+        if( heapBLOCK_IS_ALLOCATED( pxLink ) != 0 )
+        {
+            vTaskSuspendAll();
+            {
+                /* The block is being returned to the heap - it is no longer
+                 * allocated.  This is done with the scheduler suspended so no
+                 * other task can see, and merge with, the block while it is
+                 * marked free but not yet in a free list. */
+                heapFREE_BLOCK( pxLink );
+                #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+                {
+                    ( void ) memset( puc + xHeapStructSize, 0, pxLink->xBlockSize - xHeapStructSize );
+                }
+                #endif
+
+                xFreeBytesRemaining += pxLink->xBlockSize;
+                traceFREE( pv, pxLink->xBlockSize );
+
+                /* Merge with the following block if it is free.  The end marker
+                 * of the region is always marked as allocated. */
+                pxNeighbour = heapNEXT_PHYSICAL_BLOCK( pxLink );
+
+                if( heapBLOCK_IS_ALLOCATED( pxNeighbour ) == 0 )
+                {
+                    prvRemoveFreeBlock( pxNeighbour );
+                    pxLink->xBlockSize += pxNeighbour->xBlockSize;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Merge with the preceding block if it is free. */
+                pxNeighbour = pxLink->pxPrevPhysicalBlock;
+
+                if( ( pxNeighbour != NULL ) && ( heapBLOCK_IS_ALLOCATED( pxNeighbour ) == 0 ) )
+                {
+                    prvRemoveFreeBlock( pxNeighbour );
+                    pxNeighbour->xBlockSize += pxLink->xBlockSize;
+                    pxLink = pxNeighbour;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                heapNEXT_PHYSICAL_BLOCK( pxLink )->pxPrevPhysicalBlock = pxLink;
+                prvInsertFreeBlock( pxLink );
+                xNumberOfSuccessfulFrees++;
+            }
+            ( void ) xTaskResumeAll();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+    return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+    return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+    /* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortCalloc( size_t xNum,
+                     size_t xSize )
+{
+    void * pv = NULL;
+
+    if( heapMULTIPLY_WILL_OVERFLOW( xNum, xSize ) == 0 )
+    {
+        pv = pvPortMalloc( xNum * xSize );
+
+        if( pv != NULL )
+        {
+            ( void ) memset( pv, 0, xNum * xSize );
+        }
+    }
+
+    return pv;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindLastSet( uint32_t ulValue )
+{
+    UBaseType_t uxBit = 0;
+
+    /* A fixed number of steps regardless of the value, so the time taken is
+     * bounded without relying on a count leading zeros instruction. */
+    if( ( ulValue & 0xFFFF0000UL ) != 0UL )
+    {
+        ulValue >>= 16;
+        uxBit += 16U;
+    }
+
+    if( ( ulValue & 0x0000FF00UL ) != 0UL )
+    {
+        ulValue >>= 8;
+        uxBit += 8U;
+    }
+
+    if( ( ulValue & 0x000000F0UL ) != 0UL )
+    {
+        ulValue >>= 4;
+        uxBit += 4U;
+    }
+
+    if( ( ulValue & 0x0000000CUL ) != 0UL )
+    {
+        ulValue >>= 2;
+        uxBit += 2U;
+    }
+
+    if( ( ulValue & 0x00000002UL ) != 0UL )
+    {
+        uxBit += 1U;
+    }
+
+    return uxBit;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindFirstSet( uint32_t ulValue )
+{
+    /* Isolate the least significant set bit. */
+    return prvFindLastSet( ulValue & ( ~ulValue + 1UL ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingInsert( size_t xBlockSize,
+                              UBaseType_t * puxFirstLevel,
+                              UBaseType_t * puxSecondLevel )
+{
+    UBaseType_t uxFirstLevel;
+
+    if( xBlockSize < heapSMALL_BLOCK_SIZE )
+    {
+        /* Small blocks are held in the first row, one list per multiple of
+         * the alignment. */
+        *puxFirstLevel = 0;
+        *puxSecondLevel = ( UBaseType_t ) ( xBlockSize >> heapALIGNMENT_LOG2 );
+    }
+    else
+    {
+        uxFirstLevel = prvFindLastSet( ( uint32_t ) xBlockSize );
+        *puxSecondLevel = ( UBaseType_t ) ( xBlockSize >> ( uxFirstLevel - heapSL_INDEX_COUNT_LOG2 ) ) ^ heapSL_INDEX_COUNT;
+        *puxFirstLevel = uxFirstLevel - ( heapFL_INDEX_SHIFT - 1U );
+    }
+
+    configASSERT( *puxFirstLevel < heapFL_INDEX_COUNT );
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t * prvFindSuitableBlock( size_t xWantedSize )
+{
+    BlockLink_t * pxReturn = NULL;
+    UBaseType_t uxFirstLevel, uxSecondLevel;
+    uint32_t ulFirstLevelMap, ulSecondLevelMap;
+    size_t xSearchSize = xWantedSize;
+
+    /* Round the size up to the start of the next second level range, so that
+     * every block in the list that is found is large enough and only the head
+     * of the list needs to be inspected. */
+    if( xSearchSize >= heapSMALL_BLOCK_SIZE )
+    {
+        xSearchSize += ( ( size_t ) 1U << ( prvFindLastSet( ( uint32_t ) xSearchSize ) - heapSL_INDEX_COUNT_LOG2 ) ) - ( size_t ) 1U;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( xSearchSize <= heapMAXIMUM_BLOCK_SIZE )
+    {
+        prvMappingInsert( xSearchSize, &uxFirstLevel, &uxSecondLevel );
+
+        /* Look for a non-empty list in the same first level row, starting at
+         * the second level index of the wanted size. */
+        ulSecondLevelMap = ulSecondLevelBitmaps[ uxFirstLevel ] & ( ( ~( uint32_t ) 0U ) << uxSecondLevel );
+
+        if( ulSecondLevelMap == 0U )
+        {
+            /* There is none, so use the smallest list of any larger first
+             * level row. */
+            ulFirstLevelMap = ulFirstLevelBitmap & ( ( ~( uint32_t ) 0U ) << ( uxFirstLevel + 1U ) );
+
+            if( ulFirstLevelMap != 0U )
+            {
+                uxFirstLevel = prvFindFirstSet( ulFirstLevelMap );
+                ulSecondLevelMap = ulSecondLevelBitmaps[ uxFirstLevel ];
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( ulSecondLevelMap != 0U )
+        {
+            uxSecondLevel = prvFindFirstSet( ulSecondLevelMap );
+            pxReturn = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( pxReturn == NULL )
+    {
+        /* Rounding up means a block in the list that holds the wanted size
+         * itself is never chosen above, even though it may be large enough.
+         * Before failing, check the head of that list - which keeps the search
+         * bounded and lets the largest free block be allocated. */
+        prvMappingInsert( xWantedSize, &uxFirstLevel, &uxSecondLevel );
+
+        if( ( pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] != NULL ) && ( pxFreeLists[ uxFirstLevel ][ uxSecondLevel ]->xBlockSize >= xWantedSize ) )
+        {
+            pxReturn = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return pxReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( BlockLink_t * pxBlock )
+{
+    UBaseType_t uxFirstLevel, uxSecondLevel;
+    BlockLink_t * pxHead;
+
+    prvMappingInsert( pxBlock->xBlockSize, &uxFirstLevel, &uxSecondLevel );
+
+    pxHead = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+    pxBlock->pxNextFreeBlock = pxHead;
+    pxBlock->pxPrevFreeBlock = NULL;
+
+    if( pxHead != NULL )
+    {
+        pxHead->pxPrevFreeBlock = pxBlock;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] = pxBlock;
+    ulFirstLevelBitmap |= ( uint32_t ) 1U << uxFirstLevel;
+    ulSecondLevelBitmaps[ uxFirstLevel ] |= ( uint32_t ) 1U << uxSecondLevel;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( BlockLink_t * pxBlock )
+{
+    UBaseType_t uxFirstLevel, uxSecondLevel;
+
+    prvMappingInsert( pxBlock->xBlockSize, &uxFirstLevel, &uxSecondLevel );
+
+    if( pxBlock->pxNextFreeBlock != NULL )
+    {
+        pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock->pxPrevFreeBlock;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( pxBlock->pxPrevFreeBlock != NULL )
+    {
+        pxBlock->pxPrevFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+    }
+    else
+    {
+        /* The block was at the head of its list. */
+        configASSERT( pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] == pxBlock );
+        pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] = pxBlock->pxNextFreeBlock;
+
+        if( pxBlock->pxNextFreeBlock == NULL )
+        {
+            /* The list is now empty, as may be the whole first level row. */
+            ulSecondLevelBitmaps[ uxFirstLevel ] &= ~( ( uint32_t ) 1U << uxSecondLevel );
+
+            if( ulSecondLevelBitmaps[ uxFirstLevel ] == 0U )
+            {
+                ulFirstLevelBitmap &= ~( ( uint32_t ) 1U << uxFirstLevel );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+    BlockLink_t * pxFirstFreeBlockInRegion;
+    BlockLink_t * pxEnd;
+    size_t xTotalRegionSize, xTotalHeapSize = 0;
+    BaseType_t xDefinedRegions = 0;
+    portPOINTER_SIZE_TYPE xAddress, xAlignedHeap;
+    const HeapRegion_t * pxHeapRegion;
+
+    /* Can only call once! */
+    configASSERT( xHeapRegionsDefined == pdFALSE );
+
+    pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+
+    while( pxHeapRegion->xSizeInBytes > 0 )
+    {
+        xTotalRegionSize = pxHeapRegion->xSizeInBytes;
+
+        /* Ensure the heap region starts on a correctly aligned boundary. */
+        xAddress = ( portPOINTER_SIZE_TYPE ) pxHeapRegion->pucStartAddress;
+
+        if( ( xAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+        {
+            xAddress += ( portBYTE_ALIGNMENT - 1 );
+            xAddress &= ~portBYTE_ALIGNMENT_MASK;
+
+            /* Adjust the size for the bytes lost to alignment. */
+            xTotalRegionSize -= ( size_t ) ( xAddress - ( portPOINTER_SIZE_TYPE ) pxHeapRegion->pucStartAddress );
+        }
+
+        xAlignedHeap = xAddress;
+
+        /* The region must be able to hold at least one block and the end
+         * marker. */
+        configASSERT( xTotalRegionSize >= ( heapMINIMUM_BLOCK_SIZE + xHeapStructSize + portBYTE_ALIGNMENT ) );
+
+        /* The end marker sits at the end of the region, and the region is
+         * truncated if its single free block would be too large to be held in
+         * a free list. */
+        xAddress = xAlignedHeap + xTotalRegionSize;
+        xAddress -= xHeapStructSize;
+        xAddress &= ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK );
+
+        if( ( size_t ) ( xAddress - xAlignedHeap ) > heapMAXIMUM_BLOCK_SIZE )
+        {
+            xAddress = xAlignedHeap + ( heapMAXIMUM_BLOCK_SIZE & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* To start with there is a single free block in this region that is
+         * sized to take up the entire heap region minus the space taken by the
+         * end marker. */
+        pxFirstFreeBlockInRegion = ( BlockLink_t * ) xAlignedHeap;
+        pxFirstFreeBlockInRegion->xBlockSize = ( size_t ) ( xAddress - xAlignedHeap );
+        pxFirstFreeBlockInRegion->pxPrevPhysicalBlock = NULL;
+        configASSERT( pxFirstFreeBlockInRegion->xBlockSize <= heapMAXIMUM_BLOCK_SIZE );
+
+        pxEnd = ( BlockLink_t * ) xAddress;
+        pxEnd->xBlockSize = 0;
+        pxEnd->pxPrevPhysicalBlock = pxFirstFreeBlockInRegion;
+        heapALLOCATE_BLOCK( pxEnd );
+
+        prvInsertFreeBlock( pxFirstFreeBlockInRegion );
+        xTotalHeapSize += pxFirstFreeBlockInRegion->xBlockSize;
+
+        /* Move onto the next HeapRegion_t structure. */
+        xDefinedRegions++;
+        pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+    }
+
+    xMinimumEverFreeBytesRemaining = xTotalHeapSize;
+    xFreeBytesRemaining = xTotalHeapSize;
+    xHeapRegionsDefined = pdTRUE;
+
+    /* Check something was actually defined before it is accessed. */
+    configASSERT( xTotalHeapSize );
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+{
+    BlockLink_t * pxBlock;
+    size_t xBlocks = 0, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+    UBaseType_t uxFirstLevel, uxSecondLevel;
+
+    vTaskSuspendAll();
+    {
+        /* Unlike allocating and freeing, gathering statistics visits every free
+         * block. */
+        for( uxFirstLevel = 0; uxFirstLevel < heapFL_INDEX_COUNT; uxFirstLevel++ )
+        {
+            for( uxSecondLevel = 0; uxSecondLevel < heapSL_INDEX_COUNT; uxSecondLevel++ )
+            {
+                for( pxBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+                {
+                    /* Increment the number of blocks and record the largest
+                     * and smallest block seen so far. */
+                    xBlocks++;
+
+                    if( pxBlock->xBlockSize > xMaxSize )
+                    {
+                        xMaxSize = pxBlock->xBlockSize;
+                    }
+
+                    if( pxBlock->xBlockSize < xMinSize )
+                    {
+                        xMinSize = pxBlock->xBlockSize;
+                    }
+                }
+            }
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+    pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+    pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+
+    taskENTER_CRITICAL();
+    {
+        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+        pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+        pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,462 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Fixed size block pools that are used alongside one of the heap_n.c files.
+ *
+ * The pools are carved from a single array of configTOTAL_BLOCK_POOL_SIZE
+ * bytes.  Each size class in configBLOCK_POOL_SIZES owns a contiguous region
+ * of that array holding the number of blocks given by the matching entry in
+ * configBLOCK_POOL_COUNTS.  Free blocks are kept on a singly linked list that
+ * is threaded through the blocks themselves, and blocks that have never been
+ * used are handed out by advancing a pointer through the class's region, so
+ * neither allocating nor freeing ever walks a list and no initialisation pass
+ * over the blocks is needed.  A freed block is returned to the class whose
+ * region contains its address, so blocks carry no header.
+ *
+ * Allocation and freeing mask interrupts for the few instructions needed to
+ * pop or push one block, rather than suspending the scheduler, so they can be
+ * used from interrupts.
+ *
+ * See heap_4.c for the general purpose allocator, and the memory management
+ * pages of https://www.FreeRTOS.org for more information.
+ */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include block pool functionality.  This #if is closed at the very bottom
+ * of this file.  If you want to include block pools then ensure
+ * configUSE_BLOCK_POOLS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_BLOCK_POOLS == 1 )
+
+    #ifndef configHEAP_CLEAR_MEMORY_ON_FREE
+        #define configHEAP_CLEAR_MEMORY_ON_FREE    0
+    #endif
+
+/* The number of size classes, taken from the length of configBLOCK_POOL_SIZES. */
+    #define poolNUMBER_OF_CLASSES    ( sizeof( xBlockPoolSizes ) / sizeof( xBlockPoolSizes[ 0 ] ) )
+
+/*-----------------------------------------------------------*/
+
+/* Allocate the memory for the pools. */
+    #if ( configAPPLICATION_ALLOCATED_BLOCK_POOL == 1 )
+
+/* The application writer has already defined the array used for the block
+ * pools - probably so it can be placed in a special segment or address. */
+        extern uint8_t ucBlockPool[ configTOTAL_BLOCK_POOL_SIZE ];
+    #else
+        PRIVILEGED_DATA static uint8_t ucBlockPool[ configTOTAL_BLOCK_POOL_SIZE ];
+    #endif /* configAPPLICATION_ALLOCATED_BLOCK_POOL */
+
+/* A free block holds only the link to the next free block in its class. */
+    typedef struct A_POOL_BLOCK_LINK
+    {
+        struct A_POOL_BLOCK_LINK * pxNextFreeBlock; /*<< The next free block in the same size class. */
+    } PoolBlockLink_t;
+
+/* The state of one size class. */
+    typedef struct A_BLOCK_POOL
+    {
+        PoolBlockLink_t * pxFreeList; /*<< Blocks that have been freed back to the class. */
+        uint8_t * pucFirstBlock;      /*<< The start of the region owned by the class. */
+        uint8_t * pucNextUnused;      /*<< The first block that has never been handed out. */
+        uint8_t * pucEnd;             /*<< One past the end of the region owned by the class. */
+        size_t xBlockSize;            /*<< The size of each block, rounded up for alignment. */
+        size_t xNumberOfBlocks;
+        size_t xNumberOfFreeBlocks;
+        size_t xMinimumEverFreeBlocks;
+        size_t xNumberOfSuccessfulAllocations;
+        size_t xNumberOfSuccessfulFrees;
+    } BlockPool_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called automatically to set up the size classes the first time a block is
+ * allocated.  Only the bounds of each class are calculated, so the time taken
+ * depends on the number of classes, not on the number of blocks.
+ */
+    static void prvBlockPoolInit( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the class whose region contains pv, or NULL if pv is not inside any
+ * class's region.
+ */
+    static BlockPool_t * prvGetBlockPool( const void * pv ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* The size classes and the number of blocks in each, as configured in
+ * FreeRTOSConfig.h. */
+    static const size_t xBlockPoolSizes[] = configBLOCK_POOL_SIZES;
+    static const size_t xBlockPoolCounts[] = configBLOCK_POOL_COUNTS;
+
+    PRIVILEGED_DATA static BlockPool_t xBlockPools[ poolNUMBER_OF_CLASSES ];
+
+/* The aligned bounds of the memory used by the pools.  pucBlockPoolStart is
+ * NULL until the pools have been initialised. */
+    PRIVILEGED_DATA static uint8_t * pucBlockPoolStart = NULL;
+    PRIVILEGED_DATA static uint8_t * pucBlockPoolEnd = NULL;
+
+/*-----------------------------------------------------------*/
+
+    void * pvPortBlockPoolAlloc( size_t xWantedSize )
+    {
+        BlockPool_t * pxPool;
+        PoolBlockLink_t * pxBlock = NULL;
+        UBaseType_t uxSavedInterruptStatus;
+        UBaseType_t uxClass;
+
+        if( xWantedSize > 0 )
+        {
+            uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+            {
+                /* If this is the first call then the class bounds have to be
+                 * calculated. */
+                if( pucBlockPoolStart == NULL )
+                {
+                    prvBlockPoolInit();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* The classes are in ascending order of size, so the first class
+                 * that is large enough and not exhausted is the best fit.  A
+                 * larger class is only used once the best fitting class is
+                 * empty. */
+                for( uxClass = ( UBaseType_t ) 0U; uxClass < ( UBaseType_t ) poolNUMBER_OF_CLASSES; uxClass++ )
+                {
+                    pxPool = &( xBlockPools[ uxClass ] );
+
+                    if( ( pxPool->xBlockSize >= xWantedSize ) && ( pxPool->xNumberOfFreeBlocks > ( size_t ) 0U ) )
+                    {
+                        if( pxPool->pxFreeList != NULL )
+                        {
+                            pxBlock = pxPool->pxFreeList;
+                            pxPool->pxFreeList = pxBlock->pxNextFreeBlock;
+                        }
+                        else
+                        {
+                            /* Every block that has been freed back to the class
+                             * is in use, so take one that has never been used. */
+                            pxBlock = ( void * ) pxPool->pucNextUnused;
+                            pxPool->pucNextUnused += pxPool->xBlockSize;
+                        }
+
+                        pxPool->xNumberOfFreeBlocks--;
+
+                        if( pxPool->xNumberOfFreeBlocks < pxPool->xMinimumEverFreeBlocks )
+                        {
+                            pxPool->xMinimumEverFreeBlocks = pxPool->xNumberOfFreeBlocks;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        pxPool->xNumberOfSuccessfulAllocations++;
+                        break;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceBLOCK_POOL_ALLOC( pxBlock, xWantedSize );
+
+        configASSERT( ( ( ( size_t ) pxBlock ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+        return ( void * ) pxBlock;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortBlockPoolFree( void * pv )
+    {
+        BlockPool_t * pxPool;
+        PoolBlockLink_t * pxBlock = ( PoolBlockLink_t * ) pv;
+        UBaseType_t uxSavedInterruptStatus;
+
+        if( pv != NULL )
+        {
+            /* The pool bounds do not change once set, so the class can be found
+             * before interrupts are masked. */
+            pxPool = prvGetBlockPool( pv );
+
+            /* The block must have come from pvPortBlockPoolAlloc(), so must lie
+             * on a block boundary inside one of the classes. */
+            configASSERT( pxPool != NULL );
+            configASSERT( pxPool == NULL || ( ( ( size_t ) ( ( ( uint8_t * ) pv ) - pxPool->pucFirstBlock ) ) % pxPool->xBlockSize ) == ( size_t ) 0U );
+
+            if( pxPool != NULL )
+            {
+                #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+                {
+                    ( void ) memset( pv, 0, pxPool->xBlockSize );
+                }
+                #endif
+
+                traceBLOCK_POOL_FREE( pv, pxPool->xBlockSize );
+
+                uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+                {
+                    configASSERT( pxPool->xNumberOfFreeBlocks < pxPool->xNumberOfBlocks );
+
+                    pxBlock->pxNextFreeBlock = pxPool->pxFreeList;
+                    pxPool->pxFreeList = pxBlock;
+                    pxPool->xNumberOfFreeBlocks++;
+                    pxPool->xNumberOfSuccessfulFrees++;
+                }
+                portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xPortIsBlockPoolAddress( const void * pv )
+    {
+        const uint8_t * puc = ( const uint8_t * ) pv;
+        BaseType_t xReturn;
+
+        /* pucBlockPoolStart is NULL until the first block is allocated, in which
+         * case nothing can have come from the pools. */
+        if( ( pucBlockPoolStart != NULL ) && ( puc >= pucBlockPoolStart ) && ( puc < pucBlockPoolEnd ) )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxPortGetBlockPoolClassCount( void )
+    {
+        return ( UBaseType_t ) poolNUMBER_OF_CLASSES;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortGetBlockPoolStats( UBaseType_t uxSizeClass,
+                                 BlockPoolStats_t * pxBlockPoolStats )
+    {
+        const BlockPool_t * pxPool;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( uxSizeClass < ( UBaseType_t ) poolNUMBER_OF_CLASSES );
+        configASSERT( pxBlockPoolStats );
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( pucBlockPoolStart == NULL )
+            {
+                prvBlockPoolInit();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxPool = &( xBlockPools[ uxSizeClass ] );
+            pxBlockPoolStats->xBlockSizeInBytes = pxPool->xBlockSize;
+            pxBlockPoolStats->xNumberOfBlocks = pxPool->xNumberOfBlocks;
+            pxBlockPoolStats->xNumberOfFreeBlocks = pxPool->xNumberOfFreeBlocks;
+            pxBlockPoolStats->xMinimumEverFreeBlocks = pxPool->xMinimumEverFreeBlocks;
+            pxBlockPoolStats->xNumberOfSuccessfulAllocations = pxPool->xNumberOfSuccessfulAllocations;
+            pxBlockPoolStats->xNumberOfSuccessfulFrees = pxPool->xNumberOfSuccessfulFrees;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configKERNEL_OBJECTS_FROM_BLOCK_POOLS == 1 )
+
+        void * pvPortMallocObject( size_t xSize )
+        {
+            void * pvReturn;
+
+            /* Kernel objects are only created from tasks, so falling back to
+             * the heap when no class can hold the object is safe. */
+            pvReturn = pvPortBlockPoolAlloc( xSize );
+
+            if( pvReturn == NULL )
+            {
+                pvReturn = pvPortMalloc( xSize );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return pvReturn;
+        }
+
+    #endif /* configKERNEL_OBJECTS_FROM_BLOCK_POOLS */
+/*-----------------------------------------------------------*/
+
+    #if ( configKERNEL_OBJECTS_FROM_BLOCK_POOLS == 1 )
+
+        void vPortFreeObject( void * pv )
+        {
+            if( xPortIsBlockPoolAddress( pv ) != pdFALSE )
+            {
+                vPortBlockPoolFree( pv );
+            }
+            else
+            {
+                vPortFree( pv );
+            }
+        }
+
+    #endif /* configKERNEL_OBJECTS_FROM_BLOCK_POOLS */
+/*-----------------------------------------------------------*/
+
+    static void prvBlockPoolInit( void ) /* PRIVILEGED_FUNCTION */
+    {
+        BlockPool_t * pxPool;
+        uint8_t * pucNextClass;
+        size_t uxAddress;
+        size_t xBlockSize;
+        UBaseType_t uxClass;
+
+        /* There must be one block count for every size class. */
+        configASSERT( sizeof( xBlockPoolCounts ) == sizeof( xBlockPoolSizes ) );
+
+        /* Ensure the pools start on a correctly aligned boundary. */
+        uxAddress = ( size_t ) ucBlockPool;
+
+        if( ( uxAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+        {
+            uxAddress += ( portBYTE_ALIGNMENT - 1 );
+            uxAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+        }
+
+        pucNextClass = ( uint8_t * ) uxAddress;
+        pucBlockPoolStart = pucNextClass;
+
+        for( uxClass = ( UBaseType_t ) 0U; uxClass < ( UBaseType_t ) poolNUMBER_OF_CLASSES; uxClass++ )
+        {
+            pxPool = &( xBlockPools[ uxClass ] );
+
+            /* Each block must be able to hold the free list link, and every
+             * block must stay aligned. */
+            xBlockSize = xBlockPoolSizes[ uxClass ];
+
+            if( xBlockSize < sizeof( PoolBlockLink_t ) )
+            {
+                xBlockSize = sizeof( PoolBlockLink_t );
+            }
+
+            xBlockSize = ( xBlockSize + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+            /* Classes must be listed smallest first so the first class that
+             * fits a request is the best fit. */
+            configASSERT( ( uxClass == ( UBaseType_t ) 0U ) || ( xBlockSize > xBlockPools[ uxClass - ( UBaseType_t ) 1U ].xBlockSize ) );
+
+            pxPool->pxFreeList = NULL;
+            pxPool->pucFirstBlock = pucNextClass;
+            pxPool->pucNextUnused = pucNextClass;
+            pxPool->xBlockSize = xBlockSize;
+            pxPool->xNumberOfBlocks = xBlockPoolCounts[ uxClass ];
+            pxPool->xNumberOfFreeBlocks = pxPool->xNumberOfBlocks;
+            pxPool->xMinimumEverFreeBlocks = pxPool->xNumberOfBlocks;
+            pxPool->xNumberOfSuccessfulAllocations = 0;
+            pxPool->xNumberOfSuccessfulFrees = 0;
+
+            pucNextClass += xBlockSize * pxPool->xNumberOfBlocks;
+            pxPool->pucEnd = pucNextClass;
+        }
+
+        pucBlockPoolEnd = pucNextClass;
+
+        /* configTOTAL_BLOCK_POOL_SIZE must be large enough to hold every block
+         * of every class, allowing for the start of the array being moved up
+         * to an aligned address. */
+        configASSERT( pucBlockPoolEnd <= &( ucBlockPool[ configTOTAL_BLOCK_POOL_SIZE ] ) );
+    }
+/*-----------------------------------------------------------*/
+
+    static BlockPool_t * prvGetBlockPool( const void * pv ) /* PRIVILEGED_FUNCTION */
+    {
+        const uint8_t * puc = ( const uint8_t * ) pv;
+        BlockPool_t * pxReturn = NULL;
+        UBaseType_t uxClass;
+
+        if( xPortIsBlockPoolAddress( pv ) != pdFALSE )
+        {
+            for( uxClass = ( UBaseType_t ) 0U; uxClass < ( UBaseType_t ) poolNUMBER_OF_CLASSES; uxClass++ )
+            {
+                if( puc < xBlockPools[ uxClass ].pucEnd )
+                {
+                    pxReturn = &( xBlockPools[ uxClass ] );
+                    break;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_BLOCK_POOLS == 1 */
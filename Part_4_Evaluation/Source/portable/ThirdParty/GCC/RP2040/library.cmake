@@ -67,3 +67,7 @@ target_link_libraries(FreeRTOS-Kernel-Heap4 INTERFACE FreeRTOS-Kernel)
 add_library(FreeRTOS-Kernel-Heap5 INTERFACE)
 target_sources(FreeRTOS-Kernel-Heap5 INTERFACE ${FREERTOS_KERNEL_PATH}/portable/MemMang/heap_5.c)
 target_link_libraries(FreeRTOS-Kernel-Heap5 INTERFACE FreeRTOS-Kernel)
+
+add_library(FreeRTOS-Kernel-Heap6 INTERFACE)
+target_sources(FreeRTOS-Kernel-Heap6 INTERFACE ${FREERTOS_KERNEL_PATH}/portable/MemMang/heap_6.c)
+target_link_libraries(FreeRTOS-Kernel-Heap6 INTERFACE FreeRTOS-Kernel)
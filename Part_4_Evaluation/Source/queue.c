@@ -42,6 +42,10 @@
     #include "croutine.h"
 #endif
 
+#if ( configUSE_MUTEX_FAST_PATH == 1 )
+    #include "atomic.h"
+#endif
+
 /* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
  * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
  * for the header files above, but not in this file, in order to generate the
@@ -54,6 +58,14 @@
 #define queueLOCKED_UNMODIFIED    ( ( int8_t ) 0 )
 #define queueINT8_MAX             ( ( int8_t ) 127 )
 
+/* Bits used in the ucZeroCopyState structure member. */
+#define queueSEND_RESERVED        ( ( uint8_t ) 0x01U )
+#define queueRECEIVE_ACQUIRED     ( ( uint8_t ) 0x02U )
+
+/* Length given to a queue set that uses a ready list.  The set only counts
+ * events, and the count can never reach this. */
+#define queueSET_READY_LIST_LENGTH    ( ~( ( UBaseType_t ) 0U ) )
+
 /* When the Queue_t structure is used to represent a base queue its pcHead and
  * pcTail members are used as pointers into the queue storage area.  When the
  * Queue_t structure is used to represent a mutex pcHead and pcTail pointers are
@@ -108,8 +120,8 @@ typedef struct QueueDefinition /* The old naming convention is used to prevent b
         SemaphoreData_t xSemaphore; /*< Data required exclusively when this structure is used as a semaphore. */
     } u;
 
-    List_t xTasksWaitingToSend;             /*< List of tasks that are blocked waiting to post onto this queue.  Stored in priority order. */
-    List_t xTasksWaitingToReceive;          /*< List of tasks that are blocked waiting to read from this queue.  Stored in priority order. */
+    EventList_t xTasksWaitingToSend;        /*< List of tasks that are blocked waiting to post onto this queue.  Stored in priority order. */
+    EventList_t xTasksWaitingToReceive;     /*< List of tasks that are blocked waiting to read from this queue.  Stored in priority order. */
 
     volatile UBaseType_t uxMessagesWaiting; /*< The number of items currently in the queue. */
     UBaseType_t uxLength;                   /*< The length of the queue defined as the number of items it will hold, not the number of bytes. */
@@ -122,8 +134,19 @@ typedef struct QueueDefinition /* The old naming convention is used to prevent b
         uint8_t ucStaticallyAllocated; /*< Set to pdTRUE if the memory used by the queue was statically allocated to ensure no attempt is made to free the memory. */
     #endif
 
+    #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+        uint8_t ucZeroCopyState; /*< queueSEND_RESERVED is set while a slot is reserved by xQueueReserveSend(), queueRECEIVE_ACQUIRED while an item is acquired by xQueueAcquireReceive(). */
+    #endif
+
     #if ( configUSE_QUEUE_SETS == 1 )
         struct QueueDefinition * pxQueueSetContainer;
+
+        #if ( configUSE_QUEUE_SET_READY_LIST == 1 )
+            struct QueueDefinition * pxNextReadyMember; /*< In a queue set member, links the member into its set's ready list. */
+            struct QueueDefinition * pxReadyListHead;   /*< In a queue set, the member xQueueSelectFromSet() returns next. */
+            struct QueueDefinition * pxReadyListTail;   /*< In a queue set, the last member in the ready list. */
+            UBaseType_t uxPendingSelects;               /*< In a queue set member, the number of times xQueueSelectFromSet() has yet to return the member. */
+        #endif
     #endif
 
     #if ( configUSE_TRACE_FACILITY == 1 )
@@ -136,6 +159,20 @@ typedef struct QueueDefinition /* The old naming convention is used to prevent b
  * name below to enable the use of older kernel aware debuggers. */
 typedef xQUEUE Queue_t;
 
+/* Tests for whether an item can be sent to a queue at xCopyPosition, and for
+ * whether an item can be received from a queue holding uxMessagesWaiting
+ * items.  A slot held by xQueueReserveSend() or xQueueAcquireReceive() is
+ * not available to other senders or receivers until it is handed back. */
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    #define queueCAN_SEND( pxQueue, xCopyPosition )    ( prvHasSpace( ( pxQueue ), ( xCopyPosition ) ) != pdFALSE )
+    #define queueCAN_RECEIVE( pxQueue, uxMessagesWaiting ) \
+    ( ( ( uxMessagesWaiting ) > ( UBaseType_t ) 0 ) && ( ( ( pxQueue )->ucZeroCopyState & queueRECEIVE_ACQUIRED ) == 0U ) )
+#else
+    #define queueCAN_SEND( pxQueue, xCopyPosition ) \
+    ( ( ( pxQueue )->uxMessagesWaiting < ( pxQueue )->uxLength ) || ( ( xCopyPosition ) == queueOVERWRITE ) )
+    #define queueCAN_RECEIVE( pxQueue, uxMessagesWaiting )    ( ( uxMessagesWaiting ) > ( UBaseType_t ) 0 )
+#endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -183,11 +220,24 @@ static void prvUnlockQueue( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 static BaseType_t prvIsQueueEmpty( const Queue_t * pxQueue ) PRIVILEGED_FUNCTION;
 
 /*
- * Uses a critical section to determine if there is any space in a queue.
+ * Uses a critical section to determine if there is any space in a queue for
+ * an item to be sent at xCopyPosition.
  *
  * @return pdTRUE if there is no space, otherwise pdFALSE;
  */
-static BaseType_t prvIsQueueFull( const Queue_t * pxQueue ) PRIVILEGED_FUNCTION;
+static BaseType_t prvIsQueueFull( const Queue_t * pxQueue,
+                                  const BaseType_t xCopyPosition ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+/*
+ * Determines whether an item can be written at xCopyPosition, taking account
+ * of the slots held by xQueueReserveSend() and xQueueAcquireReceive().  Must be
+ * called from a critical section.
+ */
+    static BaseType_t prvHasSpace( const Queue_t * pxQueue,
+                                   const BaseType_t xCopyPosition ) PRIVILEGED_FUNCTION;
+#endif
 
 /*
  * Copies an item into the queue, either at the front of the queue or the
@@ -203,13 +253,64 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
 static void prvCopyDataFromQueue( Queue_t * const pxQueue,
                                   void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_QUEUE_BATCHING == 1 )
+
+/*
+ * Returns the number of items that can be sent to the back of a queue.  Must
+ * be called from a critical section.
+ */
+    static UBaseType_t prvGetSpacesAvailable( const Queue_t * pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copies uxItemCount items to the back of a queue that has room for them.
+ */
+    static void prvCopyItemsToQueue( Queue_t * const pxQueue,
+                                     const void * pvItems,
+                                     const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copies uxItemCount items out of a queue that holds at least that many.
+ */
+    static void prvCopyItemsFromQueue( Queue_t * const pxQueue,
+                                       void * const pvBuffer,
+                                       const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks the highest priority task waiting to receive from a queue after
+ * uxItemCount items have been sent to it, or notifies the queue set the queue
+ * is a member of.  Returns pdTRUE if a task with a priority higher than the
+ * calling task was unblocked.
+ */
+    static BaseType_t prvNotifyReceiverOfItems( Queue_t * const pxQueue,
+                                                UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
 /*
  * Checks to see if a queue is a member of a queue set, and if so, notifies
  * the queue set that the queue contains data.
  */
-    static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvNotifyQueueSetContainer( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( ( configUSE_QUEUE_SETS == 1 ) && ( configUSE_QUEUE_SET_READY_LIST == 1 ) )
+
+/*
+ * Records one more event for pxMember, linking it onto the end of the queue
+ * set's ready list if it is not already in it.  Must be called from a critical
+ * section.
+ */
+    static void prvAddToReadyList( Queue_t * const pxQueueSet,
+                                   Queue_t * const pxMember ) PRIVILEGED_FUNCTION;
+
+/*
+ * Removes the member at the head of the queue set's ready list and consumes
+ * one of its events.  A member that still has events is moved to the end of
+ * the list so members are selected in turn.  Must be called from a critical
+ * section.
+ */
+    static Queue_t * prvTakeFromReadyList( Queue_t * const pxQueueSet ) PRIVILEGED_FUNCTION;
 #endif
 
 /*
@@ -240,7 +341,23 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
  * other tasks that are waiting for the same mutex.  This function returns
  * that priority.
  */
-    static UBaseType_t prvGetDisinheritPriorityAfterTimeout( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+    static UBaseType_t prvGetDisinheritPriorityAfterTimeout( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_FAST_PATH == 1 ) )
+
+/*
+ * Attempt to take or give an uncontended mutex without entering the kernel's
+ * critical section or running the generic queue send and receive loops.  Both
+ * return pdFAIL, having changed nothing, if the mutex is not in the simple
+ * state the fast path handles, in which case the caller falls back to the
+ * normal path that blocks and implements priority inheritance.
+ * prvMutexGiveFast() sets *pxYieldRequired if the holder disinherited a
+ * priority when the mutex was given.
+ */
+    static BaseType_t prvMutexTakeFast( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvMutexGiveFast( Queue_t * const pxQueue,
+                                        BaseType_t * const pxYieldRequired ) PRIVILEGED_FUNCTION;
 #endif
 /*-----------------------------------------------------------*/
 
@@ -315,6 +432,35 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
             pxQueue->cRxLock = queueUNLOCKED;
             pxQueue->cTxLock = queueUNLOCKED;
 
+            #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+            {
+                pxQueue->ucZeroCopyState = 0U;
+            }
+            #endif
+
+            #if ( ( configUSE_QUEUE_SETS == 1 ) && ( configUSE_QUEUE_SET_READY_LIST == 1 ) )
+            {
+                if( xNewQueue == pdFALSE )
+                {
+                    /* If this is a queue set then its events are discarded, so
+                     * none of its members are pending selection any more. */
+                    while( pxQueue->pxReadyListHead != NULL )
+                    {
+                        pxQueue->pxReadyListHead->uxPendingSelects = ( UBaseType_t ) 0U;
+                        pxQueue->pxReadyListHead = pxQueue->pxReadyListHead->pxNextReadyMember;
+                    }
+                }
+                else
+                {
+                    pxQueue->pxNextReadyMember = NULL;
+                    pxQueue->uxPendingSelects = ( UBaseType_t ) 0U;
+                }
+
+                pxQueue->pxReadyListHead = NULL;
+                pxQueue->pxReadyListTail = NULL;
+            }
+            #endif
+
             if( xNewQueue == pdFALSE )
             {
                 /* If there are tasks blocked waiting to read from the queue, then
@@ -322,7 +468,7 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
                  * will still be empty.  If there are tasks blocked waiting to write to
                  * the queue, then one should be unblocked as after this function exits
                  * it will be possible to write to it. */
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
                 {
                     if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
                     {
@@ -341,8 +487,8 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
             else
             {
                 /* Ensure the event queues start in the correct state. */
-                vListInitialise( &( pxQueue->xTasksWaitingToSend ) );
-                vListInitialise( &( pxQueue->xTasksWaitingToReceive ) );
+                listEVENT_LIST_INITIALISE( &( pxQueue->xTasksWaitingToSend ) );
+                listEVENT_LIST_INITIALISE( &( pxQueue->xTasksWaitingToReceive ) );
             }
         }
         taskEXIT_CRITICAL();
@@ -453,7 +599,7 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
              * are greater than or equal to the pointer to char requirements the cast
              * is safe.  In other cases alignment requirements are not strict (one or
              * two bytes). */
-            pxNewQueue = ( Queue_t * ) pvPortMalloc( sizeof( Queue_t ) + xQueueSizeInBytes ); /*lint !e9087 !e9079 see comment above. */
+            pxNewQueue = ( Queue_t * ) pvPortMallocObject( sizeof( Queue_t ) + xQueueSizeInBytes ); /*lint !e9087 !e9079 see comment above. */
 
             if( pxNewQueue != NULL )
             {
@@ -853,6 +999,37 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
     /*lint -save -e904 This function relaxes the coding standard somewhat to
      * allow return statements within the function itself.  This is done in the
      * interest of execution time efficiency. */
+    #if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_FAST_PATH == 1 ) )
+    {
+        if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+        {
+            xYieldRequired = pdFALSE;
+
+            if( prvMutexGiveFast( pxQueue, &xYieldRequired ) != pdFAIL )
+            {
+                if( xYieldRequired != pdFALSE )
+                {
+                    queueYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                return pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_FAST_PATH == 1 ) ) */
+
     for( ; ; )
     {
         taskENTER_CRITICAL();
@@ -861,7 +1038,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
              * highest priority task wanting to access the queue.  If the head item
              * in the queue is to be overwritten then it does not matter if the
              * queue is full. */
-            if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+            if( queueCAN_SEND( pxQueue, xCopyPosition ) )
             {
                 traceQUEUE_SEND( pxQueue );
 
@@ -896,7 +1073,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                     {
                         /* If there was a task waiting for data to arrive on the
                          * queue then unblock it now. */
-                        if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                        if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                         {
                             if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                             {
@@ -931,7 +1108,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
 
                     /* If there was a task waiting for data to arrive on the
                      * queue then unblock it now. */
-                    if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                    if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                     {
                         if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                         {
@@ -1002,7 +1179,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
         /* Update the timeout state to see if it has expired yet. */
         if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
         {
-            if( prvIsQueueFull( pxQueue ) != pdFALSE )
+            if( prvIsQueueFull( pxQueue, xCopyPosition ) != pdFALSE )
             {
                 traceBLOCKING_ON_QUEUE_SEND( pxQueue );
                 vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
@@ -1080,7 +1257,7 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
      * post). */
     uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
     {
-        if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+        if( queueCAN_SEND( pxQueue, xCopyPosition ) )
         {
             const int8_t cTxLock = pxQueue->cTxLock;
             const UBaseType_t uxPreviousMessagesWaiting = pxQueue->uxMessagesWaiting;
@@ -1130,7 +1307,7 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
                     }
                     else
                     {
-                        if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                        if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                         {
                             if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                             {
@@ -1158,7 +1335,7 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
                 }
                 #else /* configUSE_QUEUE_SETS */
                 {
-                    if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                    if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                     {
                         if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                         {
@@ -1299,7 +1476,7 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue,
                     }
                     else
                     {
-                        if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                        if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                         {
                             if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                             {
@@ -1327,7 +1504,7 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue,
                 }
                 #else /* configUSE_QUEUE_SETS */
                 {
-                    if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                    if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                     {
                         if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                         {
@@ -1408,7 +1585,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
 
             /* Is there data in the queue now?  To be running the calling task
              * must be the highest priority task wanting to access the queue. */
-            if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+            if( queueCAN_RECEIVE( pxQueue, uxMessagesWaiting ) )
             {
                 /* Data available, remove one item. */
                 prvCopyDataFromQueue( pxQueue, pvBuffer );
@@ -1418,7 +1595,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                 /* There is now space in the queue, were any tasks waiting to
                  * post to the queue?  If so, unblock the highest priority waiting
                  * task. */
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
                 {
                     if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
                     {
@@ -1546,6 +1723,19 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
     /*lint -save -e904 This function relaxes the coding standard somewhat to allow return
      * statements within the function itself.  This is done in the interest
      * of execution time efficiency. */
+    #if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_FAST_PATH == 1 ) )
+    {
+        if( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) && ( prvMutexTakeFast( pxQueue ) != pdFAIL ) )
+        {
+            return pdPASS;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_FAST_PATH == 1 ) ) */
+
     for( ; ; )
     {
         taskENTER_CRITICAL();
@@ -1581,7 +1771,7 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
 
                 /* Check to see if other tasks are blocked waiting to give the
                  * semaphore, and if so, unblock the highest priority such task. */
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
                 {
                     if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
                     {
@@ -1777,7 +1967,7 @@ BaseType_t xQueuePeek( QueueHandle_t xQueue,
 
                 /* The data is being left in the queue, so see if there are
                  * any other tasks waiting for the data. */
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                 {
                     if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                     {
@@ -1911,7 +2101,7 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
         const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
 
         /* Cannot block in an ISR, so check there is data available. */
-        if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+        if( queueCAN_RECEIVE( pxQueue, uxMessagesWaiting ) )
         {
             const int8_t cRxLock = pxQueue->cRxLock;
 
@@ -1926,7 +2116,7 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
              * locked. */
             if( cRxLock == queueUNLOCKED )
             {
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
                 {
                     if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
                     {
@@ -2027,161 +2217,1068 @@ BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,
 }
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
-{
-    UBaseType_t uxReturn;
-
-    configASSERT( xQueue );
-
-    taskENTER_CRITICAL();
-    {
-        uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
-    }
-    taskEXIT_CRITICAL();
-
-    return uxReturn;
-} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
-/*-----------------------------------------------------------*/
-
-UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
-{
-    UBaseType_t uxReturn;
-    Queue_t * const pxQueue = xQueue;
-
-    configASSERT( pxQueue );
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
 
-    taskENTER_CRITICAL();
+    BaseType_t xQueueReserveSend( QueueHandle_t xQueue,
+                                  void ** const ppvItem,
+                                  TickType_t xTicksToWait )
     {
-        uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
-    }
-    taskEXIT_CRITICAL();
-
-    return uxReturn;
-} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
-/*-----------------------------------------------------------*/
-
-UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
-{
-    UBaseType_t uxReturn;
-    Queue_t * const pxQueue = xQueue;
-
-    configASSERT( pxQueue );
-    uxReturn = pxQueue->uxMessagesWaiting;
-
-    return uxReturn;
-} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
-/*-----------------------------------------------------------*/
-
-void vQueueDelete( QueueHandle_t xQueue )
-{
-    Queue_t * const pxQueue = xQueue;
-
-    configASSERT( pxQueue );
-    traceQUEUE_DELETE( pxQueue );
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
+        Queue_t * const pxQueue = xQueue;
 
-    #if ( configQUEUE_REGISTRY_SIZE > 0 )
-    {
-        vQueueUnregisterQueue( pxQueue );
-    }
-    #endif
+        configASSERT( pxQueue );
+        configASSERT( ppvItem );
 
-    #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
-    {
-        /* The queue can only have been allocated dynamically - free it
-         * again. */
-        vPortFree( pxQueue );
-    }
-    #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
-    {
-        /* The queue could have been allocated statically or dynamically, so
-         * check before attempting to free the memory. */
-        if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
-        {
-            vPortFree( pxQueue );
-        }
-        else
+        /* There is no slot to hand out if the queue does not store data. */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
         {
-            mtCOVERAGE_TEST_MARKER();
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
         }
-    }
-    #else /* if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) ) */
-    {
-        /* The queue must have been statically allocated, so is not going to be
-         * deleted.  Avoid compiler warnings about the unused parameter. */
-        ( void ) pxQueue;
-    }
-    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
-}
-/*-----------------------------------------------------------*/
-
-#if ( configUSE_TRACE_FACILITY == 1 )
+        #endif
 
-    UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue )
-    {
-        return ( ( Queue_t * ) xQueue )->uxQueueNumber;
-    }
+        /*lint -save -e904 This function relaxes the coding standard somewhat to
+         * allow return statements within the function itself.  This is done in the
+         * interest of execution time efficiency. */
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                /* Is there a free slot at the back of the queue that is not
+                 * already reserved? */
+                if( queueCAN_SEND( pxQueue, queueSEND_TO_BACK ) )
+                {
+                    /* Hand out the slot the next item would have been copied
+                     * into.  The item is not visible to receivers until it is
+                     * committed. */
+                    *ppvItem = pxQueue->pcWriteTo;
+                    pxQueue->ucZeroCopyState |= queueSEND_RESERVED;
 
-#endif /* configUSE_TRACE_FACILITY */
-/*-----------------------------------------------------------*/
+                    taskEXIT_CRITICAL();
+                    return pdPASS;
+                }
+                else
+                {
+                    if( xTicksToWait == ( TickType_t ) 0 )
+                    {
+                        /* The queue was full and no block time is specified (or
+                         * the block time has expired) so leave now. */
+                        taskEXIT_CRITICAL();
+                        traceQUEUE_SEND_FAILED( pxQueue );
+                        return errQUEUE_FULL;
+                    }
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        /* The queue was full and a block time was specified so
+                         * configure the timeout structure. */
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        /* Entry time was already set. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            taskEXIT_CRITICAL();
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+            /* Interrupts and other tasks can send to and receive from the queue
+             * now the critical section has been exited. */
 
-    void vQueueSetQueueNumber( QueueHandle_t xQueue,
-                               UBaseType_t uxQueueNumber )
-    {
-        ( ( Queue_t * ) xQueue )->uxQueueNumber = uxQueueNumber;
-    }
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
 
-#endif /* configUSE_TRACE_FACILITY */
-/*-----------------------------------------------------------*/
+            /* Update the timeout state to see if it has expired yet. */
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( prvIsQueueFull( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+                {
+                    traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        portYIELD_WITHIN_API();
+                    }
+                }
+                else
+                {
+                    /* Try again. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* The timeout has expired. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
 
-    uint8_t ucQueueGetQueueType( QueueHandle_t xQueue )
-    {
-        return ( ( Queue_t * ) xQueue )->ucQueueType;
+                traceQUEUE_SEND_FAILED( pxQueue );
+                return errQUEUE_FULL;
+            }
+        } /*lint -restore */
     }
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* configUSE_QUEUE_ZERO_COPY */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
 
-    static UBaseType_t prvGetDisinheritPriorityAfterTimeout( const Queue_t * const pxQueue )
+    BaseType_t xQueueCommitSend( QueueHandle_t xQueue )
     {
-        UBaseType_t uxHighestPriorityOfWaitingTasks;
+        BaseType_t xReturn;
+        Queue_t * const pxQueue = xQueue;
 
-        /* If a task waiting for a mutex causes the mutex holder to inherit a
-         * priority, but the waiting task times out, then the holder should
-         * disinherit the priority - but only down to the highest priority of any
-         * other tasks that are waiting for the same mutex.  For this purpose,
-         * return the priority of the highest priority task that is waiting for the
-         * mutex. */
-        if( listCURRENT_LIST_LENGTH( &( pxQueue->xTasksWaitingToReceive ) ) > 0U )
-        {
-            uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxQueue->xTasksWaitingToReceive ) );
-        }
-        else
-        {
-            uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
-        }
+        configASSERT( pxQueue );
 
-        return uxHighestPriorityOfWaitingTasks;
-    }
+        taskENTER_CRITICAL();
+        {
+            /* Only a slot obtained from xQueueReserveSend() can be committed. */
+            configASSERT( ( pxQueue->ucZeroCopyState & queueSEND_RESERVED ) != 0U );
 
-#endif /* configUSE_MUTEXES */
-/*-----------------------------------------------------------*/
+            if( ( pxQueue->ucZeroCopyState & queueSEND_RESERVED ) != 0U )
+            {
+                pxQueue->ucZeroCopyState &= ( uint8_t ) ~queueSEND_RESERVED;
 
-static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
-                                      const void * pvItemToQueue,
-                                      const BaseType_t xPosition )
-{
-    BaseType_t xReturn = pdFALSE;
-    UBaseType_t uxMessagesWaiting;
+                traceQUEUE_SEND( pxQueue );
 
-    /* This function is called from a critical section. */
+                /* The item was written in place, so only the write position and
+                 * the item count need updating, exactly as prvCopyDataToQueue()
+                 * does for an item sent to the back of the queue. */
+                pxQueue->pcWriteTo += pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
 
-    uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+                if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+                {
+                    pxQueue->pcWriteTo = pxQueue->pcHead;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxQueue->uxMessagesWaiting = pxQueue->uxMessagesWaiting + ( UBaseType_t ) 1;
+
+                #if ( configUSE_QUEUE_SETS == 1 )
+                    if( pxQueue->pxQueueSetContainer != NULL )
+                    {
+                        if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                        {
+                            queueYIELD_IF_USING_PREEMPTION();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                #endif /* configUSE_QUEUE_SETS */
+                {
+                    /* If there was a task waiting for data to arrive on the queue
+                     * then unblock it now. */
+                    if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                    {
+                        if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                        {
+                            queueYIELD_IF_USING_PREEMPTION();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+
+                /* Senders found the queue full while the slot was reserved.  If
+                 * there is still room then let the highest priority of them try
+                 * again. */
+                if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) &&
+                    ( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE ) )
+                {
+                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+    BaseType_t xQueueAcquireReceive( QueueHandle_t xQueue,
+                                     void ** const ppvItem,
+                                     TickType_t xTicksToWait )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
+        Queue_t * const pxQueue = xQueue;
+
+        configASSERT( pxQueue );
+        configASSERT( ppvItem );
+
+        /* There is no item to hand out if the queue does not store data. */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        /*lint -save -e904  This function relaxes the coding standard somewhat to
+         * allow return statements within the function itself.  This is done in the
+         * interest of execution time efficiency. */
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+                if( queueCAN_RECEIVE( pxQueue, uxMessagesWaiting ) )
+                {
+                    /* Advance the read position as prvCopyDataFromQueue()
+                     * would, but hand out the slot instead of copying from it.
+                     * The slot is not reused until the item is released, so no
+                     * sender is unblocked yet. */
+                    pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+
+                    if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+                    {
+                        pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    *ppvItem = pxQueue->u.xQueue.pcReadFrom;
+                    traceQUEUE_RECEIVE( pxQueue );
+                    pxQueue->uxMessagesWaiting = uxMessagesWaiting - ( UBaseType_t ) 1;
+                    pxQueue->ucZeroCopyState |= queueRECEIVE_ACQUIRED;
+
+                    taskEXIT_CRITICAL();
+                    return pdPASS;
+                }
+                else
+                {
+                    if( xTicksToWait == ( TickType_t ) 0 )
+                    {
+                        /* The queue was empty and no block time is specified (or
+                         * the block time has expired) so leave now. */
+                        taskEXIT_CRITICAL();
+                        traceQUEUE_RECEIVE_FAILED( pxQueue );
+                        return errQUEUE_EMPTY;
+                    }
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        /* The queue was empty and a block time was specified so
+                         * configure the timeout structure. */
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        /* Entry time was already set. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            /* Interrupts and other tasks can send to and receive from the queue
+             * now the critical section has been exited. */
+
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            /* Update the timeout state to see if it has expired yet. */
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+                {
+                    traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        portYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    /* The queue contains data again.  Loop back to try and
+                     * acquire it. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* Timed out.  If there is no data in the queue exit, otherwise
+                 * loop back and attempt to acquire the data. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+
+                if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+                {
+                    traceQUEUE_RECEIVE_FAILED( pxQueue );
+                    return errQUEUE_EMPTY;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        } /*lint -restore */
+    }
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+    BaseType_t xQueueReleaseReceive( QueueHandle_t xQueue )
+    {
+        BaseType_t xReturn;
+        Queue_t * const pxQueue = xQueue;
+
+        configASSERT( pxQueue );
+
+        taskENTER_CRITICAL();
+        {
+            /* Only an item obtained from xQueueAcquireReceive() can be
+             * released. */
+            configASSERT( ( pxQueue->ucZeroCopyState & queueRECEIVE_ACQUIRED ) != 0U );
+
+            if( ( pxQueue->ucZeroCopyState & queueRECEIVE_ACQUIRED ) != 0U )
+            {
+                pxQueue->ucZeroCopyState &= ( uint8_t ) ~queueRECEIVE_ACQUIRED;
+
+                /* The slot is free again, were any tasks waiting to post to the
+                 * queue?  If so, unblock the highest priority waiting task. */
+                if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                {
+                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Receivers found the queue empty while the item was held.  If
+                 * more items have arrived since then let the highest priority of
+                 * them try again. */
+                if( ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) &&
+                    ( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE ) )
+                {
+                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_BATCHING == 1 )
+
+    size_t xQueueSendMultiple( QueueHandle_t xQueue,
+                               const void * pvItems,
+                               size_t xItemCount,
+                               TickType_t xTicksToWait )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
+        UBaseType_t uxItemsToSend;
+        Queue_t * const pxQueue = xQueue;
+
+        configASSERT( pxQueue );
+        configASSERT( !( ( pvItems == NULL ) && ( xItemCount != ( size_t ) 0 ) ) );
+
+        /* Semaphores and mutexes do not store items. */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        if( xItemCount == ( size_t ) 0 )
+        {
+            return ( size_t ) 0;
+        }
+
+        /*lint -save -e904 This function relaxes the coding standard somewhat to
+         * allow return statements within the function itself.  This is done in the
+         * interest of execution time efficiency. */
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                uxItemsToSend = prvGetSpacesAvailable( pxQueue );
+
+                /* Is there room for at least one item now?  As many of the
+                 * items as fit are sent in one go. */
+                if( uxItemsToSend > ( UBaseType_t ) 0 )
+                {
+                    if( xItemCount < ( size_t ) uxItemsToSend )
+                    {
+                        uxItemsToSend = ( UBaseType_t ) xItemCount;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    traceQUEUE_SEND( pxQueue );
+                    prvCopyItemsToQueue( pxQueue, pvItems, uxItemsToSend );
+
+                    if( prvNotifyReceiverOfItems( pxQueue, uxItemsToSend ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    taskEXIT_CRITICAL();
+                    return ( size_t ) uxItemsToSend;
+                }
+                else
+                {
+                    if( xTicksToWait == ( TickType_t ) 0 )
+                    {
+                        /* The queue was full and no block time is specified (or
+                         * the block time has expired) so leave now. */
+                        taskEXIT_CRITICAL();
+                        traceQUEUE_SEND_FAILED( pxQueue );
+                        return ( size_t ) 0;
+                    }
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        /* The queue was full and a block time was specified so
+                         * configure the timeout structure. */
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        /* Entry time was already set. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            /* Interrupts and other tasks can send to and receive from the queue
+             * now the critical section has been exited. */
+
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            /* Update the timeout state to see if it has expired yet. */
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( prvIsQueueFull( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+                {
+                    traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        portYIELD_WITHIN_API();
+                    }
+                }
+                else
+                {
+                    /* Try again. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* The timeout has expired. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+
+                traceQUEUE_SEND_FAILED( pxQueue );
+                return ( size_t ) 0;
+            }
+        } /*lint -restore */
+    }
+
+#endif /* configUSE_QUEUE_BATCHING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_BATCHING == 1 )
+
+    size_t xQueueSendMultipleFromISR( QueueHandle_t xQueue,
+                                      const void * pvItems,
+                                      size_t xItemCount,
+                                      BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxItemsToSend;
+        UBaseType_t uxSavedInterruptStatus;
+        Queue_t * const pxQueue = xQueue;
+
+        configASSERT( pxQueue );
+        configASSERT( !( ( pvItems == NULL ) && ( xItemCount != ( size_t ) 0 ) ) );
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+        /* See the comment in xQueueGenericSendFromISR(). */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            uxItemsToSend = prvGetSpacesAvailable( pxQueue );
+
+            if( xItemCount < ( size_t ) uxItemsToSend )
+            {
+                uxItemsToSend = ( UBaseType_t ) xItemCount;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( uxItemsToSend > ( UBaseType_t ) 0 )
+            {
+                traceQUEUE_SEND_FROM_ISR( pxQueue );
+                prvCopyItemsToQueue( pxQueue, pvItems, uxItemsToSend );
+
+                /* The event list is not altered if the queue is locked.  This
+                 * will be done when the queue is unlocked later. */
+                if( pxQueue->cTxLock == queueUNLOCKED )
+                {
+                    if( prvNotifyReceiverOfItems( pxQueue, uxItemsToSend ) != pdFALSE )
+                    {
+                        if( pxHigherPriorityTaskWoken != NULL )
+                        {
+                            *pxHigherPriorityTaskWoken = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    /* Increment the lock count so the task that unlocks the
+                     * queue knows that data was posted while it was locked.
+                     * Once is enough to unblock a receiver, but a queue set
+                     * must be notified of every item. */
+                    UBaseType_t uxLockIncrements = ( UBaseType_t ) 1;
+
+                    #if ( configUSE_QUEUE_SETS == 1 )
+                    {
+                        if( pxQueue->pxQueueSetContainer != NULL )
+                        {
+                            uxLockIncrements = uxItemsToSend;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    #endif /* configUSE_QUEUE_SETS */
+
+                    while( uxLockIncrements > ( UBaseType_t ) 0 )
+                    {
+                        const int8_t cTxLock = pxQueue->cTxLock;
+
+                        prvIncrementQueueTxLock( pxQueue, cTxLock );
+                        uxLockIncrements--;
+                    }
+                }
+            }
+            else
+            {
+                traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return ( size_t ) uxItemsToSend;
+    }
+
+#endif /* configUSE_QUEUE_BATCHING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_BATCHING == 1 )
+
+    size_t xQueueReceiveMultiple( QueueHandle_t xQueue,
+                                  void * const pvBuffer,
+                                  size_t xBufferItems,
+                                  TickType_t xTicksToWait )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
+        UBaseType_t uxItemsToReceive;
+        Queue_t * const pxQueue = xQueue;
+
+        configASSERT( pxQueue );
+        configASSERT( !( ( pvBuffer == NULL ) && ( xBufferItems != ( size_t ) 0 ) ) );
+
+        /* Semaphores and mutexes do not store items. */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        if( xBufferItems == ( size_t ) 0 )
+        {
+            return ( size_t ) 0;
+        }
+
+        /*lint -save -e904  This function relaxes the coding standard somewhat to
+         * allow return statements within the function itself.  This is done in the
+         * interest of execution time efficiency. */
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+                /* Is there data in the queue now?  As many items as fit in the
+                 * buffer are removed in one go. */
+                if( queueCAN_RECEIVE( pxQueue, uxMessagesWaiting ) )
+                {
+                    uxItemsToReceive = uxMessagesWaiting;
+
+                    if( xBufferItems < ( size_t ) uxItemsToReceive )
+                    {
+                        uxItemsToReceive = ( UBaseType_t ) xBufferItems;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    prvCopyItemsFromQueue( pxQueue, pvBuffer, uxItemsToReceive );
+                    traceQUEUE_RECEIVE( pxQueue );
+                    pxQueue->uxMessagesWaiting = uxMessagesWaiting - uxItemsToReceive;
+
+                    /* There is now space in the queue.  Only the highest
+                     * priority task waiting to post to the queue is unblocked,
+                     * however many items were removed. */
+                    if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                    {
+                        if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                        {
+                            queueYIELD_IF_USING_PREEMPTION();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    taskEXIT_CRITICAL();
+                    return ( size_t ) uxItemsToReceive;
+                }
+                else
+                {
+                    if( xTicksToWait == ( TickType_t ) 0 )
+                    {
+                        /* The queue was empty and no block time is specified (or
+                         * the block time has expired) so leave now. */
+                        taskEXIT_CRITICAL();
+                        traceQUEUE_RECEIVE_FAILED( pxQueue );
+                        return ( size_t ) 0;
+                    }
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        /* The queue was empty and a block time was specified so
+                         * configure the timeout structure. */
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        /* Entry time was already set. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            /* Interrupts and other tasks can send to and receive from the queue
+             * now the critical section has been exited. */
+
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            /* Update the timeout state to see if it has expired yet. */
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+                {
+                    traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        portYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    /* The queue contains data again.  Loop back to try and read
+                     * the data. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* Timed out.  If there is no data in the queue exit, otherwise
+                 * loop back and attempt to read the data. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+
+                if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+                {
+                    traceQUEUE_RECEIVE_FAILED( pxQueue );
+                    return ( size_t ) 0;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        } /*lint -restore */
+    }
+
+#endif /* configUSE_QUEUE_BATCHING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_BATCHING == 1 )
+
+    size_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue,
+                                         void * const pvBuffer,
+                                         size_t xBufferItems,
+                                         BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxItemsToReceive = ( UBaseType_t ) 0;
+        UBaseType_t uxSavedInterruptStatus;
+        Queue_t * const pxQueue = xQueue;
+
+        configASSERT( pxQueue );
+        configASSERT( !( ( pvBuffer == NULL ) && ( xBufferItems != ( size_t ) 0 ) ) );
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+        /* See the comment in xQueueGenericSendFromISR(). */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+            /* Cannot block in an ISR, so check there is data available. */
+            if( queueCAN_RECEIVE( pxQueue, uxMessagesWaiting ) && ( xBufferItems != ( size_t ) 0 ) )
+            {
+                const int8_t cRxLock = pxQueue->cRxLock;
+
+                uxItemsToReceive = uxMessagesWaiting;
+
+                if( xBufferItems < ( size_t ) uxItemsToReceive )
+                {
+                    uxItemsToReceive = ( UBaseType_t ) xBufferItems;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+
+                prvCopyItemsFromQueue( pxQueue, pvBuffer, uxItemsToReceive );
+                pxQueue->uxMessagesWaiting = uxMessagesWaiting - uxItemsToReceive;
+
+                /* If the queue is locked the event list will not be modified.
+                 * Instead update the lock count so the task that unlocks the
+                 * queue will know that an ISR has removed data while the queue
+                 * was locked. */
+                if( cRxLock == queueUNLOCKED )
+                {
+                    if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                    {
+                        if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                        {
+                            /* The task waiting has a higher priority than us so
+                             * force a context switch. */
+                            if( pxHigherPriorityTaskWoken != NULL )
+                            {
+                                *pxHigherPriorityTaskWoken = pdTRUE;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    /* Increment the lock count so the task that unlocks the queue
+                     * knows that data was removed while it was locked. */
+                    prvIncrementQueueRxLock( pxQueue, cRxLock );
+                }
+            }
+            else
+            {
+                traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return ( size_t ) uxItemsToReceive;
+    }
+
+#endif /* configUSE_QUEUE_BATCHING */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+
+    configASSERT( xQueue );
+
+    taskENTER_CRITICAL();
+    {
+        uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
+    }
+    taskEXIT_CRITICAL();
+
+    return uxReturn;
+} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+    Queue_t * const pxQueue = xQueue;
+
+    configASSERT( pxQueue );
+
+    taskENTER_CRITICAL();
+    {
+        uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+    }
+    taskEXIT_CRITICAL();
+
+    return uxReturn;
+} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+    Queue_t * const pxQueue = xQueue;
+
+    configASSERT( pxQueue );
+    uxReturn = pxQueue->uxMessagesWaiting;
+
+    return uxReturn;
+} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+void vQueueDelete( QueueHandle_t xQueue )
+{
+    Queue_t * const pxQueue = xQueue;
+
+    configASSERT( pxQueue );
+    traceQUEUE_DELETE( pxQueue );
+
+    #if ( configQUEUE_REGISTRY_SIZE > 0 )
+    {
+        vQueueUnregisterQueue( pxQueue );
+    }
+    #endif
+
+    #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+    {
+        /* The queue can only have been allocated dynamically - free it
+         * again. */
+        vPortFreeObject( pxQueue );
+    }
+    #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    {
+        /* The queue could have been allocated statically or dynamically, so
+         * check before attempting to free the memory. */
+        if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+        {
+            vPortFreeObject( pxQueue );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #else /* if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) ) */
+    {
+        /* The queue must have been statically allocated, so is not going to be
+         * deleted.  Avoid compiler warnings about the unused parameter. */
+        ( void ) pxQueue;
+    }
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue )
+    {
+        return ( ( Queue_t * ) xQueue )->uxQueueNumber;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    void vQueueSetQueueNumber( QueueHandle_t xQueue,
+                               UBaseType_t uxQueueNumber )
+    {
+        ( ( Queue_t * ) xQueue )->uxQueueNumber = uxQueueNumber;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    uint8_t ucQueueGetQueueType( QueueHandle_t xQueue )
+    {
+        return ( ( Queue_t * ) xQueue )->ucQueueType;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+    static UBaseType_t prvGetDisinheritPriorityAfterTimeout( Queue_t * const pxQueue )
+    {
+        UBaseType_t uxHighestPriorityOfWaitingTasks;
+
+        /* If a task waiting for a mutex causes the mutex holder to inherit a
+         * priority, but the waiting task times out, then the holder should
+         * disinherit the priority - but only down to the highest priority of any
+         * other tasks that are waiting for the same mutex.  For this purpose,
+         * return the priority of the highest priority task that is waiting for the
+         * mutex. */
+        if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+        {
+            uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_LIST_ITEM_VALUE( listEVENT_LIST_GET_HEAD_ENTRY( &( pxQueue->xTasksWaitingToReceive ) ) );
+        }
+        else
+        {
+            uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
+        }
+
+        return uxHighestPriorityOfWaitingTasks;
+    }
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
+                                      const void * pvItemToQueue,
+                                      const BaseType_t xPosition )
+{
+    BaseType_t xReturn = pdFALSE;
+    UBaseType_t uxMessagesWaiting;
+
+    /* This function is called from a critical section. */
+
+    uxMessagesWaiting = pxQueue->uxMessagesWaiting;
 
     if( pxQueue->uxItemSize == ( UBaseType_t ) 0 )
     {
@@ -2245,35 +3342,191 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
         }
         else
         {
-            mtCOVERAGE_TEST_MARKER();
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    pxQueue->uxMessagesWaiting = uxMessagesWaiting + ( UBaseType_t ) 1;
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyDataFromQueue( Queue_t * const pxQueue,
+                                  void * const pvBuffer )
+{
+    if( pxQueue->uxItemSize != ( UBaseType_t ) 0 )
+    {
+        pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;           /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+
+        if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+        {
+            pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports.  Also previous logic ensures a null pointer can only be passed to memcpy() when the count is 0.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_BATCHING == 1 )
+
+    static UBaseType_t prvGetSpacesAvailable( const Queue_t * pxQueue )
+    {
+        UBaseType_t uxSpaces = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+
+        #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+        {
+            /* Discount the slots held by xQueueReserveSend() and
+             * xQueueAcquireReceive() in the same way as prvHasSpace(). */
+            if( ( pxQueue->ucZeroCopyState & queueSEND_RESERVED ) != 0U )
+            {
+                uxSpaces = ( UBaseType_t ) 0;
+            }
+            else if( ( ( pxQueue->ucZeroCopyState & queueRECEIVE_ACQUIRED ) != 0U ) && ( uxSpaces > ( UBaseType_t ) 0 ) )
+            {
+                uxSpaces--;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_QUEUE_ZERO_COPY */
+
+        return uxSpaces;
+    }
+
+#endif /* configUSE_QUEUE_BATCHING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_BATCHING == 1 )
+
+    static void prvCopyItemsToQueue( Queue_t * const pxQueue,
+                                     const void * pvItems,
+                                     const UBaseType_t uxItemCount )
+    {
+        const size_t xBytes = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+        const size_t xBytesToTail = ( size_t ) ( pxQueue->u.xQueue.pcTail - pxQueue->pcWriteTo );
+
+        /* The items are contiguous in the caller's buffer, so at most two
+         * copies are needed - one up to the end of the storage area and one
+         * from the start of it. */
+        if( xBytes < xBytesToTail )
+        {
+            ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItems, xBytes ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports, plus previous logic ensures a null pointer can only be passed to memcpy() if the copy size is 0. */
+            pxQueue->pcWriteTo += xBytes;                                        /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+        }
+        else
+        {
+            ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItems, xBytesToTail );                                                      /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports. */
+            ( void ) memcpy( ( void * ) pxQueue->pcHead, ( const void * ) &( ( ( const int8_t * ) pvItems )[ xBytesToTail ] ), xBytes - xBytesToTail ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports. */
+            pxQueue->pcWriteTo = pxQueue->pcHead + ( xBytes - xBytesToTail );                                                             /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+        }
+
+        pxQueue->uxMessagesWaiting = pxQueue->uxMessagesWaiting + uxItemCount;
+    }
+
+#endif /* configUSE_QUEUE_BATCHING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_BATCHING == 1 )
+
+    static void prvCopyItemsFromQueue( Queue_t * const pxQueue,
+                                       void * const pvBuffer,
+                                       const UBaseType_t uxItemCount )
+    {
+        const size_t xBytes = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+        int8_t * pcReadFrom = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+        size_t xBytesToTail;
+
+        if( pcReadFrom >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+        {
+            pcReadFrom = pxQueue->pcHead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xBytesToTail = ( size_t ) ( pxQueue->u.xQueue.pcTail - pcReadFrom );
+
+        /* pcReadFrom is left pointing at the last item copied out, as it
+         * would be after the same number of calls to prvCopyDataFromQueue(). */
+        if( xBytes <= xBytesToTail )
+        {
+            ( void ) memcpy( pvBuffer, ( void * ) pcReadFrom, xBytes ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports. */
+            pxQueue->u.xQueue.pcReadFrom = pcReadFrom + ( xBytes - ( size_t ) pxQueue->uxItemSize );
+        }
+        else
+        {
+            ( void ) memcpy( pvBuffer, ( void * ) pcReadFrom, xBytesToTail );                                                              /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports. */
+            ( void ) memcpy( ( void * ) &( ( ( int8_t * ) pvBuffer )[ xBytesToTail ] ), ( void * ) pxQueue->pcHead, xBytes - xBytesToTail ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports. */
+            pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead + ( ( xBytes - xBytesToTail ) - ( size_t ) pxQueue->uxItemSize );
         }
     }
 
-    pxQueue->uxMessagesWaiting = uxMessagesWaiting + ( UBaseType_t ) 1;
-
-    return xReturn;
-}
+#endif /* configUSE_QUEUE_BATCHING */
 /*-----------------------------------------------------------*/
 
-static void prvCopyDataFromQueue( Queue_t * const pxQueue,
-                                  void * const pvBuffer )
-{
-    if( pxQueue->uxItemSize != ( UBaseType_t ) 0 )
+#if ( configUSE_QUEUE_BATCHING == 1 )
+
+    static BaseType_t prvNotifyReceiverOfItems( Queue_t * const pxQueue,
+                                                UBaseType_t uxItemCount )
     {
-        pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;           /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
 
-        if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
-        {
-            pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
-        }
-        else
+        #if ( configUSE_QUEUE_SETS == 1 )
+            if( pxQueue->pxQueueSetContainer != NULL )
+            {
+                /* A queue set holds one handle for each item in its member
+                 * queues, so the set has to be told about every item. */
+                while( uxItemCount > ( UBaseType_t ) 0 )
+                {
+                    if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                    {
+                        xHigherPriorityTaskWoken = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    uxItemCount--;
+                }
+            }
+            else
+        #endif /* configUSE_QUEUE_SETS */
         {
-            mtCOVERAGE_TEST_MARKER();
+            /* Only the highest priority receiver is unblocked, however many
+             * items arrived. */
+            if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+            {
+                if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                {
+                    xHigherPriorityTaskWoken = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            ( void ) uxItemCount;
         }
 
-        ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports.  Also previous logic ensures a null pointer can only be passed to memcpy() when the count is 0.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+        return xHigherPriorityTaskWoken;
     }
-}
+
+#endif /* configUSE_QUEUE_BATCHING */
 /*-----------------------------------------------------------*/
 
 static void prvUnlockQueue( Queue_t * const pxQueue )
@@ -2314,7 +3567,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
                     /* Tasks that are removed from the event list will get
                      * added to the pending ready list as the scheduler is still
                      * suspended. */
-                    if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                    if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                     {
                         if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                         {
@@ -2337,7 +3590,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
             {
                 /* Tasks that are removed from the event list will get added to
                  * the pending ready list as the scheduler is still suspended. */
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                 {
                     if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                     {
@@ -2371,7 +3624,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 
         while( cRxLock > queueLOCKED_UNMODIFIED )
         {
-            if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+            if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
             {
                 if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
                 {
@@ -2402,13 +3655,13 @@ static BaseType_t prvIsQueueEmpty( const Queue_t * pxQueue )
 
     taskENTER_CRITICAL();
     {
-        if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 )
+        if( queueCAN_RECEIVE( pxQueue, pxQueue->uxMessagesWaiting ) )
         {
-            xReturn = pdTRUE;
+            xReturn = pdFALSE;
         }
         else
         {
-            xReturn = pdFALSE;
+            xReturn = pdTRUE;
         }
     }
     taskEXIT_CRITICAL();
@@ -2437,19 +3690,20 @@ BaseType_t xQueueIsQueueEmptyFromISR( const QueueHandle_t xQueue )
 } /*lint !e818 xQueue could not be pointer to const because it is a typedef. */
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvIsQueueFull( const Queue_t * pxQueue )
+static BaseType_t prvIsQueueFull( const Queue_t * pxQueue,
+                                  const BaseType_t xCopyPosition )
 {
     BaseType_t xReturn;
 
     taskENTER_CRITICAL();
     {
-        if( pxQueue->uxMessagesWaiting == pxQueue->uxLength )
+        if( queueCAN_SEND( pxQueue, xCopyPosition ) )
         {
-            xReturn = pdTRUE;
+            xReturn = pdFALSE;
         }
         else
         {
-            xReturn = pdFALSE;
+            xReturn = pdTRUE;
         }
     }
     taskEXIT_CRITICAL();
@@ -2458,6 +3712,50 @@ static BaseType_t prvIsQueueFull( const Queue_t * pxQueue )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+    static BaseType_t prvHasSpace( const Queue_t * pxQueue,
+                                   const BaseType_t xCopyPosition )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        if( ( pxQueue->ucZeroCopyState & queueSEND_RESERVED ) != 0U )
+        {
+            /* The reserved slot is the one the next item sent to the back of
+             * the queue would be written to, and for a queue of length one also
+             * the one written by a send to the front or an overwrite, so nothing
+             * else can be sent until it is committed. */
+            mtCOVERAGE_TEST_MARKER();
+        }
+        else if( ( pxQueue->ucZeroCopyState & queueRECEIVE_ACQUIRED ) != 0U )
+        {
+            /* The acquired item is still in the slot at the read position,
+             * which is where items sent to the front of the queue are written.
+             * Items sent to the back can use any slot but that one. */
+            if( ( xCopyPosition == queueSEND_TO_BACK ) && ( ( pxQueue->uxMessagesWaiting + ( UBaseType_t ) 1 ) < pxQueue->uxLength ) )
+            {
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
 BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 {
     BaseType_t xReturn;
@@ -2492,7 +3790,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
          * between the check to see if the queue is full and blocking on the queue. */
         portDISABLE_INTERRUPTS();
         {
-            if( prvIsQueueFull( pxQueue ) != pdFALSE )
+            if( prvIsQueueFull( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
             {
                 /* The queue is full - do we want to block or just leave without
                  * posting? */
@@ -2522,7 +3820,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
                 xReturn = pdPASS;
 
                 /* Were any co-routines waiting for data to become available? */
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                 {
                     /* In this instance the co-routine could be placed directly
                      * into the ready list as we are within a critical section.
@@ -2618,7 +3916,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
                 xReturn = pdPASS;
 
                 /* Were any co-routines waiting for space to become available? */
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
                 {
                     /* In this instance the co-routine could be placed directly
                      * into the ready list as we are within a critical section.
@@ -2669,7 +3967,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
              * co-routine has not already been woken. */
             if( xCoRoutinePreviouslyWoken == pdFALSE )
             {
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                 {
                     if( xCoRoutineRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                     {
@@ -2731,7 +4029,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
             if( ( *pxCoRoutineWoken ) == pdFALSE )
             {
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
                 {
                     if( xCoRoutineRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
                     {
@@ -2912,6 +4210,69 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
         prvUnlockQueue( pxQueue );
     }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxQueueReceiveRestricted( QueueHandle_t xQueue,
+                                          void * const pvBuffer,
+                                          const UBaseType_t uxMaxItems )
+    {
+        Queue_t * const pxQueue = xQueue;
+        int8_t * pcBuffer = ( int8_t * ) pvBuffer;
+        UBaseType_t uxReceived = ( UBaseType_t ) 0U;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        /* This function should not be called by application code hence the
+         * 'Restricted' in its name.  It is not part of the public API.  It is
+         * used by the timer service task to drain its command queue in batches.
+         * Up to uxMaxItems items are copied into pvBuffer, which must have room
+         * for that many, within a single critical section.  The function never
+         * blocks, and returns the number of items copied. */
+        configASSERT( pxQueue );
+        configASSERT( pvBuffer );
+
+        taskENTER_CRITICAL();
+        {
+            while( ( uxReceived < uxMaxItems ) && ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0U ) )
+            {
+                prvCopyDataFromQueue( pxQueue, pcBuffer );
+                traceQUEUE_RECEIVE( pxQueue );
+                pxQueue->uxMessagesWaiting--;
+                pcBuffer += pxQueue->uxItemSize;
+                uxReceived++;
+
+                /* There is now space in the queue, were any tasks waiting to
+                 * post to the queue?  If so, unblock the highest priority waiting
+                 * task, one for each item removed. */
+                if( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                {
+                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    {
+                        xYieldRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+            if( xYieldRequired != pdFALSE )
+            {
+                queueYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return uxReceived;
+    }
 
 #endif /* configUSE_TIMERS */
 /*-----------------------------------------------------------*/
@@ -2922,7 +4283,20 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
     {
         QueueSetHandle_t pxQueue;
 
-        pxQueue = xQueueGenericCreate( uxEventQueueLength, ( UBaseType_t ) sizeof( Queue_t * ), queueQUEUE_TYPE_SET );
+        #if ( configUSE_QUEUE_SET_READY_LIST == 1 )
+        {
+            /* Members with data are linked into the set's ready list rather
+             * than their handles being queued, so the set only counts events
+             * and needs no storage.  The count cannot overflow, so the length
+             * requested is not needed. */
+            ( void ) uxEventQueueLength;
+            pxQueue = xQueueGenericCreate( queueSET_READY_LIST_LENGTH, ( UBaseType_t ) 0, queueQUEUE_TYPE_SET );
+        }
+        #else
+        {
+            pxQueue = xQueueGenericCreate( uxEventQueueLength, ( UBaseType_t ) sizeof( Queue_t * ), queueQUEUE_TYPE_SET );
+        }
+        #endif
 
         return pxQueue;
     }
@@ -2984,6 +4358,14 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
              * the queue. */
             xReturn = pdFAIL;
         }
+        #if ( configUSE_QUEUE_SET_READY_LIST == 1 )
+            else if( pxQueueOrSemaphore->uxPendingSelects != ( UBaseType_t ) 0 )
+            {
+                /* The queue is empty but is still in the set's ready list
+                 * because it was read without being selected. */
+                xReturn = pdFAIL;
+            }
+        #endif
         else
         {
             taskENTER_CRITICAL();
@@ -3008,7 +4390,30 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
     {
         QueueSetMemberHandle_t xReturn = NULL;
 
-        ( void ) xQueueReceive( ( QueueHandle_t ) xQueueSet, &xReturn, xTicksToWait ); /*lint !e961 Casting from one typedef to another is not redundant. */
+        #if ( configUSE_QUEUE_SET_READY_LIST == 1 )
+        {
+            /* The set only counts events, so receiving from it just waits for
+             * and consumes one event.  Each event counted is also recorded
+             * against a member in the ready list, which is then taken. */
+            if( xQueueReceive( ( QueueHandle_t ) xQueueSet, NULL, xTicksToWait ) != pdFALSE ) /*lint !e961 Casting from one typedef to another is not redundant. */
+            {
+                taskENTER_CRITICAL();
+                {
+                    xReturn = prvTakeFromReadyList( xQueueSet );
+                }
+                taskEXIT_CRITICAL();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #else
+        {
+            ( void ) xQueueReceive( ( QueueHandle_t ) xQueueSet, &xReturn, xTicksToWait ); /*lint !e961 Casting from one typedef to another is not redundant. */
+        }
+        #endif
+
         return xReturn;
     }
 
@@ -3021,7 +4426,29 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
     {
         QueueSetMemberHandle_t xReturn = NULL;
 
-        ( void ) xQueueReceiveFromISR( ( QueueHandle_t ) xQueueSet, &xReturn, NULL ); /*lint !e961 Casting from one typedef to another is not redundant. */
+        #if ( configUSE_QUEUE_SET_READY_LIST == 1 )
+        {
+            UBaseType_t uxSavedInterruptStatus;
+
+            if( xQueueReceiveFromISR( ( QueueHandle_t ) xQueueSet, NULL, NULL ) != pdFALSE ) /*lint !e961 Casting from one typedef to another is not redundant. */
+            {
+                uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+                {
+                    xReturn = prvTakeFromReadyList( xQueueSet );
+                }
+                taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #else
+        {
+            ( void ) xQueueReceiveFromISR( ( QueueHandle_t ) xQueueSet, &xReturn, NULL ); /*lint !e961 Casting from one typedef to another is not redundant. */
+        }
+        #endif
+
         return xReturn;
     }
 
@@ -3030,7 +4457,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
 #if ( configUSE_QUEUE_SETS == 1 )
 
-    static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue )
+    static BaseType_t prvNotifyQueueSetContainer( Queue_t * const pxQueue )
     {
         Queue_t * pxQueueSetContainer = pxQueue->pxQueueSetContainer;
         BaseType_t xReturn = pdFALSE;
@@ -3049,12 +4476,23 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
             traceQUEUE_SET_SEND( pxQueueSetContainer );
 
-            /* The data copied is the handle of the queue that contains data. */
-            xReturn = prvCopyDataToQueue( pxQueueSetContainer, &pxQueue, queueSEND_TO_BACK );
+            #if ( configUSE_QUEUE_SET_READY_LIST == 1 )
+            {
+                /* Link the queue into the set's ready list, then count the
+                 * event.  No data is copied as the set has no storage. */
+                prvAddToReadyList( pxQueueSetContainer, pxQueue );
+                xReturn = prvCopyDataToQueue( pxQueueSetContainer, NULL, queueSEND_TO_BACK );
+            }
+            #else
+            {
+                /* The data copied is the handle of the queue that contains data. */
+                xReturn = prvCopyDataToQueue( pxQueueSetContainer, &pxQueue, queueSEND_TO_BACK );
+            }
+            #endif
 
             if( cTxLock == queueUNLOCKED )
             {
-                if( listLIST_IS_EMPTY( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) == pdFALSE )
+                if( listEVENT_LIST_IS_EMPTY( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) == pdFALSE )
                 {
                     if( xTaskRemoveFromEventList( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) != pdFALSE )
                     {
@@ -3085,3 +4523,167 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
     }
 
 #endif /* configUSE_QUEUE_SETS */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_QUEUE_SETS == 1 ) && ( configUSE_QUEUE_SET_READY_LIST == 1 ) )
+
+    static void prvAddToReadyList( Queue_t * const pxQueueSet,
+                                   Queue_t * const pxMember )
+    {
+        if( pxMember->uxPendingSelects == ( UBaseType_t ) 0U )
+        {
+            pxMember->pxNextReadyMember = NULL;
+
+            if( pxQueueSet->pxReadyListTail == NULL )
+            {
+                pxQueueSet->pxReadyListHead = pxMember;
+            }
+            else
+            {
+                pxQueueSet->pxReadyListTail->pxNextReadyMember = pxMember;
+            }
+
+            pxQueueSet->pxReadyListTail = pxMember;
+        }
+        else
+        {
+            /* Already in the ready list, so it is not added twice. */
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        ( pxMember->uxPendingSelects )++;
+    }
+
+#endif /* ( ( configUSE_QUEUE_SETS == 1 ) && ( configUSE_QUEUE_SET_READY_LIST == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_QUEUE_SETS == 1 ) && ( configUSE_QUEUE_SET_READY_LIST == 1 ) )
+
+    static Queue_t * prvTakeFromReadyList( Queue_t * const pxQueueSet )
+    {
+        Queue_t * const pxMember = pxQueueSet->pxReadyListHead;
+
+        /* The caller consumed an event from the set, and every event is
+         * recorded against a member, so the list cannot be empty. */
+        configASSERT( pxMember );
+
+        pxQueueSet->pxReadyListHead = pxMember->pxNextReadyMember;
+
+        if( pxQueueSet->pxReadyListHead == NULL )
+        {
+            pxQueueSet->pxReadyListTail = NULL;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        ( pxMember->uxPendingSelects )--;
+
+        if( pxMember->uxPendingSelects != ( UBaseType_t ) 0U )
+        {
+            /* Move the member behind the others so one busy member cannot
+             * starve the rest of the set. */
+            pxMember->pxNextReadyMember = NULL;
+
+            if( pxQueueSet->pxReadyListTail == NULL )
+            {
+                pxQueueSet->pxReadyListHead = pxMember;
+            }
+            else
+            {
+                pxQueueSet->pxReadyListTail->pxNextReadyMember = pxMember;
+            }
+
+            pxQueueSet->pxReadyListTail = pxMember;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxMember;
+    }
+
+#endif /* ( ( configUSE_QUEUE_SETS == 1 ) && ( configUSE_QUEUE_SET_READY_LIST == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_FAST_PATH == 1 ) )
+
+    static BaseType_t prvMutexTakeFast( Queue_t * const pxQueue )
+    {
+        BaseType_t xReturn = pdFAIL;
+
+        /* The count and the holder have to change together, which is more than
+         * the single word compare and swap functions in atomic.h can do, so the
+         * same short interrupt mask those functions are built on is used
+         * directly.  Unlike taskENTER_CRITICAL() it does not touch the
+         * critical nesting count, and no timeout state is needed because the
+         * fast path never blocks. */
+        ATOMIC_ENTER_CRITICAL();
+        {
+            if( pxQueue->uxMessagesWaiting != ( UBaseType_t ) 0 )
+            {
+                traceQUEUE_RECEIVE( pxQueue );
+
+                pxQueue->uxMessagesWaiting = ( UBaseType_t ) 0;
+                pxQueue->u.xSemaphore.xMutexHolder = pvTaskIncrementMutexHeldCount();
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ATOMIC_EXIT_CRITICAL();
+
+        return xReturn;
+    }
+
+#endif /* ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_FAST_PATH == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_FAST_PATH == 1 ) )
+
+    static BaseType_t prvMutexGiveFast( Queue_t * const pxQueue,
+                                        BaseType_t * const pxYieldRequired )
+    {
+        BaseType_t xReturn = pdFAIL, xInQueueSet = pdFALSE;
+
+        #if ( configUSE_QUEUE_SETS == 1 )
+        {
+            xInQueueSet = ( pxQueue->pxQueueSetContainer != NULL ) ? pdTRUE : pdFALSE;
+        }
+        #endif
+
+        ATOMIC_ENTER_CRITICAL();
+        {
+            /* Only handle the case where the calling task holds the mutex and
+             * no task is waiting for it.  A locked queue means a task is part
+             * way through blocking on the mutex, so must be woken by the normal
+             * path, as must a mutex that belongs to a queue set. */
+            if( ( pxQueue->u.xSemaphore.xMutexHolder == xTaskGetCurrentTaskHandle() ) &&
+                ( pxQueue->cTxLock == queueUNLOCKED ) &&
+                ( listEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE ) &&
+                ( xInQueueSet == pdFALSE ) )
+            {
+                traceQUEUE_SEND( pxQueue );
+
+                /* Undo any priority the holder inherited while it held the
+                 * mutex, exactly as prvCopyDataToQueue() does. */
+                *pxYieldRequired = xTaskPriorityDisinherit( pxQueue->u.xSemaphore.xMutexHolder );
+                pxQueue->u.xSemaphore.xMutexHolder = NULL;
+                pxQueue->uxMessagesWaiting = ( UBaseType_t ) 1;
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ATOMIC_EXIT_CRITICAL();
+
+        return xReturn;
+    }
+
+#endif /* ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_FAST_PATH == 1 ) ) */
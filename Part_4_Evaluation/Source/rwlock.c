@@ -0,0 +1,796 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rwlock.h"
+
+/* Lint e961, e9021 and e750 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021. */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include reader-writer lock functionality. */
+#if ( configUSE_RWLOCKS == 1 )
+
+    #if ( configUSE_MUTEXES != 1 )
+        #error configUSE_MUTEXES must be set to 1 to build rwlock.c
+    #endif
+
+    #if ( configUSE_PREEMPTION == 0 )
+
+/* If the cooperative scheduler is being used then a yield should not be
+ * performed just because a higher priority task has been woken. */
+        #define rwlockYIELD_IF_USING_PREEMPTION()
+    #else
+        #define rwlockYIELD_IF_USING_PREEMPTION()    portYIELD_WITHIN_API()
+    #endif
+
+/* Bits that can be set in ucFlags. */
+    #define rwlockFLAGS_IS_STATICALLY_ALLOCATED    ( ( uint8_t ) 1 ) /* Set if the lock was created using statically allocated memory. */
+
+/*
+ * The lock is only ever accessed from tasks.  Its state is changed inside
+ * critical sections, and a task that has to wait checks the state and places
+ * itself on an event list with the scheduler suspended, so no other task can
+ * release the lock in between.  Both event lists are held in priority order,
+ * so tasks of equal priority are served in the order in which they started to
+ * wait.
+ */
+    typedef struct RWLockDefinition
+    {
+        EventList_t xTasksWaitingToRead;  /*< Tasks blocked waiting to take the lock for reading.  Stored in priority order. */
+        EventList_t xTasksWaitingToWrite; /*< Tasks blocked waiting to take the lock for writing.  Stored in priority order. */
+        UBaseType_t uxReaders;            /*< The number of tasks that hold the lock for reading. */
+        TaskHandle_t xWriter;             /*< The task that holds the lock for writing, or NULL. */
+        uint8_t ucFlags;                  /*< Holds rwlockFLAGS_IS_STATICALLY_ALLOCATED. */
+    } RWLock_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The blocking part of xRWLockTakeRead() and xRWLockTakeWrite().
+ */
+    static BaseType_t prvTake( RWLock_t * const pxRWLock,
+                               TickType_t xTicksToWait,
+                               const BaseType_t xForWrite ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if the calling task could take the lock now.  Readers are
+ * held back while a writer is waiting, so a steady stream of readers cannot
+ * starve writers.  A waiting writer can find the lock has already been handed
+ * to it by the task that released it.
+ */
+    static BaseType_t prvCanTake( RWLock_t * const pxRWLock,
+                                  const BaseType_t xForWrite ) PRIVILEGED_FUNCTION;
+
+/*
+ * Takes the lock for the calling task if prvCanTake() allows it.  Must be
+ * called from a critical section.
+ */
+    static BaseType_t prvTryTake( RWLock_t * const pxRWLock,
+                                  const BaseType_t xForWrite ) PRIVILEGED_FUNCTION;
+
+/*
+ * Hands the lock to the highest priority waiting writer and unblocks it.
+ * Must be called from a critical section.  Returns pdTRUE if the writer has a
+ * priority above the calling task.
+ */
+    static BaseType_t prvGrantToWriter( RWLock_t * const pxRWLock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks every waiting reader so each can take the lock.  Must be called
+ * from a critical section.  Returns pdTRUE if any of them has a priority
+ * above the calling task.
+ */
+    static BaseType_t prvWakeReaders( RWLock_t * const pxRWLock ) PRIVILEGED_FUNCTION;
+
+/*
+ * As prvGetDisinheritPriorityAfterTimeout() in queue.c - returns the priority
+ * of the highest priority task still waiting for the lock.
+ */
+    static UBaseType_t prvGetDisinheritPriorityAfterTimeout( RWLock_t * const pxRWLock ) PRIVILEGED_FUNCTION;
+
+/*
+ * The lottery equivalent of prvGetDisinheritPriorityAfterTimeout() - returns
+ * the greater of the tickets held by the tasks at the head of the two waiting
+ * lists.
+ */
+    #if ( configUSE_TICKETS == 1 )
+        static UBaseType_t prvGetDisinheritTicketsAfterTimeout( RWLock_t * const pxRWLock ) PRIVILEGED_FUNCTION;
+    #endif
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        RWLockHandle_t xRWLockCreate( void )
+        {
+            RWLock_t * pxRWLock;
+
+            pxRWLock = ( RWLock_t * ) pvPortMalloc( sizeof( RWLock_t ) ); /*lint !e9087 !e9079 see comment above. */
+
+            if( pxRWLock != NULL )
+            {
+                ( void ) memset( ( void * ) pxRWLock, 0x00, sizeof( RWLock_t ) );
+                listEVENT_LIST_INITIALISE( &( pxRWLock->xTasksWaitingToRead ) );
+                listEVENT_LIST_INITIALISE( &( pxRWLock->xTasksWaitingToWrite ) );
+                traceRWLOCK_CREATE( pxRWLock );
+            }
+            else
+            {
+                traceRWLOCK_CREATE_FAILED();
+            }
+
+            return pxRWLock;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        RWLockHandle_t xRWLockCreateStatic( StaticRWLock_t * const pxRWLockBuffer )
+        {
+            RWLock_t * const pxRWLock = ( RWLock_t * ) pxRWLockBuffer; /*lint !e740 !e9087 Safe cast as StaticRWLock_t is opaque RWLock_t. */
+
+            configASSERT( pxRWLockBuffer );
+
+            #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticRWLock_t equals the size of the real
+                 * reader-writer lock structure. */
+                volatile size_t xSize = sizeof( StaticRWLock_t );
+                configASSERT( xSize == sizeof( RWLock_t ) );
+            } /*lint !e529 xSize is referenced is configASSERT() is defined. */
+            #endif /* configASSERT_DEFINED */
+
+            if( pxRWLock != NULL )
+            {
+                ( void ) memset( ( void * ) pxRWLock, 0x00, sizeof( RWLock_t ) );
+                listEVENT_LIST_INITIALISE( &( pxRWLock->xTasksWaitingToRead ) );
+                listEVENT_LIST_INITIALISE( &( pxRWLock->xTasksWaitingToWrite ) );
+                pxRWLock->ucFlags = rwlockFLAGS_IS_STATICALLY_ALLOCATED;
+                traceRWLOCK_CREATE( pxRWLock );
+            }
+            else
+            {
+                traceRWLOCK_CREATE_FAILED();
+            }
+
+            return pxRWLock;
+        }
+
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    void vRWLockDelete( RWLockHandle_t xRWLock )
+    {
+        RWLock_t * const pxRWLock = xRWLock;
+
+        configASSERT( pxRWLock );
+
+        /* The lock must not be held or waited for when it is deleted. */
+        configASSERT( ( pxRWLock->uxReaders == ( UBaseType_t ) 0 ) && ( pxRWLock->xWriter == NULL ) );
+        configASSERT( listEVENT_LIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToRead ) ) != pdFALSE );
+        configASSERT( listEVENT_LIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToWrite ) ) != pdFALSE );
+
+        traceRWLOCK_DELETE( xRWLock );
+
+        if( ( pxRWLock->ucFlags & rwlockFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) pdFALSE )
+        {
+            #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+            {
+                vPortFree( ( void * ) pxRWLock ); /*lint !e9087 Standard free() semantics require void *, plus pxRWLock was allocated by pvPortMalloc(). */
+            }
+            #else
+            {
+                /* Should not be possible to get here, ucFlags must be corrupt.
+                 * Force an assert. */
+                configASSERT( xRWLock == ( RWLockHandle_t ) ~0 );
+            }
+            #endif
+        }
+        else
+        {
+            /* The structure was statically allocated, so just scrub it. */
+            ( void ) memset( pxRWLock, 0x00, sizeof( RWLock_t ) );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRWLockTakeRead( RWLockHandle_t xRWLock,
+                                TickType_t xTicksToWait )
+    {
+        RWLock_t * const pxRWLock = xRWLock;
+        BaseType_t xReturn;
+
+        configASSERT( pxRWLock );
+
+        xReturn = prvTake( pxRWLock, xTicksToWait, pdFALSE );
+
+        if( xReturn != pdFAIL )
+        {
+            traceRWLOCK_TAKE_READ( xRWLock );
+        }
+        else
+        {
+            traceRWLOCK_TAKE_READ_FAILED( xRWLock );
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRWLockGiveRead( RWLockHandle_t xRWLock )
+    {
+        RWLock_t * const pxRWLock = xRWLock;
+        BaseType_t xReturn = pdPASS, xYieldRequired = pdFALSE;
+
+        configASSERT( pxRWLock );
+
+        taskENTER_CRITICAL();
+        {
+            if( pxRWLock->uxReaders > ( UBaseType_t ) 0 )
+            {
+                ( pxRWLock->uxReaders )--;
+
+                /* The last reader out hands the lock to a waiting writer. */
+                if( ( pxRWLock->uxReaders == ( UBaseType_t ) 0 ) &&
+                    ( listEVENT_LIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToWrite ) ) == pdFALSE ) )
+                {
+                    xYieldRequired = prvGrantToWriter( pxRWLock );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xReturn != pdFAIL )
+        {
+            traceRWLOCK_GIVE_READ( xRWLock );
+        }
+        else
+        {
+            traceRWLOCK_GIVE_READ_FAILED( xRWLock );
+        }
+
+        if( xYieldRequired != pdFALSE )
+        {
+            rwlockYIELD_IF_USING_PREEMPTION();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRWLockTakeWrite( RWLockHandle_t xRWLock,
+                                 TickType_t xTicksToWait )
+    {
+        RWLock_t * const pxRWLock = xRWLock;
+        BaseType_t xReturn;
+
+        configASSERT( pxRWLock );
+
+        /* The lock is not recursive. */
+        configASSERT( pxRWLock->xWriter != xTaskGetCurrentTaskHandle() );
+
+        xReturn = prvTake( pxRWLock, xTicksToWait, pdTRUE );
+
+        if( xReturn != pdFAIL )
+        {
+            traceRWLOCK_TAKE_WRITE( xRWLock );
+        }
+        else
+        {
+            traceRWLOCK_TAKE_WRITE_FAILED( xRWLock );
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRWLockGiveWrite( RWLockHandle_t xRWLock )
+    {
+        RWLock_t * const pxRWLock = xRWLock;
+        BaseType_t xReturn = pdPASS, xYieldRequired = pdFALSE;
+
+        configASSERT( pxRWLock );
+
+        taskENTER_CRITICAL();
+        {
+            if( pxRWLock->xWriter == xTaskGetCurrentTaskHandle() )
+            {
+                /* Drop any priority inherited from tasks waiting for the lock,
+                 * as is done when a mutex is given. */
+                xYieldRequired = xTaskPriorityDisinherit( pxRWLock->xWriter );
+
+                #if ( configUSE_TICKETS == 1 )
+                {
+                    /* Likewise any lent lottery tickets.  Must follow
+                     * xTaskPriorityDisinherit(), which updates the count of
+                     * mutexes held. */
+                    vTaskTicketDisinherit( pxRWLock->xWriter );
+                }
+                #endif
+
+                /* Writers are preferred, so readers only get the lock when no
+                 * writer is waiting for it. */
+                if( listEVENT_LIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToWrite ) ) == pdFALSE )
+                {
+                    if( prvGrantToWriter( pxRWLock ) != pdFALSE )
+                    {
+                        xYieldRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    pxRWLock->xWriter = NULL;
+
+                    if( prvWakeReaders( pxRWLock ) != pdFALSE )
+                    {
+                        xYieldRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xReturn != pdFAIL )
+        {
+            traceRWLOCK_GIVE_WRITE( xRWLock );
+        }
+        else
+        {
+            traceRWLOCK_GIVE_WRITE_FAILED( xRWLock );
+        }
+
+        if( xYieldRequired != pdFALSE )
+        {
+            rwlockYIELD_IF_USING_PREEMPTION();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxRWLockGetReaderCount( RWLockHandle_t xRWLock )
+    {
+        const RWLock_t * const pxRWLock = xRWLock;
+
+        configASSERT( pxRWLock );
+
+        return pxRWLock->uxReaders;
+    }
+/*-----------------------------------------------------------*/
+
+    TaskHandle_t xRWLockGetWriter( RWLockHandle_t xRWLock )
+    {
+        const RWLock_t * const pxRWLock = xRWLock;
+
+        configASSERT( pxRWLock );
+
+        return pxRWLock->xWriter;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvTake( RWLock_t * const pxRWLock,
+                               TickType_t xTicksToWait,
+                               const BaseType_t xForWrite )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE, xInheritanceOccurred = pdFALSE, xYieldRequired = pdFALSE;
+
+        #if ( configUSE_TICKETS == 1 )
+            BaseType_t xTicketsLent = pdFALSE;
+        #endif
+        TimeOut_t xTimeOut;
+        EventList_t * const pxWaitingList = ( xForWrite != pdFALSE ) ? &( pxRWLock->xTasksWaitingToWrite ) : &( pxRWLock->xTasksWaitingToRead );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        /*lint -save -e904 This function relaxes the coding standard somewhat to
+         * allow return statements within the function itself.  This is done in
+         * the interest of execution time efficiency. */
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                if( prvTryTake( pxRWLock, xForWrite ) != pdFALSE )
+                {
+                    taskEXIT_CRITICAL();
+                    return pdPASS;
+                }
+                else if( xTicksToWait == ( TickType_t ) 0 )
+                {
+                    /* The lock cannot have caused an inheritance if the task
+                     * never blocked. */
+                    configASSERT( xInheritanceOccurred == pdFALSE );
+                    taskEXIT_CRITICAL();
+                    return pdFAIL;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    vTaskInternalSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            /* With the scheduler suspended no other task can release the lock
+             * between the check below and this task being placed on the event
+             * list. */
+            vTaskSuspendAll();
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( prvCanTake( pxRWLock, xForWrite ) == pdFALSE )
+                {
+                    traceBLOCKING_ON_RWLOCK_TAKE( pxRWLock, xForWrite );
+
+                    /* Only a writer is a single task that can inherit the
+                     * priority of the tasks waiting for it. */
+                    if( pxRWLock->xWriter != NULL )
+                    {
+                        taskENTER_CRITICAL();
+                        {
+                            if( xTaskPriorityInherit( pxRWLock->xWriter ) != pdFALSE )
+                            {
+                                xInheritanceOccurred = pdTRUE;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+
+                            #if ( configUSE_TICKETS == 1 )
+                            {
+                                /* Tasks of equal priority are chosen by
+                                 * lottery, so raising the writer's priority
+                                 * does not help it release the lock sooner.
+                                 * Lend it this task's tickets instead. */
+                                if( xTaskTicketInherit( pxRWLock->xWriter ) != pdFALSE )
+                                {
+                                    xTicketsLent = pdTRUE;
+                                }
+                                else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
+                            }
+                            #endif
+                        }
+                        taskEXIT_CRITICAL();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    vTaskPlaceOnEventList( pxWaitingList, xTicksToWait );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        portYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    /* The lock became available, try again. */
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* Timed out. */
+                ( void ) xTaskResumeAll();
+
+                taskENTER_CRITICAL();
+                {
+                    /* The lock may have been handed to this task just as it
+                     * timed out. */
+                    if( prvTryTake( pxRWLock, xForWrite ) != pdFALSE )
+                    {
+                        taskEXIT_CRITICAL();
+                        return pdPASS;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    if( xInheritanceOccurred != pdFALSE )
+                    {
+                        vTaskPriorityDisinheritAfterTimeout( pxRWLock->xWriter, prvGetDisinheritPriorityAfterTimeout( pxRWLock ) );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    #if ( configUSE_TICKETS == 1 )
+                    {
+                        if( xTicketsLent != pdFALSE )
+                        {
+                            vTaskTicketDisinheritAfterTimeout( pxRWLock->xWriter, prvGetDisinheritTicketsAfterTimeout( pxRWLock ) );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    #endif
+
+                    /* Readers wait while any writer is waiting, so if this was
+                     * the last waiting writer and no writer holds the lock the
+                     * readers must be woken. */
+                    if( ( xForWrite != pdFALSE ) &&
+                        ( pxRWLock->xWriter == NULL ) &&
+                        ( listEVENT_LIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToWrite ) ) != pdFALSE ) )
+                    {
+                        xYieldRequired = prvWakeReaders( pxRWLock );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                if( xYieldRequired != pdFALSE )
+                {
+                    rwlockYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                return pdFAIL;
+            }
+        } /*lint -restore */
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvCanTake( RWLock_t * const pxRWLock,
+                                  const BaseType_t xForWrite )
+    {
+        BaseType_t xReturn;
+
+        if( xForWrite != pdFALSE )
+        {
+            if( pxRWLock->xWriter == NULL )
+            {
+                xReturn = ( pxRWLock->uxReaders == ( UBaseType_t ) 0 ) ? pdTRUE : pdFALSE;
+            }
+            else
+            {
+                xReturn = ( pxRWLock->xWriter == xTaskGetCurrentTaskHandle() ) ? pdTRUE : pdFALSE;
+            }
+        }
+        else
+        {
+            if( ( pxRWLock->xWriter == NULL ) &&
+                ( listEVENT_LIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToWrite ) ) != pdFALSE ) )
+            {
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                xReturn = pdFALSE;
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvTryTake( RWLock_t * const pxRWLock,
+                                  const BaseType_t xForWrite )
+    {
+        BaseType_t xReturn = prvCanTake( pxRWLock, xForWrite );
+
+        if( xReturn != pdFALSE )
+        {
+            if( xForWrite != pdFALSE )
+            {
+                /* Counting the lock as a held mutex lets the writer
+                 * disinherit any priority it inherits when it gives the
+                 * lock. */
+                pxRWLock->xWriter = pvTaskIncrementMutexHeldCount();
+            }
+            else
+            {
+                ( pxRWLock->uxReaders )++;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvGrantToWriter( RWLock_t * const pxRWLock )
+    {
+        /* xTaskRemoveFromEventList() unblocks the task at the head of the
+         * list, so that is the task the lock is handed to.  The task finds it
+         * holds the lock when it runs, so a reader or writer that runs first
+         * cannot take the lock from it. */
+        pxRWLock->xWriter = ( TaskHandle_t ) listGET_LIST_ITEM_OWNER( listEVENT_LIST_GET_HEAD_ENTRY( &( pxRWLock->xTasksWaitingToWrite ) ) );
+
+        return xTaskRemoveFromEventList( &( pxRWLock->xTasksWaitingToWrite ) );
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvWakeReaders( RWLock_t * const pxRWLock )
+    {
+        BaseType_t xYieldRequired = pdFALSE;
+
+        while( listEVENT_LIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToRead ) ) == pdFALSE )
+        {
+            if( xTaskRemoveFromEventList( &( pxRWLock->xTasksWaitingToRead ) ) != pdFALSE )
+            {
+                xYieldRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xYieldRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static UBaseType_t prvGetDisinheritPriorityAfterTimeout( RWLock_t * const pxRWLock )
+    {
+        UBaseType_t uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY, uxPriority;
+
+        if( listEVENT_LIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToRead ) ) == pdFALSE )
+        {
+            uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_LIST_ITEM_VALUE( listEVENT_LIST_GET_HEAD_ENTRY( &( pxRWLock->xTasksWaitingToRead ) ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( listEVENT_LIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToWrite ) ) == pdFALSE )
+        {
+            uxPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_LIST_ITEM_VALUE( listEVENT_LIST_GET_HEAD_ENTRY( &( pxRWLock->xTasksWaitingToWrite ) ) );
+
+            if( uxPriority > uxHighestPriorityOfWaitingTasks )
+            {
+                uxHighestPriorityOfWaitingTasks = uxPriority;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return uxHighestPriorityOfWaitingTasks;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TICKETS == 1 )
+
+        static UBaseType_t prvGetDisinheritTicketsAfterTimeout( RWLock_t * const pxRWLock )
+        {
+            UBaseType_t uxHighestTicketsOfWaitingTasks = 0, uxTickets;
+
+            if( listEVENT_LIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToRead ) ) == pdFALSE )
+            {
+                uxHighestTicketsOfWaitingTasks = uxTaskGetTickets( ( TaskHandle_t ) listGET_LIST_ITEM_OWNER( listEVENT_LIST_GET_HEAD_ENTRY( &( pxRWLock->xTasksWaitingToRead ) ) ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( listEVENT_LIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToWrite ) ) == pdFALSE )
+            {
+                uxTickets = uxTaskGetTickets( ( TaskHandle_t ) listGET_LIST_ITEM_OWNER( listEVENT_LIST_GET_HEAD_ENTRY( &( pxRWLock->xTasksWaitingToWrite ) ) ) );
+
+                if( uxTickets > uxHighestTicketsOfWaitingTasks )
+                {
+                    uxHighestTicketsOfWaitingTasks = uxTickets;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return uxHighestTicketsOfWaitingTasks;
+        }
+
+    #endif /* configUSE_TICKETS */
+
+#endif /* configUSE_RWLOCKS */
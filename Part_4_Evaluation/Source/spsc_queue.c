@@ -0,0 +1,504 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "spsc_queue.h"
+
+/* Lint e961, e9021 and e750 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021. */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include SPSC queue functionality. */
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+    #if ( configUSE_TASK_NOTIFICATIONS != 1 )
+        #error configUSE_TASK_NOTIFICATIONS must be set to 1 to build spsc_queue.c
+    #endif
+
+    #if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 )
+        #error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to build spsc_queue.c
+    #endif
+
+    #if ( configSPSC_QUEUE_NOTIFICATION_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES )
+        #error configSPSC_QUEUE_NOTIFICATION_INDEX must be less than configTASK_NOTIFICATION_ARRAY_ENTRIES
+    #endif
+
+/* The consumer clears the value of its notification at this index each time
+ * it waits, which would discard notifications sent by xTaskNotifyGive(), stream
+ * buffers and message buffers if index 0 were used while another index is
+ * free. */
+    #if ( ( configSPSC_QUEUE_NOTIFICATION_INDEX == 0 ) && ( configTASK_NOTIFICATION_ARRAY_ENTRIES > 1 ) )
+        #error configSPSC_QUEUE_NOTIFICATION_INDEX must be set to a notification index other than 0 in FreeRTOSConfig.h, as index 0 is used by xTaskNotifyGive(), ulTaskNotifyTake() and stream and message buffers.
+    #endif
+
+    #if ( ( configUSE_LIGHT_SYNC == 1 ) && ( configTASK_NOTIFICATION_ARRAY_ENTRIES > 1 ) && ( configSPSC_QUEUE_NOTIFICATION_INDEX == configLIGHT_SYNC_NOTIFICATION_INDEX ) )
+        #error configSPSC_QUEUE_NOTIFICATION_INDEX and configLIGHT_SYNC_NOTIFICATION_INDEX must be different notification indexes.
+    #endif
+
+/* Bits that can be set in ucFlags. */
+    #define spscFLAGS_IS_STATICALLY_ALLOCATED    ( ( uint8_t ) 1 ) /* Set if the queue was created using statically allocated memory. */
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The head index is only ever written by the producer and the tail index only
+ * ever by the consumer, so neither needs to be updated atomically - each side
+ * writes its own index with a single aligned store and reads the other side's
+ * index with a single aligned load.  The storage holds one more slot than the
+ * queue length so a full queue (head one behind tail) can be told apart from
+ * an empty one (head equal to tail) without a shared count.
+ */
+    typedef struct SpscQueueDefinition /* The old naming convention is used to prevent breaking kernel aware debuggers. */
+    {
+        volatile UBaseType_t uxHead;     /*< Index of the slot the next item will be written to.  Only written by the producer. */
+        volatile UBaseType_t uxTail;     /*< Index of the slot the next item will be read from.  Only written by the consumer. */
+        UBaseType_t uxSlots;             /*< The number of slots in the storage area, which is one more than the queue length. */
+        UBaseType_t uxItemSize;          /*< The size of each item the queue holds. */
+        TaskHandle_t volatile xConsumer; /*< The task that receives from the queue, recorded the first time it tries to. */
+        uint8_t * pucStorage;            /*< Points to the queue storage area. */
+        uint8_t ucFlags;                 /*< Holds spscFLAGS_IS_STATICALLY_ALLOCATED. */
+    } SpscQueue_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called by both the dynamic and static creation functions to fill in the
+ * structure's members.
+ */
+    static void prvInitialiseNewSpscQueue( SpscQueue_t * const pxQueue,
+                                           uint8_t * const pucStorage,
+                                           UBaseType_t uxQueueLength,
+                                           UBaseType_t uxItemSize,
+                                           uint8_t ucFlags ) PRIVILEGED_FUNCTION;
+
+/*
+ * Writes an item to the head of the queue and publishes it to the consumer.
+ * Returns pdTRUE if the queue was empty before the item was written, in which
+ * case the consumer may be blocked waiting for it.
+ */
+    static BaseType_t prvWriteItem( SpscQueue_t * const pxQueue,
+                                    const void * pvItem,
+                                    UBaseType_t uxHead,
+                                    UBaseType_t uxNextHead ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        SpscQueueHandle_t xSpscQueueCreate( UBaseType_t uxQueueLength,
+                                            UBaseType_t uxItemSize )
+        {
+            SpscQueue_t * pxNewQueue = NULL;
+            size_t xStorageSize;
+
+            configASSERT( uxQueueLength > ( UBaseType_t ) 0 );
+            configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+
+            xStorageSize = spscQUEUE_STORAGE_SIZE( uxQueueLength, uxItemSize );
+
+            /* Check for multiplication overflow and addition overflow. */
+            if( ( ( ( size_t ) uxQueueLength + ( size_t ) 1 ) > ( size_t ) uxQueueLength ) &&
+                ( ( xStorageSize / ( size_t ) uxItemSize ) == ( ( size_t ) uxQueueLength + ( size_t ) 1 ) ) &&
+                ( ( sizeof( SpscQueue_t ) + xStorageSize ) > xStorageSize ) )
+            {
+                /* Allocate the structure and the storage area in one go, with
+                 * the storage area immediately after the structure. */
+                pxNewQueue = ( SpscQueue_t * ) pvPortMalloc( sizeof( SpscQueue_t ) + xStorageSize ); /*lint !e9087 !e9079 pvPortMalloc() always ensures returned memory blocks are aligned per the requirements of the MCU stack.  In this case pvPortMalloc() must return a pointer that is guaranteed to meet the alignment requirements of the SpscQueue_t structure - which in this case is an int8_t *.  Therefore, whenever the stack alignment requirements are greater than or equal to the pointer to char requirements the cast is safe. */
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxNewQueue != NULL )
+            {
+                prvInitialiseNewSpscQueue( pxNewQueue,
+                                           ( ( uint8_t * ) pxNewQueue ) + sizeof( SpscQueue_t ), /*lint !e9016 Indexing past structure valid for uint8_t pointer. */
+                                           uxQueueLength,
+                                           uxItemSize,
+                                           ( uint8_t ) 0 );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return pxNewQueue;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        SpscQueueHandle_t xSpscQueueCreateStatic( UBaseType_t uxQueueLength,
+                                                  UBaseType_t uxItemSize,
+                                                  uint8_t * const pucQueueStorageArea,
+                                                  StaticSpscQueue_t * const pxStaticSpscQueue )
+        {
+            SpscQueue_t * const pxQueue = ( SpscQueue_t * ) pxStaticSpscQueue; /*lint !e740 !e9087 Safe cast as StaticSpscQueue_t is opaque SpscQueue_t. */
+            SpscQueueHandle_t xReturn;
+
+            configASSERT( pucQueueStorageArea );
+            configASSERT( pxStaticSpscQueue );
+            configASSERT( uxQueueLength > ( UBaseType_t ) 0 );
+            configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+
+            #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticSpscQueue_t equals the size of the real
+                 * SPSC queue structure. */
+                volatile size_t xSize = sizeof( StaticSpscQueue_t );
+                configASSERT( xSize == sizeof( SpscQueue_t ) );
+            } /*lint !e529 xSize is referenced is configASSERT() is defined. */
+            #endif /* configASSERT_DEFINED */
+
+            if( ( pucQueueStorageArea != NULL ) && ( pxStaticSpscQueue != NULL ) )
+            {
+                prvInitialiseNewSpscQueue( pxQueue,
+                                           pucQueueStorageArea,
+                                           uxQueueLength,
+                                           uxItemSize,
+                                           spscFLAGS_IS_STATICALLY_ALLOCATED );
+
+                xReturn = ( SpscQueueHandle_t ) pxStaticSpscQueue; /*lint !e9087 Data hiding requires cast to opaque type. */
+            }
+            else
+            {
+                xReturn = NULL;
+            }
+
+            return xReturn;
+        }
+
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    void vSpscQueueDelete( SpscQueueHandle_t xQueue )
+    {
+        SpscQueue_t * pxQueue = xQueue;
+
+        configASSERT( pxQueue );
+
+        if( ( pxQueue->ucFlags & spscFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) pdFALSE )
+        {
+            #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+            {
+                /* Both the structure and the storage area were allocated using a
+                 * single call to pvPortMalloc(), hence only one call to
+                 * vPortFree() is required. */
+                vPortFree( ( void * ) pxQueue ); /*lint !e9087 Standard free() semantics require void *, plus pxQueue was allocated by pvPortMalloc(). */
+            }
+            #else
+            {
+                /* Should not be possible to get here, ucFlags must be corrupt.
+                 * Force an assert. */
+                configASSERT( xQueue == ( SpscQueueHandle_t ) ~0 );
+            }
+            #endif
+        }
+        else
+        {
+            /* The structure and storage area were statically allocated, so
+             * just scrub the structure. */
+            ( void ) memset( pxQueue, 0x00, sizeof( SpscQueue_t ) );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xSpscQueueSend( SpscQueueHandle_t xQueue,
+                               const void * pvItemToQueue )
+    {
+        SpscQueue_t * const pxQueue = xQueue;
+        UBaseType_t uxHead, uxNextHead;
+        BaseType_t xReturn;
+
+        configASSERT( pxQueue );
+        configASSERT( pvItemToQueue );
+
+        /* Only the producer writes the head index, so it cannot change under
+         * this function. */
+        uxHead = pxQueue->uxHead;
+        uxNextHead = uxHead + ( UBaseType_t ) 1;
+
+        if( uxNextHead == pxQueue->uxSlots )
+        {
+            uxNextHead = ( UBaseType_t ) 0;
+        }
+
+        if( uxNextHead != pxQueue->uxTail )
+        {
+            traceSPSC_QUEUE_SEND( xQueue );
+
+            if( prvWriteItem( pxQueue, pvItemToQueue, uxHead, uxNextHead ) != pdFALSE )
+            {
+                const TaskHandle_t xConsumer = pxQueue->xConsumer;
+
+                /* The queue was empty, so the consumer may be waiting for
+                 * this item. */
+                if( xConsumer != NULL )
+                {
+                    ( void ) xTaskNotifyGiveIndexed( xConsumer, configSPSC_QUEUE_NOTIFICATION_INDEX );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            traceSPSC_QUEUE_SEND_FAILED( xQueue );
+            xReturn = errQUEUE_FULL;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xSpscQueueSendFromISR( SpscQueueHandle_t xQueue,
+                                      const void * pvItemToQueue,
+                                      BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        SpscQueue_t * const pxQueue = xQueue;
+        UBaseType_t uxHead, uxNextHead;
+        BaseType_t xReturn;
+
+        configASSERT( pxQueue );
+        configASSERT( pvItemToQueue );
+
+        /* Only the producer writes the head index, so it cannot change under
+         * this function. */
+        uxHead = pxQueue->uxHead;
+        uxNextHead = uxHead + ( UBaseType_t ) 1;
+
+        if( uxNextHead == pxQueue->uxSlots )
+        {
+            uxNextHead = ( UBaseType_t ) 0;
+        }
+
+        if( uxNextHead != pxQueue->uxTail )
+        {
+            traceSPSC_QUEUE_SEND_FROM_ISR( xQueue );
+
+            /* The item is published without masking interrupts.  Interrupts
+             * are only masked, inside vTaskNotifyGiveIndexedFromISR(), when
+             * the queue goes from empty to not empty. */
+            if( prvWriteItem( pxQueue, pvItemToQueue, uxHead, uxNextHead ) != pdFALSE )
+            {
+                const TaskHandle_t xConsumer = pxQueue->xConsumer;
+
+                if( xConsumer != NULL )
+                {
+                    vTaskNotifyGiveIndexedFromISR( xConsumer, configSPSC_QUEUE_NOTIFICATION_INDEX, pxHigherPriorityTaskWoken );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            traceSPSC_QUEUE_SEND_FROM_ISR_FAILED( xQueue );
+            xReturn = errQUEUE_FULL;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xSpscQueueReceive( SpscQueueHandle_t xQueue,
+                                  void * const pvBuffer,
+                                  TickType_t xTicksToWait )
+    {
+        SpscQueue_t * const pxQueue = xQueue;
+        TimeOut_t xTimeOut;
+        BaseType_t xReturn = errQUEUE_EMPTY;
+        UBaseType_t uxTail;
+
+        configASSERT( pxQueue );
+        configASSERT( pvBuffer );
+
+        /* There is only one consumer, so it is always this task.  It is recorded
+         * before the queue is checked so a producer that finds it has made the
+         * queue not empty also finds the task to notify. */
+        if( pxQueue->xConsumer == NULL )
+        {
+            pxQueue->xConsumer = xTaskGetCurrentTaskHandle();
+            portMEMORY_BARRIER();
+        }
+        else
+        {
+            configASSERT( pxQueue->xConsumer == xTaskGetCurrentTaskHandle() );
+        }
+
+        vTaskSetTimeOutState( &xTimeOut );
+
+        for( ; ; )
+        {
+            uxTail = pxQueue->uxTail;
+
+            if( uxTail != pxQueue->uxHead )
+            {
+                /* Read the item before the slot is handed back to the
+                 * producer by advancing the tail. */
+                portMEMORY_BARRIER();
+                ( void ) memcpy( pvBuffer, ( void * ) &( pxQueue->pucStorage[ uxTail * pxQueue->uxItemSize ] ), ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports. */
+                portMEMORY_BARRIER();
+
+                uxTail++;
+
+                if( uxTail == pxQueue->uxSlots )
+                {
+                    uxTail = ( UBaseType_t ) 0;
+                }
+
+                pxQueue->uxTail = uxTail;
+
+                traceSPSC_QUEUE_RECEIVE( xQueue );
+                xReturn = pdPASS;
+                break;
+            }
+            else if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                break;
+            }
+            else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                break;
+            }
+            else
+            {
+                /* The producer notifies this task when it makes the queue not
+                 * empty.  A notification left over from an item that was
+                 * received without blocking just causes the queue to be
+                 * checked again. */
+                traceBLOCKING_ON_SPSC_QUEUE_RECEIVE( xQueue );
+                ( void ) ulTaskNotifyTakeIndexed( configSPSC_QUEUE_NOTIFICATION_INDEX, pdTRUE, xTicksToWait );
+            }
+        }
+
+        if( xReturn == errQUEUE_EMPTY )
+        {
+            traceSPSC_QUEUE_RECEIVE_FAILED( xQueue );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxSpscQueueMessagesWaiting( const SpscQueueHandle_t xQueue )
+    {
+        const SpscQueue_t * const pxQueue = xQueue;
+        const UBaseType_t uxHead = pxQueue->uxHead;
+        const UBaseType_t uxTail = pxQueue->uxTail;
+        UBaseType_t uxReturn;
+
+        configASSERT( pxQueue );
+
+        if( uxHead >= uxTail )
+        {
+            uxReturn = uxHead - uxTail;
+        }
+        else
+        {
+            uxReturn = ( pxQueue->uxSlots - uxTail ) + uxHead;
+        }
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvWriteItem( SpscQueue_t * const pxQueue,
+                                    const void * pvItem,
+                                    UBaseType_t uxHead,
+                                    UBaseType_t uxNextHead )
+    {
+        ( void ) memcpy( ( void * ) &( pxQueue->pucStorage[ uxHead * pxQueue->uxItemSize ] ), pvItem, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports. */
+
+        /* The item must be in the slot before the new head makes it visible
+         * to the consumer, and the tail must be read again only after the new
+         * head has been written.  If the consumer had already taken every
+         * earlier item at that point then it may be waiting for this one - if
+         * not, it will see this item before it next finds the queue empty. */
+        portMEMORY_BARRIER();
+        pxQueue->uxHead = uxNextHead;
+        portMEMORY_BARRIER();
+
+        return ( pxQueue->uxTail == uxHead ) ? pdTRUE : pdFALSE;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvInitialiseNewSpscQueue( SpscQueue_t * const pxQueue,
+                                           uint8_t * const pucStorage,
+                                           UBaseType_t uxQueueLength,
+                                           UBaseType_t uxItemSize,
+                                           uint8_t ucFlags )
+    {
+        ( void ) memset( ( void * ) pxQueue, 0x00, sizeof( SpscQueue_t ) ); /*lint !e9087 memset() requires void *. */
+        pxQueue->pucStorage = pucStorage;
+        pxQueue->uxSlots = uxQueueLength + ( UBaseType_t ) 1;
+        pxQueue->uxItemSize = uxItemSize;
+        pxQueue->ucFlags = ucFlags;
+
+        traceSPSC_QUEUE_CREATE( pxQueue );
+    }
+
+#endif /* configUSE_SPSC_QUEUES */
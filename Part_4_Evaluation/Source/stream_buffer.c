@@ -316,6 +316,67 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
                                           StreamBufferCallbackFunction_t pxSendCompletedCallback,
                                           StreamBufferCallbackFunction_t pxReceiveCompletedCallback ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+/*
+ * Fills in pxSpans with the up to two contiguous regions of the buffer's
+ * storage area that hold xCount bytes starting at index xIndex.
+ */
+    static void prvGetSpans( const StreamBuffer_t * const pxStreamBuffer,
+                             StreamBufferSpans_t * const pxSpans,
+                             size_t xIndex,
+                             size_t xCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Obtains the spans into which up to xMaxBytes can be written in place, given
+ * xSpace bytes are free.  For a message buffer the spans start after the
+ * space needed for the message length.  Returns the total length of the spans.
+ */
+    static size_t prvReserveSpans( const StreamBuffer_t * const pxStreamBuffer,
+                                   StreamBufferSpans_t * const pxSpans,
+                                   size_t xMaxBytes,
+                                   size_t xSpace ) PRIVILEGED_FUNCTION;
+
+/*
+ * Makes xBytesWritten bytes written into reserved spans visible to the reader
+ * by moving xHead, writing the message length first for a message buffer.
+ */
+    static void prvCommitBytes( StreamBuffer_t * const pxStreamBuffer,
+                                size_t xBytesWritten ) PRIVILEGED_FUNCTION;
+
+/*
+ * Obtains the spans holding up to xMaxBytes of the next data to be read, or
+ * holding the next message for a message buffer, given xBytesAvailable bytes
+ * are in the buffer.  Returns the total length of the spans.
+ */
+    static size_t prvAcquireSpans( const StreamBuffer_t * const pxStreamBuffer,
+                                   StreamBufferSpans_t * const pxSpans,
+                                   size_t xMaxBytes,
+                                   size_t xBytesAvailable ) PRIVILEGED_FUNCTION;
+
+/*
+ * Frees the space used by xBytesRead bytes read from acquired spans by moving
+ * xTail, skipping the message length first for a message buffer.
+ */
+    static void prvReleaseBytes( StreamBuffer_t * const pxStreamBuffer,
+                                 size_t xBytesRead ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+
+#if ( configUSE_MESSAGE_BUFFER_BATCHING == 1 )
+
+/*
+ * Copies as many whole messages as fit into pucRxData, up to xMaxMessages,
+ * recording the offset of each within pucRxData in pxMessageOffsets, then moves
+ * xTail past all of them in one go.  Returns the number of messages copied.
+ */
+    static size_t prvReadMessagesFromBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                             uint8_t * pucRxData,
+                                             size_t xBufferLengthBytes,
+                                             size_t * const pxMessageOffsets,
+                                             size_t xMaxMessages,
+                                             size_t xBytesAvailable ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_MESSAGE_BUFFER_BATCHING */
+
 /*-----------------------------------------------------------*/
 #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
     StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes,
@@ -1072,6 +1133,520 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_MESSAGE_BUFFER_BATCHING == 1 )
+
+    size_t xStreamBufferReceiveMultiple( StreamBufferHandle_t xStreamBuffer,
+                                         void * pvRxData,
+                                         size_t xBufferLengthBytes,
+                                         size_t * const pxMessageOffsets,
+                                         size_t xMaxMessages,
+                                         TickType_t xTicksToWait )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xMessagesReceived = 0, xBytesAvailable;
+
+        configASSERT( pvRxData );
+        configASSERT( pxMessageOffsets );
+        configASSERT( pxStreamBuffer );
+
+        /* Only a message buffer holds discrete messages. */
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 );
+
+        if( xTicksToWait != ( TickType_t ) 0 )
+        {
+            /* Checking if there is data and clearing the notification state must
+             * be performed atomically. */
+            taskENTER_CRITICAL();
+            {
+                xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+                if( xBytesAvailable <= sbBYTES_TO_STORE_MESSAGE_LENGTH )
+                {
+                    /* Clear notification state as going to wait for data. */
+                    ( void ) xTaskNotifyStateClear( NULL );
+
+                    /* Should only be one reader. */
+                    configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+                    pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xBytesAvailable <= sbBYTES_TO_STORE_MESSAGE_LENGTH )
+            {
+                /* Wait for data to be available. */
+                traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
+                ( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+                pxStreamBuffer->xTaskWaitingToReceive = NULL;
+
+                /* Recheck the data available after blocking. */
+                xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+        }
+
+        xMessagesReceived = prvReadMessagesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xBufferLengthBytes, pxMessageOffsets, xMaxMessages, xBytesAvailable ); /*lint !e9079 Data storage area is implemented as uint8_t array for ease of sizing, indexing and alignment. */
+
+        if( xMessagesReceived != ( size_t ) 0 )
+        {
+            traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, pxMessageOffsets[ xMessagesReceived ] );
+
+            /* Was a task waiting for space in the buffer?  Notified once for the
+             * whole batch. */
+            prvRECEIVE_COMPLETED( xStreamBuffer );
+        }
+        else
+        {
+            traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer );
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xMessagesReceived;
+    }
+
+#endif /* configUSE_MESSAGE_BUFFER_BATCHING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MESSAGE_BUFFER_BATCHING == 1 )
+
+    size_t xStreamBufferReceiveMultipleFromISR( StreamBufferHandle_t xStreamBuffer,
+                                                void * pvRxData,
+                                                size_t xBufferLengthBytes,
+                                                size_t * const pxMessageOffsets,
+                                                size_t xMaxMessages,
+                                                BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xMessagesReceived;
+
+        configASSERT( pvRxData );
+        configASSERT( pxMessageOffsets );
+        configASSERT( pxStreamBuffer );
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 );
+
+        xMessagesReceived = prvReadMessagesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xBufferLengthBytes, pxMessageOffsets, xMaxMessages, prvBytesInBuffer( pxStreamBuffer ) ); /*lint !e9079 Data storage area is implemented as uint8_t array for ease of sizing, indexing and alignment. */
+
+        if( xMessagesReceived != ( size_t ) 0 )
+        {
+            prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, pxMessageOffsets[ xMessagesReceived ] );
+
+        return xMessagesReceived;
+    }
+
+#endif /* configUSE_MESSAGE_BUFFER_BATCHING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+                                     StreamBufferSpans_t * const pxSpans,
+                                     size_t xMaxBytes,
+                                     TickType_t xTicksToWait )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn, xSpace = 0;
+        size_t xRequiredSpace = xMaxBytes;
+        TimeOut_t xTimeOut;
+        size_t xMaxReportedSpace;
+
+        configASSERT( pxSpans );
+        configASSERT( pxStreamBuffer );
+        configASSERT( xMaxBytes > ( size_t ) 0 );
+
+        xMaxReportedSpace = pxStreamBuffer->xLength - ( size_t ) 1;
+
+        /* As per xStreamBufferSend(), a message buffer must be able to hold the
+         * whole message plus its length, whereas a stream buffer only needs to
+         * wait for as much space as the buffer can ever report. */
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+
+            /* Overflow? */
+            configASSERT( xRequiredSpace > xMaxBytes );
+
+            /* The length of the message that will be committed must fit within
+             * configMESSAGE_BUFFER_LENGTH_TYPE. */
+            configASSERT( ( size_t ) ( ( configMESSAGE_BUFFER_LENGTH_TYPE ) xMaxBytes ) == xMaxBytes );
+
+            if( xRequiredSpace > xMaxReportedSpace )
+            {
+                xTicksToWait = ( TickType_t ) 0;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            if( xRequiredSpace > xMaxReportedSpace )
+            {
+                xRequiredSpace = xMaxReportedSpace;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        if( xTicksToWait != ( TickType_t ) 0 )
+        {
+            vTaskSetTimeOutState( &xTimeOut );
+
+            do
+            {
+                taskENTER_CRITICAL();
+                {
+                    xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+
+                    if( xSpace < xRequiredSpace )
+                    {
+                        /* Clear notification state as going to wait for space. */
+                        ( void ) xTaskNotifyStateClear( NULL );
+
+                        /* Should only be one writer. */
+                        configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+                        pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+                    }
+                    else
+                    {
+                        taskEXIT_CRITICAL();
+                        break;
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
+                ( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+                pxStreamBuffer->xTaskWaitingToSend = NULL;
+            } while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xSpace == ( size_t ) 0 )
+        {
+            xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xReturn = prvReserveSpans( pxStreamBuffer, pxSpans, xMaxBytes, xSpace );
+
+        if( xReturn == ( size_t ) 0 )
+        {
+            traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    size_t xStreamBufferSendReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+                                            StreamBufferSpans_t * const pxSpans,
+                                            size_t xMaxBytes )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+        configASSERT( pxSpans );
+        configASSERT( pxStreamBuffer );
+        configASSERT( xMaxBytes > ( size_t ) 0 );
+
+        return prvReserveSpans( pxStreamBuffer, pxSpans, xMaxBytes, xStreamBufferSpacesAvailable( pxStreamBuffer ) );
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xBytesWritten )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+        configASSERT( pxStreamBuffer );
+
+        if( xBytesWritten > ( size_t ) 0 )
+        {
+            prvCommitBytes( pxStreamBuffer, xBytesWritten );
+            traceSTREAM_BUFFER_SEND( xStreamBuffer, xBytesWritten );
+
+            /* Was a task waiting for the data? */
+            if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+            {
+                prvSEND_COMPLETED( pxStreamBuffer );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xBytesWritten;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                           size_t xBytesWritten,
+                                           BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+        configASSERT( pxStreamBuffer );
+
+        if( xBytesWritten > ( size_t ) 0 )
+        {
+            prvCommitBytes( pxStreamBuffer, xBytesWritten );
+
+            /* Was a task waiting for the data? */
+            if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+            {
+                prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xBytesWritten );
+
+        return xBytesWritten;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    size_t xStreamBufferReceiveAcquire( StreamBufferHandle_t xStreamBuffer,
+                                        StreamBufferSpans_t * const pxSpans,
+                                        size_t xMaxBytes,
+                                        TickType_t xTicksToWait )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn = 0, xBytesAvailable, xBytesToStoreMessageLength;
+
+        configASSERT( pxSpans );
+        configASSERT( pxStreamBuffer );
+
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+        }
+        else
+        {
+            xBytesToStoreMessageLength = 0;
+        }
+
+        if( xTicksToWait != ( TickType_t ) 0 )
+        {
+            /* Checking if there is data and clearing the notification state must
+             * be performed atomically. */
+            taskENTER_CRITICAL();
+            {
+                xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+                if( xBytesAvailable <= xBytesToStoreMessageLength )
+                {
+                    /* Clear notification state as going to wait for data. */
+                    ( void ) xTaskNotifyStateClear( NULL );
+
+                    /* Should only be one reader. */
+                    configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+                    pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xBytesAvailable <= xBytesToStoreMessageLength )
+            {
+                /* Wait for data to be available. */
+                traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
+                ( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+                pxStreamBuffer->xTaskWaitingToReceive = NULL;
+
+                /* Recheck the data available after blocking. */
+                xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+        }
+
+        if( xBytesAvailable > xBytesToStoreMessageLength )
+        {
+            xReturn = prvAcquireSpans( pxStreamBuffer, pxSpans, xMaxBytes, xBytesAvailable );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xReturn == ( size_t ) 0 )
+        {
+            traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    size_t xStreamBufferReceiveAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+                                               StreamBufferSpans_t * const pxSpans,
+                                               size_t xMaxBytes )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn = 0, xBytesAvailable, xBytesToStoreMessageLength;
+
+        configASSERT( pxSpans );
+        configASSERT( pxStreamBuffer );
+
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+        }
+        else
+        {
+            xBytesToStoreMessageLength = 0;
+        }
+
+        xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+        if( xBytesAvailable > xBytesToStoreMessageLength )
+        {
+            xReturn = prvAcquireSpans( pxStreamBuffer, pxSpans, xMaxBytes, xBytesAvailable );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    size_t xStreamBufferReceiveRelease( StreamBufferHandle_t xStreamBuffer,
+                                        size_t xBytesRead )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+        configASSERT( pxStreamBuffer );
+
+        if( xBytesRead > ( size_t ) 0 )
+        {
+            prvReleaseBytes( pxStreamBuffer, xBytesRead );
+            traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xBytesRead );
+
+            /* Was a task waiting for space in the buffer? */
+            prvRECEIVE_COMPLETED( pxStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xBytesRead;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    size_t xStreamBufferReceiveReleaseFromISR( StreamBufferHandle_t xStreamBuffer,
+                                               size_t xBytesRead,
+                                               BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+        configASSERT( pxStreamBuffer );
+
+        if( xBytesRead > ( size_t ) 0 )
+        {
+            prvReleaseBytes( pxStreamBuffer, xBytesRead );
+
+            /* Was a task waiting for space in the buffer? */
+            prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xBytesRead );
+
+        return xBytesRead;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
 static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
                                         void * pvRxData,
                                         size_t xBufferLengthBytes,
@@ -1124,6 +1699,75 @@ static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_MESSAGE_BUFFER_BATCHING == 1 )
+
+    static size_t prvReadMessagesFromBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                             uint8_t * pucRxData,
+                                             size_t xBufferLengthBytes,
+                                             size_t * const pxMessageOffsets,
+                                             size_t xMaxMessages,
+                                             size_t xBytesAvailable )
+    {
+        size_t xMessages = 0, xBytesCopied = 0, xNextMessageLength;
+        size_t xNextTail = pxStreamBuffer->xTail, xTailAfterLength;
+        configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
+
+        /* Each message is stored as its length followed by its data, so walk
+         * the messages until one will not fit in the space left in pucRxData.
+         * The tail is only written once at the end, so the writer sees all the
+         * freed space at once. */
+        while( ( xMessages < xMaxMessages ) && ( xBytesAvailable > sbBYTES_TO_STORE_MESSAGE_LENGTH ) )
+        {
+            xTailAfterLength = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextTail );
+            xNextMessageLength = ( size_t ) xTempNextMessageLength;
+            configASSERT( xNextMessageLength <= ( xBytesAvailable - sbBYTES_TO_STORE_MESSAGE_LENGTH ) );
+
+            if( xNextMessageLength > ( xBufferLengthBytes - xBytesCopied ) )
+            {
+                /* The next message does not fit, so leave it in the buffer. */
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxMessageOffsets[ xMessages ] = xBytesCopied;
+
+            if( xNextMessageLength != ( size_t ) 0 )
+            {
+                xTailAfterLength = prvReadBytesFromBuffer( pxStreamBuffer, &( pucRxData[ xBytesCopied ] ), xNextMessageLength, xTailAfterLength );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xNextTail = xTailAfterLength;
+            xBytesCopied += xNextMessageLength;
+            xBytesAvailable -= ( sbBYTES_TO_STORE_MESSAGE_LENGTH + xNextMessageLength );
+            xMessages++;
+        }
+
+        /* The entry after the last message marks the end of the data, so the
+         * length of message n is always offset n + 1 minus offset n. */
+        pxMessageOffsets[ xMessages ] = xBytesCopied;
+
+        if( xMessages != ( size_t ) 0 )
+        {
+            pxStreamBuffer->xTail = xNextTail;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xMessages;
+    }
+
+#endif /* configUSE_MESSAGE_BUFFER_BATCHING */
+/*-----------------------------------------------------------*/
+
 BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer )
 {
     const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
@@ -1356,6 +2000,210 @@ static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    static void prvGetSpans( const StreamBuffer_t * const pxStreamBuffer,
+                             StreamBufferSpans_t * const pxSpans,
+                             size_t xIndex,
+                             size_t xCount )
+    {
+        if( xIndex >= pxStreamBuffer->xLength )
+        {
+            xIndex -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* The first span runs from xIndex up to the end of the storage area at
+         * most, the second, if any, holds the remainder from the start of the
+         * storage area. */
+        pxSpans->pucFirst = &( pxStreamBuffer->pucBuffer[ xIndex ] );
+        pxSpans->xFirstLength = configMIN( pxStreamBuffer->xLength - xIndex, xCount );
+
+        if( xCount > pxSpans->xFirstLength )
+        {
+            pxSpans->pucSecond = pxStreamBuffer->pucBuffer;
+            pxSpans->xSecondLength = xCount - pxSpans->xFirstLength;
+        }
+        else
+        {
+            pxSpans->pucSecond = NULL;
+            pxSpans->xSecondLength = 0;
+        }
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    static size_t prvReserveSpans( const StreamBuffer_t * const pxStreamBuffer,
+                                   StreamBufferSpans_t * const pxSpans,
+                                   size_t xMaxBytes,
+                                   size_t xSpace )
+    {
+        size_t xCount;
+
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            /* The whole message must fit.  Leave room in front of the message
+             * for its length, which is only written when the message is
+             * committed. */
+            if( xSpace >= ( xMaxBytes + sbBYTES_TO_STORE_MESSAGE_LENGTH ) )
+            {
+                prvGetSpans( pxStreamBuffer, pxSpans, pxStreamBuffer->xHead + sbBYTES_TO_STORE_MESSAGE_LENGTH, xMaxBytes );
+                xCount = xMaxBytes;
+            }
+            else
+            {
+                xCount = 0;
+            }
+        }
+        else
+        {
+            xCount = configMIN( xMaxBytes, xSpace );
+
+            if( xCount != ( size_t ) 0 )
+            {
+                prvGetSpans( pxStreamBuffer, pxSpans, pxStreamBuffer->xHead, xCount );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xCount;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    static void prvCommitBytes( StreamBuffer_t * const pxStreamBuffer,
+                                size_t xBytesWritten )
+    {
+        size_t xNextHead = pxStreamBuffer->xHead;
+        configMESSAGE_BUFFER_LENGTH_TYPE xMessageLength;
+
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            /* The message was written after the space reserved for its length,
+             * so the length can now be filled in. */
+            configASSERT( ( xBytesWritten + sbBYTES_TO_STORE_MESSAGE_LENGTH ) <= xStreamBufferSpacesAvailable( pxStreamBuffer ) );
+            xMessageLength = ( configMESSAGE_BUFFER_LENGTH_TYPE ) xBytesWritten;
+            xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xMessageLength ), sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextHead );
+        }
+        else
+        {
+            configASSERT( xBytesWritten <= xStreamBufferSpacesAvailable( pxStreamBuffer ) );
+        }
+
+        xNextHead += xBytesWritten;
+
+        if( xNextHead >= pxStreamBuffer->xLength )
+        {
+            xNextHead -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Only now does the data become visible to the reader. */
+        pxStreamBuffer->xHead = xNextHead;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    static size_t prvAcquireSpans( const StreamBuffer_t * const pxStreamBuffer,
+                                   StreamBufferSpans_t * const pxSpans,
+                                   size_t xMaxBytes,
+                                   size_t xBytesAvailable )
+    {
+        size_t xCount;
+        configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
+
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            /* Peek the length of the next message without consuming it. */
+            ( void ) prvReadBytesFromBuffer( ( StreamBuffer_t * ) pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, pxStreamBuffer->xTail ); /*lint !e9005 prvReadBytesFromBuffer() does not modify the stream buffer. */
+            xCount = ( size_t ) xTempNextMessageLength;
+
+            if( xCount <= xMaxBytes )
+            {
+                prvGetSpans( pxStreamBuffer, pxSpans, pxStreamBuffer->xTail + sbBYTES_TO_STORE_MESSAGE_LENGTH, xCount );
+            }
+            else
+            {
+                /* The caller cannot accept the whole message. */
+                xCount = 0;
+            }
+        }
+        else
+        {
+            xCount = configMIN( xMaxBytes, xBytesAvailable );
+
+            if( xCount != ( size_t ) 0 )
+            {
+                prvGetSpans( pxStreamBuffer, pxSpans, pxStreamBuffer->xTail, xCount );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xCount;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    static void prvReleaseBytes( StreamBuffer_t * const pxStreamBuffer,
+                                 size_t xBytesRead )
+    {
+        size_t xNextTail = pxStreamBuffer->xTail;
+        configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
+
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            /* Messages are released whole, so xBytesRead must be the length of
+             * the acquired message. */
+            xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextTail );
+            configASSERT( ( size_t ) xTempNextMessageLength == xBytesRead );
+        }
+        else
+        {
+            configASSERT( xBytesRead <= prvBytesInBuffer( pxStreamBuffer ) );
+        }
+
+        xNextTail += xBytesRead;
+
+        if( xNextTail >= pxStreamBuffer->xLength )
+        {
+            xNextTail -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Only now does the space become visible to the writer. */
+        pxStreamBuffer->xTail = xNextTail;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
 static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
                                           uint8_t * const pucBuffer,
                                           size_t xBufferSizeBytes,
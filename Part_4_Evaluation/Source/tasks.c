@@ -27,6 +27,7 @@
  */
 
 /* Standard includes. */
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
@@ -86,12 +87,22 @@
 /* If any of the following are set then task stacks are filled with a known
  * value so the high water mark can be determined.  If none of the following are
  * set then don't fill the stack so there is no unnecessary dependency on memset. */
-#if ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( configUSE_STACK_PROFILING == 1 ) )
     #define tskSET_NEW_STACKS_TO_KNOWN_VALUE    1
 #else
     #define tskSET_NEW_STACKS_TO_KNOWN_VALUE    0
 #endif
 
+/* If configPAINT_STACK_GUARD_ONLY is 1 then only this many bytes at the limit
+ * of each stack are filled with the known value - configSTACK_GUARD_DEPTH
+ * words, but never fewer than the 20 bytes checked when
+ * configCHECK_FOR_STACK_OVERFLOW is 2. */
+#if ( configPAINT_STACK_GUARD_ONLY == 1 )
+    #define tskSTACK_GUARD_BYTES                                                                  \
+    ( ( ( ( size_t ) configSTACK_GUARD_DEPTH * sizeof( StackType_t ) ) > ( size_t ) 20U ) ? \
+      ( ( size_t ) configSTACK_GUARD_DEPTH * sizeof( StackType_t ) ) : ( size_t ) 20U )
+#endif
+
 /*
  * Macros used by vListTask to indicate which state a task is in.
  */
@@ -232,22 +243,60 @@
 
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+/* The delayed task wheel is indexed modulo the tick count so there are no
+ * lists to switch when the tick count overflows, but wake times beyond the
+ * overflow can now be held in xNextTaskUnblockTime. */
+    #define taskSWITCH_DELAYED_LISTS()   \
+    {                                    \
+        xNumOfOverflows++;               \
+        prvResetNextTaskUnblockTime();   \
+    }
+
+/* Place a delayed task's state list item in the wheel.  pxList, which would
+ * name the delayed or overflow delayed list, is not needed. */
+    #define taskINSERT_DELAYED_TASK( pxList, pxListItem )    vListWheelInsert( &xDelayedTaskWheel, ( pxListItem ) )
+
+#else /* configUSE_DELAYED_TASK_WHEEL */
+
 /* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
  * count overflows. */
-#define taskSWITCH_DELAYED_LISTS()                                                \
-    {                                                                             \
-        List_t * pxTemp;                                                          \
-                                                                                  \
-        /* The delayed tasks list should be empty when the lists are switched. */ \
-        configASSERT( ( listLIST_IS_EMPTY( pxDelayedTaskList ) ) );               \
-                                                                                  \
-        pxTemp = pxDelayedTaskList;                                               \
-        pxDelayedTaskList = pxOverflowDelayedTaskList;                            \
-        pxOverflowDelayedTaskList = pxTemp;                                       \
-        xNumOfOverflows++;                                                        \
-        prvResetNextTaskUnblockTime();                                            \
+    #define taskSWITCH_DELAYED_LISTS()                                                \
+    {                                                                                 \
+        List_t * pxTemp;                                                              \
+                                                                                      \
+        /* The delayed tasks list should be empty when the lists are switched. */     \
+        configASSERT( ( listLIST_IS_EMPTY( pxDelayedTaskList ) ) );                   \
+                                                                                      \
+        pxTemp = pxDelayedTaskList;                                                   \
+        pxDelayedTaskList = pxOverflowDelayedTaskList;                                \
+        pxOverflowDelayedTaskList = pxTemp;                                           \
+        xNumOfOverflows++;                                                            \
+        prvResetNextTaskUnblockTime();                                                \
     }
 
+/* Place a delayed task's state list item in pxList in wake time order. */
+    #define taskINSERT_DELAYED_TASK( pxList, pxListItem )    vListInsert( ( pxList ), ( pxListItem ) )
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
+#if ( configUSE_TIMER_SLACK == 1 )
+
+/* The latest time at which the task pxTCB, due to wake at xTimeToWake, may be
+ * removed from the Blocked state.  A time past the tick count overflow is held
+ * at portMAX_DELAY, as the delayed task list must be empty by the time the
+ * tick count overflows. */
+    #define taskGET_WAKE_DEADLINE( xTimeToWake, pxTCB )                                   \
+    ( ( ( TickType_t ) ( ( xTimeToWake ) + ( pxTCB )->xDelaySlack ) < ( xTimeToWake ) ) ? \
+      portMAX_DELAY : ( TickType_t ) ( ( xTimeToWake ) + ( pxTCB )->xDelaySlack ) )
+
+#else
+
+    #define taskGET_WAKE_DEADLINE( xTimeToWake, pxTCB )    ( xTimeToWake )
+
+#endif /* configUSE_TIMER_SLACK */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -288,83 +337,211 @@
  * and stores task state information, including a pointer to the task's context
  * (the task's run time environment, including register values)
  */
-typedef struct tskTaskControlBlock       /* The old naming convention is used to prevent breaking kernel aware debuggers. */
-{
-    volatile StackType_t * pxTopOfStack; /*< Points to the location of the last item placed on the tasks stack.  THIS MUST BE THE FIRST MEMBER OF THE TCB STRUCT. */
+#if ( configUSE_COMPACT_TCB == 1 )
+
+/* The compact layout, used when configUSE_COMPACT_TCB is 1.  The fields used on
+ * every context switch come first.  Priorities, counters and flags are narrowed
+ * to a byte each and kept together, with the name, so the compiler only pads
+ * once at the end of the structure.  The application task tag and the thread
+ * local storage pointers are held in xTaskSideTable.  Field names are the same
+ * as in the standard layout below.  StaticTask_t must be kept in step. */
+    typedef struct tskTaskControlBlock       /* The old naming convention is used to prevent breaking kernel aware debuggers. */
+    {
+        volatile StackType_t * pxTopOfStack; /*< Points to the location of the last item placed on the tasks stack.  THIS MUST BE THE FIRST MEMBER OF THE TCB STRUCT. */
 
-    #if ( portUSING_MPU_WRAPPERS == 1 )
-        xMPU_SETTINGS xMPUSettings; /*< The MPU settings are defined as part of the port layer.  THIS MUST BE THE SECOND MEMBER OF THE TCB STRUCT. */
-    #endif
+        #if ( portUSING_MPU_WRAPPERS == 1 )
+            xMPU_SETTINGS xMPUSettings; /*< The MPU settings are defined as part of the port layer.  THIS MUST BE THE SECOND MEMBER OF THE TCB STRUCT. */
+        #endif
 
-    ListItem_t xStateListItem;                  /*< The list that the state list item of a task is reference from denotes the state of that task (Ready, Blocked, Suspended ). */
-    ListItem_t xEventListItem;                  /*< Used to reference a task from an event list. */
-    UBaseType_t uxPriority;                     /*< The priority of the task.  0 is the lowest priority. */
-    StackType_t * pxStack;                      /*< Points to the start of the stack. */
-    char pcTaskName[ configMAX_TASK_NAME_LEN ]; /*< Descriptive name given to the task when created.  Facilitates debugging only. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+        ListItem_t xStateListItem; /*< The list that the state list item of a task is reference from denotes the state of that task (Ready, Blocked, Suspended ). */
+        ListItem_t xEventListItem; /*< Used to reference a task from an event list. */
+        StackType_t * pxStack;     /*< Points to the start of the stack. */
 
-    #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
-        StackType_t * pxEndOfStack; /*< Points to the highest valid address for the stack. */
-    #endif
+        #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
+            StackType_t * pxEndOfStack; /*< Points to the highest valid address for the stack. */
+        #endif
 
-    #if ( portCRITICAL_NESTING_IN_TCB == 1 )
-        UBaseType_t uxCriticalNesting; /*< Holds the critical section nesting depth for ports that do not maintain their own count in the port layer. */
-    #endif
+        #if ( portCRITICAL_NESTING_IN_TCB == 1 )
+            UBaseType_t uxCriticalNesting; /*< Holds the critical section nesting depth for ports that do not maintain their own count in the port layer. */
+        #endif
 
-    #if ( configUSE_TRACE_FACILITY == 1 )
-        UBaseType_t uxTCBNumber;  /*< Stores a number that increments each time a TCB is created.  It allows debuggers to determine when a task has been deleted and then recreated. */
-        UBaseType_t uxTaskNumber; /*< Stores a number specifically for use by third party trace code. */
-    #endif
+        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            configRUN_TIME_COUNTER_TYPE ulRunTimeCounter; /*< Stores the amount of time the task has spent in the Running state. */
+        #endif
 
-    #if ( configUSE_MUTEXES == 1 )
-        UBaseType_t uxBasePriority; /*< The priority last assigned to the task - used by the priority inheritance mechanism. */
-        UBaseType_t uxMutexesHeld;
-    #endif
+        #if ( ( configUSE_NEWLIB_REENTRANT == 1 ) || ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) )
+            configTLS_BLOCK_TYPE xTLSBlock; /*< Memory block used as Thread Local Storage (TLS) Block for the task. */
+        #endif
 
-    #if ( configUSE_APPLICATION_TASK_TAG == 1 )
-        TaskHookFunction_t pxTaskTag;
-    #endif
+        #if ( configUSE_POSIX_ERRNO == 1 )
+            int iTaskErrno;
+        #endif
 
-    #if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
-        void * pvThreadLocalStoragePointers[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
-    #endif
+        #if ( configUSE_TIMER_SLACK == 1 )
+            TickType_t xDelaySlack; /*< How many ticks late the task may leave the Blocked state.  Set by vTaskSetDelaySlack(). */
+        #endif
 
-    #if ( configGENERATE_RUN_TIME_STATS == 1 )
-        configRUN_TIME_COUNTER_TYPE ulRunTimeCounter; /*< Stores the amount of time the task has spent in the Running state. */
-    #endif
+        #if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+            uint64_t ullWideEventItemValue; /*< The event bits waited for, or that unblocked the task, when the task blocks on an event group. */
+        #endif
 
-    #if ( ( configUSE_NEWLIB_REENTRANT == 1 ) || ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) )
-        configTLS_BLOCK_TYPE xTLSBlock; /*< Memory block used as Thread Local Storage (TLS) Block for the task. */
-    #endif
+        #if ( configUSE_TRACE_FACILITY == 1 )
+            UBaseType_t uxTCBNumber;  /*< Stores a number that increments each time a TCB is created. */
+            UBaseType_t uxTaskNumber; /*< Stores a number specifically for use by third party trace code. */
+        #endif
 
-    #if ( configUSE_TASK_NOTIFICATIONS == 1 )
-        volatile uint32_t ulNotifiedValue[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
-        volatile uint8_t ucNotifyState[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
-    #endif
+        #if ( configUSE_HEAP_ACCOUNTING == 1 )
+            TaskHeapUsage_t xHeapUsage; /*< The heap memory charged to the task.  Only updated by the heap with the scheduler suspended. */
+        #endif
 
-    /* See the comments in FreeRTOS.h with the definition of
-     * tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE. */
-    #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
-        uint8_t ucStaticallyAllocated;                     /*< Set to pdTRUE if the task is a statically allocated to ensure no attempt is made to free the memory. */
-    #endif
+        #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+            volatile uint32_t ulNotifiedValue[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+        #endif
 
-    #if ( INCLUDE_xTaskAbortDelay == 1 )
-        uint8_t ucDelayAborted;
-    #endif
+        uint8_t uxPriority; /*< The priority of the task.  0 is the lowest priority. */
 
-    #if ( configUSE_POSIX_ERRNO == 1 )
-        int iTaskErrno;
-    #endif
+        #if ( configUSE_MUTEXES == 1 )
+            uint8_t uxBasePriority; /*< The priority last assigned to the task - used by the priority inheritance mechanism. */
+            uint8_t uxMutexesHeld;
+        #endif
 
-	#if ( configUSE_TICKETS == 1)
-        int nTickets;
-	#endif
+        #if ( configUSE_TICKETS == 1 )
+            uint8_t nTickets;     /*< The number of lottery tickets held by the task.  Never more than 100. */
+            uint8_t nBaseTickets; /*< The tickets last assigned to the task - used by the ticket inheritance mechanism. */
+        #endif
+
+        #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+            volatile uint8_t ucNotifyState[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+        #endif
+
+        #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+            uint8_t ucStaticallyAllocated;                     /*< Set to pdTRUE if the task is a statically allocated to ensure no attempt is made to free the memory. */
+        #endif
+
+        #if ( INCLUDE_xTaskAbortDelay == 1 )
+            uint8_t ucDelayAborted;
+        #endif
+
+        #if ( tskUSE_TASK_SIDE_TABLE == 1 )
+            uint8_t ucSideTableIndex; /*< One more than the index of the task's entry in xTaskSideTable, or 0 if the task does not have an entry. */
+        #endif
+
+        char pcTaskName[ configMAX_TASK_NAME_LEN ]; /*< Descriptive name given to the task when created.  Facilitates debugging only. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    } tskTCB;
+
+#else /* configUSE_COMPACT_TCB */
 
-} tskTCB;
+    typedef struct tskTaskControlBlock       /* The old naming convention is used to prevent breaking kernel aware debuggers. */
+    {
+        volatile StackType_t * pxTopOfStack; /*< Points to the location of the last item placed on the tasks stack.  THIS MUST BE THE FIRST MEMBER OF THE TCB STRUCT. */
+
+        #if ( portUSING_MPU_WRAPPERS == 1 )
+            xMPU_SETTINGS xMPUSettings; /*< The MPU settings are defined as part of the port layer.  THIS MUST BE THE SECOND MEMBER OF THE TCB STRUCT. */
+        #endif
+
+        ListItem_t xStateListItem;                  /*< The list that the state list item of a task is reference from denotes the state of that task (Ready, Blocked, Suspended ). */
+        ListItem_t xEventListItem;                  /*< Used to reference a task from an event list. */
+        UBaseType_t uxPriority;                     /*< The priority of the task.  0 is the lowest priority. */
+        StackType_t * pxStack;                      /*< Points to the start of the stack. */
+        char pcTaskName[ configMAX_TASK_NAME_LEN ]; /*< Descriptive name given to the task when created.  Facilitates debugging only. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+        #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
+            StackType_t * pxEndOfStack; /*< Points to the highest valid address for the stack. */
+        #endif
+
+        #if ( portCRITICAL_NESTING_IN_TCB == 1 )
+            UBaseType_t uxCriticalNesting; /*< Holds the critical section nesting depth for ports that do not maintain their own count in the port layer. */
+        #endif
+
+        #if ( configUSE_TRACE_FACILITY == 1 )
+            UBaseType_t uxTCBNumber;  /*< Stores a number that increments each time a TCB is created.  It allows debuggers to determine when a task has been deleted and then recreated. */
+            UBaseType_t uxTaskNumber; /*< Stores a number specifically for use by third party trace code. */
+        #endif
+
+        #if ( configUSE_MUTEXES == 1 )
+            UBaseType_t uxBasePriority; /*< The priority last assigned to the task - used by the priority inheritance mechanism. */
+            UBaseType_t uxMutexesHeld;
+        #endif
+
+        #if ( configUSE_APPLICATION_TASK_TAG == 1 )
+            TaskHookFunction_t pxTaskTag;
+        #endif
+
+        #if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
+            void * pvThreadLocalStoragePointers[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
+        #endif
+
+        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            configRUN_TIME_COUNTER_TYPE ulRunTimeCounter; /*< Stores the amount of time the task has spent in the Running state. */
+        #endif
+
+        #if ( ( configUSE_NEWLIB_REENTRANT == 1 ) || ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) )
+            configTLS_BLOCK_TYPE xTLSBlock; /*< Memory block used as Thread Local Storage (TLS) Block for the task. */
+        #endif
+
+        #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+            volatile uint32_t ulNotifiedValue[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+            volatile uint8_t ucNotifyState[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+        #endif
+
+        /* See the comments in FreeRTOS.h with the definition of
+         * tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE. */
+        #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+            uint8_t ucStaticallyAllocated;                     /*< Set to pdTRUE if the task is a statically allocated to ensure no attempt is made to free the memory. */
+        #endif
+
+        #if ( INCLUDE_xTaskAbortDelay == 1 )
+            uint8_t ucDelayAborted;
+        #endif
+
+        #if ( configUSE_POSIX_ERRNO == 1 )
+            int iTaskErrno;
+        #endif
+
+        #if ( configUSE_TIMER_SLACK == 1 )
+            TickType_t xDelaySlack; /*< How many ticks late the task may leave the Blocked state.  Set by vTaskSetDelaySlack(). */
+        #endif
+
+        #if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+            uint64_t ullWideEventItemValue; /*< The event bits waited for, or that unblocked the task, when the task blocks on an event group.  Too wide for xEventListItem's value. */
+        #endif
+
+        #if ( configUSE_HEAP_ACCOUNTING == 1 )
+            TaskHeapUsage_t xHeapUsage; /*< The heap memory charged to the task.  Only updated by the heap with the scheduler suspended. */
+        #endif
+
+        #if ( configUSE_TICKETS == 1 )
+            int nTickets;     /*< The number of lottery tickets held by the task. */
+            int nBaseTickets; /*< The tickets last assigned to the task - used by the ticket inheritance mechanism. */
+        #endif
+
+    } tskTCB;
+#endif /* configUSE_COMPACT_TCB */
 
 /* The old tskTCB name is maintained above then typedefed to the new TCB_t name
  * below to enable the use of older kernel aware debuggers. */
 typedef tskTCB TCB_t;
 
+#if ( tskUSE_TASK_SIDE_TABLE == 1 )
+
+/* An entry in xTaskSideTable, holding the fields the compact TCB does not.  An
+ * entry is assigned to a task the first time the task needs one, and released
+ * when the task is deleted. */
+    typedef struct tskTaskSideTableEntry
+    {
+        TCB_t * pxOwner; /*< The task the entry is assigned to, or NULL if the entry is free. */
+
+        #if ( configUSE_APPLICATION_TASK_TAG == 1 )
+            TaskHookFunction_t pxTaskTag;
+        #endif
+
+        #if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
+            void * pvThreadLocalStoragePointers[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
+        #endif
+    } TaskSideTableEntry_t;
+
+#endif /* tskUSE_TASK_SIDE_TABLE */
+
 /*lint -save -e956 A manual analysis and inspection has been used to determine
  * which static variables must be declared volatile. */
 portDONT_DISCARD PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
@@ -374,10 +551,16 @@ portDONT_DISCARD PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
  * doing so breaks some kernel aware debuggers and debuggers that rely on removing
  * the static qualifier. */
 PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ]; /*< Prioritised ready tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList1;                         /*< Delayed tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList2;                         /*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
-PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;              /*< Points to the delayed task list currently being used. */
-PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;      /*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+    PRIVILEGED_DATA static ListWheel_t xDelayedTaskWheel; /*< Delayed tasks, filed by wake time.  Replaces the two delayed task lists. */
+#else
+    PRIVILEGED_DATA static List_t xDelayedTaskList1;                    /*< Delayed tasks. */
+    PRIVILEGED_DATA static List_t xDelayedTaskList2;                    /*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+    PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;         /*< Points to the delayed task list currently being used. */
+    PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList; /*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+#endif
+
 PRIVILEGED_DATA static List_t xPendingReadyList;                         /*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
 #if ( INCLUDE_vTaskDelete == 1 )
@@ -387,6 +570,30 @@ PRIVILEGED_DATA static List_t xPendingReadyList;                         /*< Tas
 
 #endif
 
+#if ( configUSE_TASK_RECYCLING == 1 )
+
+    PRIVILEGED_DATA static TCB_t * pxRecycledTasks[ configTASK_RECYCLE_POOL_LENGTH ]; /*< TCBs of deleted tasks, each still holding its stack of configTASK_RECYCLE_STACK_DEPTH words, kept for reuse by xTaskCreate(). */
+    PRIVILEGED_DATA static UBaseType_t uxRecycledTasks = ( UBaseType_t ) 0U;
+
+    #if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
+        PRIVILEGED_DATA static volatile UBaseType_t uxRecycledStacksToPaint = ( UBaseType_t ) 0U; /*< The number of TCBs in pxRecycledTasks[] whose stacks the idle task has yet to repaint. */
+    #endif
+
+#endif
+
+#if ( tskUSE_TASK_SIDE_TABLE == 1 )
+
+    PRIVILEGED_DATA static TaskSideTableEntry_t xTaskSideTable[ configTASK_SIDE_TABLE_LENGTH ]; /*< The application task tags and thread local storage pointers of tasks that use them. */
+
+#endif
+
+#if ( configUSE_STACK_PROFILING == 1 )
+
+    PRIVILEGED_DATA static TaskStackProfile_t xStackProfile[ configSTACK_PROFILE_LENGTH ]; /*< The peak stack usage of each task name seen since the scheduler started. */
+    PRIVILEGED_DATA static UBaseType_t uxStackProfileEntries = ( UBaseType_t ) 0U;
+
+#endif
+
 #if ( INCLUDE_vTaskSuspend == 1 )
 
     PRIVILEGED_DATA static List_t xSuspendedTaskList; /*< Tasks that are currently suspended. */
@@ -484,6 +691,69 @@ static portTASK_FUNCTION_PROTO( prvIdleTask, pvParameters ) PRIVILEGED_FUNCTION;
 
 #endif
 
+/*
+ * Free the dynamically allocated stack and TCB of a deleted task or, if
+ * configUSE_TASK_RECYCLING is 1, keep them for reuse by xTaskCreate() if the
+ * stack is of the recycled depth and the recycle pool is not full.
+ */
+#if ( ( INCLUDE_vTaskDelete == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+    static void prvFreeStackAndTCB( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Create the tasks listed in the application's static task table.  Called by
+ * vTaskStartScheduler().
+ */
+#if ( configUSE_STATIC_TASK_TABLE == 1 )
+
+    static BaseType_t prvCreateTableTasks( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Take a TCB, with the painted stack it holds, from the recycle pool.  Returns
+ * NULL if the pool is empty.
+ */
+#if ( configUSE_TASK_RECYCLING == 1 )
+
+    static TCB_t * prvTakeRecycledTCB( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Add the TCB of a deleted task to the recycle pool.  Returns pdFALSE if the
+ * pool is full, in which case the caller must free the TCB and its stack.
+ */
+#if ( configUSE_TASK_RECYCLING == 1 )
+
+    static BaseType_t prvAddTCBToRecyclePool( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Called by the idle task to repaint the stacks of TCBs added to the recycle
+ * pool since it last ran, so the task that deleted them does not have to.
+ */
+#if ( ( configUSE_TASK_RECYCLING == 1 ) && ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 ) )
+
+    static void prvPaintRecycledStacks( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Return the side table entry of the task whose TCB is pxTCB.  If the task does
+ * not have an entry then a free entry is assigned to it if xAssign is pdTRUE,
+ * otherwise NULL is returned.  NULL is also returned if no entry is free.
+ */
+#if ( tskUSE_TASK_SIDE_TABLE == 1 )
+
+    static TaskSideTableEntry_t * prvGetSideTableEntry( TCB_t * pxTCB,
+                                                        BaseType_t xAssign ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Used only by the idle task.  This checks to see if anything has been placed
  * in the list of tasks waiting to be deleted.  If so the task is cleaned up
@@ -530,12 +800,43 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  * This function determines the 'high water mark' of the task stack by
  * determining how much of the stack remains at the original preset value.
  */
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( configUSE_STACK_PROFILING == 1 ) )
 
     static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte ) PRIVILEGED_FUNCTION;
 
 #endif
 
+/*
+ * Fill a new stack of ulStackDepth words with tskSTACK_FILL_BYTE, or only its
+ * guard bytes if configPAINT_STACK_GUARD_ONLY is 1.
+ */
+#if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
+
+    static void prvFillStack( StackType_t * pxStack,
+                              uint32_t ulStackDepth ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Merge the stack usage of the task whose TCB is pxTCB into the stack profile
+ * entry for the task's name, creating the entry if there is none and the
+ * profile is not full.
+ */
+#if ( configUSE_STACK_PROFILING == 1 )
+
+    static void prvRecordStackProfile( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Call prvRecordStackProfile() for each task referenced from pxList.
+ */
+#if ( configUSE_STACK_PROFILING == 1 )
+
+    static void prvRecordStackProfilesWithinSingleList( List_t * pxList ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Return the amount of time, in ticks, that will pass before the kernel will
  * next move a task from the Blocked state to the Running state.
@@ -609,7 +910,8 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                                     void * const pvParameters,
                                     UBaseType_t uxPriority,
                                     StackType_t * const puxStackBuffer,
-                                    StaticTask_t * const pxTaskBuffer )
+                                    StaticTask_t * const pxTaskBuffer,
+                                    int pxTicketNumber )
     {
         TCB_t * pxNewTCB;
         TaskHandle_t xReturn;
@@ -644,7 +946,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             }
             #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
 
-            prvInitialiseNewTask( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, &xReturn, pxNewTCB, NULL );
+            prvInitialiseNewTask( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, &xReturn, pxTicketNumber, pxNewTCB, NULL );
             prvAddNewTaskToReadyList( pxNewTCB );
         }
         else
@@ -721,7 +1023,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             /* Allocate space for the TCB.  Where the memory comes from depends
              * on the implementation of the port malloc function and whether or
              * not static allocation is being used. */
-            pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+            pxNewTCB = ( TCB_t * ) pvPortMallocObject( sizeof( TCB_t ) );
 
             if( pxNewTCB != NULL )
             {
@@ -768,68 +1070,93 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                             TaskHandle_t * const pxCreatedTask,
 							int pxTicketNumber)
     {
-        TCB_t * pxNewTCB;
+        TCB_t * pxNewTCB = NULL;
         BaseType_t xReturn;
+        configSTACK_DEPTH_TYPE uxStackDepth = usStackDepth;
 
-        /* If the stack grows down then allocate the stack then the TCB so the stack
-         * does not grow into the TCB.  Likewise if the stack grows up then allocate
-         * the TCB then the stack. */
-        #if ( portSTACK_GROWTH > 0 )
+        #if ( configUSE_TASK_RECYCLING == 1 )
         {
-            /* Allocate space for the TCB.  Where the memory comes from depends on
-             * the implementation of the port malloc function and whether or not static
-             * allocation is being used. */
-            pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
-
-            if( pxNewTCB != NULL )
+            /* Stacks no deeper than the recycled depth are given exactly that
+             * depth, so the task can reuse the TCB and stack of a deleted task
+             * and its own can be recycled when it is deleted. */
+            if( uxStackDepth <= ( configSTACK_DEPTH_TYPE ) configTASK_RECYCLE_STACK_DEPTH )
             {
-                memset( ( void * ) pxNewTCB, 0x00, sizeof( TCB_t ) );
-
-                /* Allocate space for the stack used by the task being created.
-                 * The base of the stack memory stored in the TCB so the task can
-                 * be deleted later if required. */
-                pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocStack( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-
-                if( pxNewTCB->pxStack == NULL )
-                {
-                    /* Could not allocate the stack.  Delete the allocated TCB. */
-                    vPortFree( pxNewTCB );
-                    pxNewTCB = NULL;
-                }
+                uxStackDepth = ( configSTACK_DEPTH_TYPE ) configTASK_RECYCLE_STACK_DEPTH;
+                pxNewTCB = prvTakeRecycledTCB();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
         }
-        #else /* portSTACK_GROWTH */
-        {
-            StackType_t * pxStack;
+        #endif /* configUSE_TASK_RECYCLING */
 
-            /* Allocate space for the stack used by the task being created. */
-            pxStack = pvPortMallocStack( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation is the stack. */
-
-            if( pxStack != NULL )
+        if( pxNewTCB == NULL )
+        {
+            /* If the stack grows down then allocate the stack then the TCB so the stack
+             * does not grow into the TCB.  Likewise if the stack grows up then allocate
+             * the TCB then the stack. */
+            #if ( portSTACK_GROWTH > 0 )
             {
-                /* Allocate space for the TCB. */
-                pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of TCB_t is always a pointer to the task's stack. */
+                /* Allocate space for the TCB.  Where the memory comes from depends on
+                 * the implementation of the port malloc function and whether or not static
+                 * allocation is being used. */
+                pxNewTCB = ( TCB_t * ) pvPortMallocObject( sizeof( TCB_t ) );
 
                 if( pxNewTCB != NULL )
                 {
                     memset( ( void * ) pxNewTCB, 0x00, sizeof( TCB_t ) );
 
-                    /* Store the stack location in the TCB. */
-                    pxNewTCB->pxStack = pxStack;
+                    /* Allocate space for the stack used by the task being created.
+                     * The base of the stack memory stored in the TCB so the task can
+                     * be deleted later if required. */
+                    pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocStack( ( ( ( size_t ) uxStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+                    if( pxNewTCB->pxStack == NULL )
+                    {
+                        /* Could not allocate the stack.  Delete the allocated TCB. */
+                        vPortFreeObject( pxNewTCB );
+                        pxNewTCB = NULL;
+                    }
+                }
+            }
+            #else /* portSTACK_GROWTH */
+            {
+                StackType_t * pxStack;
+
+                /* Allocate space for the stack used by the task being created. */
+                pxStack = pvPortMallocStack( ( ( ( size_t ) uxStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation is the stack. */
+
+                if( pxStack != NULL )
+                {
+                    /* Allocate space for the TCB. */
+                    pxNewTCB = ( TCB_t * ) pvPortMallocObject( sizeof( TCB_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of TCB_t is always a pointer to the task's stack. */
+
+                    if( pxNewTCB != NULL )
+                    {
+                        memset( ( void * ) pxNewTCB, 0x00, sizeof( TCB_t ) );
+
+                        /* Store the stack location in the TCB. */
+                        pxNewTCB->pxStack = pxStack;
+                    }
+                    else
+                    {
+                        /* The stack cannot be used as the TCB was not created.  Free
+                         * it again. */
+                        vPortFreeStack( pxStack );
+                    }
                 }
                 else
                 {
-                    /* The stack cannot be used as the TCB was not created.  Free
-                     * it again. */
-                    vPortFreeStack( pxStack );
+                    pxNewTCB = NULL;
                 }
             }
-            else
-            {
-                pxNewTCB = NULL;
-            }
+            #endif /* portSTACK_GROWTH */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-        #endif /* portSTACK_GROWTH */
 
         if( pxNewTCB != NULL )
         {
@@ -841,7 +1168,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             }
             #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
 
-            prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxTicketNumber, pxNewTCB, NULL );
+            prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) uxStackDepth, pvParameters, uxPriority, pxCreatedTask, pxTicketNumber, pxNewTCB, NULL );
             prvAddNewTaskToReadyList( pxNewTCB );
             xReturn = pdPASS;
         }
@@ -887,8 +1214,24 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     /* Avoid dependency on memset() if it is not required. */
     #if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
     {
-        /* Fill the stack with a known value to assist debugging. */
-        ( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
+        #if ( configUSE_TASK_RECYCLING == 1 )
+        {
+            /* Only a recycled TCB whose stack the idle task has already
+             * repainted arrives with pxEndOfStack set. */
+            if( pxNewTCB->pxEndOfStack == NULL )
+            {
+                prvFillStack( pxNewTCB->pxStack, ulStackDepth );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #else
+        {
+            prvFillStack( pxNewTCB->pxStack, ulStackDepth );
+        }
+        #endif /* configUSE_TASK_RECYCLING */
     }
     #endif /* tskSET_NEW_STACKS_TO_KNOWN_VALUE */
 
@@ -932,6 +1275,8 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     	else
     		pxNewTCB->nTickets = pxTicketNumber;
 
+    	pxNewTCB->nBaseTickets = pxNewTCB->nTickets;
+
     	printf("\t-> The number of tickets setted for the task %s is: %d\n", pcName, pxNewTCB->nTickets);
 	#endif
 
@@ -1402,8 +1747,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
     {
         eTaskState eReturn;
         List_t const * pxStateList;
-        List_t const * pxDelayedList;
-        List_t const * pxOverflowedDelayedList;
+        BaseType_t xIsDelayed;
         const TCB_t * const pxTCB = xTask;
 
         configASSERT( pxTCB );
@@ -1418,12 +1762,20 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             taskENTER_CRITICAL();
             {
                 pxStateList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
-                pxDelayedList = pxDelayedTaskList;
-                pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+
+                #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                {
+                    xIsDelayed = listWHEEL_CONTAINS_LIST( &xDelayedTaskWheel, pxStateList );
+                }
+                #else
+                {
+                    xIsDelayed = ( ( pxStateList == pxDelayedTaskList ) || ( pxStateList == pxOverflowDelayedTaskList ) ) ? pdTRUE : pdFALSE;
+                }
+                #endif
             }
             taskEXIT_CRITICAL();
 
-            if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+            if( xIsDelayed != pdFALSE )
             {
                 /* The task being queried is referenced from one of the Blocked
                  * lists. */
@@ -2026,7 +2378,8 @@ void vTaskStartScheduler( void )
                                              ( void * ) NULL,       /*lint !e961.  The cast is not redundant for all compilers. */
                                              portPRIVILEGE_BIT,     /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
                                              pxIdleTaskStackBuffer,
-                                             pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+                                             pxIdleTaskTCBBuffer, /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+                                             0 );                 /* No tickets, as for the dynamically created idle task. */
 
         if( xIdleTaskHandle != NULL )
         {
@@ -2063,14 +2416,27 @@ void vTaskStartScheduler( void )
     }
     #endif /* configUSE_TIMERS */
 
-    if( xReturn == pdPASS )
+    #if ( configUSE_STATIC_TASK_TABLE == 1 )
     {
-        /* freertos_tasks_c_additions_init() should only be called if the user
-         * definable macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is
-         * the only macro called by the function. */
-        #ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+        if( xReturn == pdPASS )
         {
-            freertos_tasks_c_additions_init();
+            xReturn = prvCreateTableTasks();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_STATIC_TASK_TABLE */
+
+    if( xReturn == pdPASS )
+    {
+        /* freertos_tasks_c_additions_init() should only be called if the user
+         * definable macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is
+         * the only macro called by the function. */
+        #ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+        {
+            freertos_tasks_c_additions_init();
         }
         #endif
 
@@ -2148,6 +2514,55 @@ void vTaskStartScheduler( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_STATIC_TASK_TABLE == 1 )
+
+    static BaseType_t prvCreateTableTasks( void )
+    {
+        const TaskTableEntry_t * pxTaskTable = NULL;
+        UBaseType_t uxTaskTableLength = ( UBaseType_t ) 0U;
+        UBaseType_t x;
+        TaskHandle_t xCreatedTask;
+        BaseType_t xReturn = pdPASS;
+
+        vApplicationGetTaskTable( &pxTaskTable, &uxTaskTableLength );
+        configASSERT( ( pxTaskTable != NULL ) || ( uxTaskTableLength == ( UBaseType_t ) 0U ) );
+
+        for( x = ( UBaseType_t ) 0U; x < uxTaskTableLength; x++ )
+        {
+            xCreatedTask = xTaskCreateStatic( pxTaskTable[ x ].pxTaskCode,
+                                              pxTaskTable[ x ].pcName,
+                                              pxTaskTable[ x ].ulStackDepth,
+                                              pxTaskTable[ x ].pvParameters,
+                                              pxTaskTable[ x ].uxPriority,
+                                              pxTaskTable[ x ].puxStackBuffer,
+                                              pxTaskTable[ x ].pxTaskBuffer,
+                                              ( int ) pxTaskTable[ x ].uxTicketNumber );
+
+            if( pxTaskTable[ x ].pxCreatedTask != NULL )
+            {
+                *( pxTaskTable[ x ].pxCreatedTask ) = xCreatedTask;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( xCreatedTask == NULL )
+            {
+                xReturn = pdFAIL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_STATIC_TASK_TABLE */
+/*-----------------------------------------------------------*/
+
 void vTaskEndScheduler( void )
 {
     /* Stop the scheduler interrupts and call the portable scheduler end
@@ -2518,15 +2933,26 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
             } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
             /* Search the delayed lists. */
-            if( pxTCB == NULL )
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
             {
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+                for( uxQueue = ( UBaseType_t ) 0U; ( pxTCB == NULL ) && ( uxQueue < listWHEEL_TOTAL_SLOTS ); uxQueue++ )
+                {
+                    pxTCB = prvSearchForNameWithinSingleList( listWHEEL_GET_SLOT( &xDelayedTaskWheel, uxQueue ), pcNameToQuery );
+                }
             }
-
-            if( pxTCB == NULL )
+            #else
             {
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+                if( pxTCB == NULL )
+                {
+                    pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+                }
+
+                if( pxTCB == NULL )
+                {
+                    pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+                }
             }
+            #endif /* configUSE_DELAYED_TASK_WHEEL */
 
             #if ( INCLUDE_vTaskSuspend == 1 )
             {
@@ -2579,8 +3005,19 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
 
                 /* Fill in an TaskStatus_t structure with information on each
                  * task in the Blocked state. */
-                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+                #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                {
+                    for( uxQueue = ( UBaseType_t ) 0U; uxQueue < listWHEEL_TOTAL_SLOTS; uxQueue++ )
+                    {
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), listWHEEL_GET_SLOT( &xDelayedTaskWheel, uxQueue ), eBlocked );
+                    }
+                }
+                #else
+                {
+                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+                }
+                #endif /* configUSE_DELAYED_TASK_WHEEL */
 
                 #if ( INCLUDE_vTaskDelete == 1 )
                 {
@@ -2789,12 +3226,98 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
 #endif /* INCLUDE_xTaskAbortDelay */
 /*----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_SLACK == 1 )
+
+    void vTaskSetDelaySlack( TaskHandle_t xTask,
+                             TickType_t xSlackTicks )
+    {
+        TCB_t * pxTCB;
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            pxTCB->xDelaySlack = xSlackTicks;
+
+            /* The task may already be in the Blocked state, in which case the
+             * time at which the next task unblocks may have changed. */
+            prvResetNextTaskUnblockTime();
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_TIMER_SLACK */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMER_SLACK == 1 )
+
+    TickType_t xTaskGetDelaySlack( TaskHandle_t xTask )
+    {
+        TCB_t const * pxTCB;
+        TickType_t xReturn;
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            xReturn = pxTCB->xDelaySlack;
+        }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+
+#endif /* configUSE_TIMER_SLACK */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_ACCOUNTING == 1 )
+
+    void vTaskSetHeapQuota( TaskHandle_t xTask,
+                            size_t xQuotaBytes )
+    {
+        TCB_t * pxTCB;
+
+        /* The heap reads the quota with the scheduler suspended. */
+        vTaskSuspendAll();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            pxTCB->xHeapUsage.xQuotaBytes = xQuotaBytes;
+        }
+        ( void ) xTaskResumeAll();
+    }
+
+#endif /* configUSE_HEAP_ACCOUNTING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_ACCOUNTING == 1 )
+
+    void vTaskGetHeapUsage( TaskHandle_t xTask,
+                            TaskHeapUsage_t * pxHeapUsage )
+    {
+        TCB_t const * pxTCB;
+
+        configASSERT( pxHeapUsage );
+
+        vTaskSuspendAll();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            *pxHeapUsage = pxTCB->xHeapUsage;
+        }
+        ( void ) xTaskResumeAll();
+    }
+
+#endif /* configUSE_HEAP_ACCOUNTING */
+/*-----------------------------------------------------------*/
+
 BaseType_t xTaskIncrementTick( void )
 {
     TCB_t * pxTCB;
-    TickType_t xItemValue;
     BaseType_t xSwitchRequired = pdFALSE;
 
+    #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+        ListItem_t * pxExpiredItem;
+    #else
+        TickType_t xItemValue;
+    #endif
+
     /* Called by the portable layer each time a tick interrupt occurs.
      * Increments the tick then checks to see if the new tick value will cause any
      * tasks to be unblocked. */
@@ -2819,6 +3342,22 @@ BaseType_t xTaskIncrementTick( void )
             mtCOVERAGE_TEST_MARKER();
         }
 
+        #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+        {
+            /* The wheel is advanced on every tick, even when no task is due,
+             * so it never has to catch up over a long period in one go. */
+            if( xConstTickCount < xNextTaskUnblockTime )
+            {
+                pxExpiredItem = pxListWheelGetExpired( &xDelayedTaskWheel, xConstTickCount );
+                configASSERT( pxExpiredItem == NULL );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_DELAYED_TASK_WHEEL */
+
         /* See if this tick has made a timeout expire.  Tasks are stored in
          * the  queue in the order of their wake time - meaning once one task
          * has been found whose block time has not expired there is no need to
@@ -2827,18 +3366,39 @@ BaseType_t xTaskIncrementTick( void )
         {
             for( ; ; )
             {
-                if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+                #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
                 {
-                    /* The delayed list is empty.  Set xNextTaskUnblockTime
-                     * to the maximum possible value so it is extremely
-                     * unlikely that the
-                     * if( xTickCount >= xNextTaskUnblockTime ) test will pass
-                     * next time through. */
-                    xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-                    break;
+                    /* The wheel returns the tasks that are due on this tick
+                     * one at a time. */
+                    pxExpiredItem = pxListWheelGetExpired( &xDelayedTaskWheel, xConstTickCount );
+
+                    if( pxExpiredItem == NULL )
+                    {
+                        /* No more tasks are due, record when the wheel must
+                         * next be advanced to find the next one. */
+                        prvResetNextTaskUnblockTime();
+                        break;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxExpiredItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
                 }
-                else
+                #else /* configUSE_DELAYED_TASK_WHEEL */
                 {
+                    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+                    {
+                        /* The delayed list is empty.  Set xNextTaskUnblockTime
+                         * to the maximum possible value so it is extremely
+                         * unlikely that the
+                         * if( xTickCount >= xNextTaskUnblockTime ) test will pass
+                         * next time through. */
+                        xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                        break;
+                    }
+
                     /* The delayed list is not empty, get the value of the
                      * item at the head of the delayed list.  This is the time
                      * at which the task at the head of the delayed list must
@@ -2848,60 +3408,74 @@ BaseType_t xTaskIncrementTick( void )
 
                     if( xConstTickCount < xItemValue )
                     {
-                        /* It is not time to unblock this item yet, but the
-                         * item value is the time at which the task at the head
-                         * of the blocked list must be removed from the Blocked
-                         * state -  so record the item value in
-                         * xNextTaskUnblockTime. */
-                        xNextTaskUnblockTime = xItemValue;
+                        #if ( configUSE_TIMER_SLACK == 1 )
+                        {
+                            /* It is not time to unblock this item yet.  The
+                             * tasks still in the list may be allowed to wait
+                             * beyond their wake times, so work out when the
+                             * next of them must be removed from the Blocked
+                             * state. */
+                            prvResetNextTaskUnblockTime();
+                        }
+                        #else
+                        {
+                            /* It is not time to unblock this item yet, but the
+                             * item value is the time at which the task at the head
+                             * of the blocked list must be removed from the Blocked
+                             * state -  so record the item value in
+                             * xNextTaskUnblockTime. */
+                            xNextTaskUnblockTime = xItemValue;
+                        }
+                        #endif /* configUSE_TIMER_SLACK */
                         break; /*lint !e9011 Code structure here is deemed easier to understand with multiple breaks. */
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
+                }
+                #endif /* configUSE_DELAYED_TASK_WHEEL */
 
-                    /* It is time to remove the item from the Blocked state. */
-                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                /* It is time to remove the item from the Blocked state. */
+                listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
 
-                    /* Is the task waiting on an event also?  If so remove
-                     * it from the event list. */
-                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                /* Is the task waiting on an event also?  If so remove
+                 * it from the event list. */
+                if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                {
+                    listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Place the unblocked task into the appropriate ready
+                 * list. */
+                prvAddTaskToReadyList( pxTCB );
+
+                /* A task being unblocked cannot cause an immediate
+                 * context switch if preemption is turned off. */
+                #if ( configUSE_PREEMPTION == 1 )
+                {
+                    /* Preemption is on, but a context switch should
+                     * only be performed if the unblocked task's
+                     * priority is higher than the currently executing
+                     * task.
+                     * The case of equal priority tasks sharing
+                     * processing time (which happens when both
+                     * preemption and time slicing are on) is
+                     * handled below.*/
+                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
                     {
-                        listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+                        xSwitchRequired = pdTRUE;
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
-
-                    /* Place the unblocked task into the appropriate ready
-                     * list. */
-                    prvAddTaskToReadyList( pxTCB );
-
-                    /* A task being unblocked cannot cause an immediate
-                     * context switch if preemption is turned off. */
-                    #if ( configUSE_PREEMPTION == 1 )
-                    {
-                        /* Preemption is on, but a context switch should
-                         * only be performed if the unblocked task's
-                         * priority is higher than the currently executing
-                         * task.
-                         * The case of equal priority tasks sharing
-                         * processing time (which happens when both
-                         * preemption and time slicing are on) is
-                         * handled below.*/
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
-                        {
-                            xSwitchRequired = pdTRUE;
-                        }
-                        else
-                        {
-                            mtCOVERAGE_TEST_MARKER();
-                        }
-                    }
-                    #endif /* configUSE_PREEMPTION */
                 }
+                #endif /* configUSE_PREEMPTION */
             }
         }
 
@@ -2988,7 +3562,24 @@ BaseType_t xTaskIncrementTick( void )
          * the value can be accessed from an interrupt. */
         taskENTER_CRITICAL();
         {
-            xTCB->pxTaskTag = pxHookFunction;
+            #if ( tskUSE_TASK_SIDE_TABLE == 1 )
+            {
+                TaskSideTableEntry_t * pxEntry = prvGetSideTableEntry( xTCB, ( BaseType_t ) ( pxHookFunction != NULL ) );
+
+                if( pxEntry != NULL )
+                {
+                    pxEntry->pxTaskTag = pxHookFunction;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #else
+            {
+                xTCB->pxTaskTag = pxHookFunction;
+            }
+            #endif
         }
         taskEXIT_CRITICAL();
     }
@@ -3010,7 +3601,17 @@ BaseType_t xTaskIncrementTick( void )
          * the value can be accessed from an interrupt. */
         taskENTER_CRITICAL();
         {
-            xReturn = pxTCB->pxTaskTag;
+            #if ( tskUSE_TASK_SIDE_TABLE == 1 )
+            {
+                TaskSideTableEntry_t * pxEntry = prvGetSideTableEntry( pxTCB, pdFALSE );
+
+                xReturn = ( pxEntry != NULL ) ? pxEntry->pxTaskTag : NULL;
+            }
+            #else
+            {
+                xReturn = pxTCB->pxTaskTag;
+            }
+            #endif
         }
         taskEXIT_CRITICAL();
 
@@ -3035,7 +3636,17 @@ BaseType_t xTaskIncrementTick( void )
          * the value can be accessed from an interrupt. */
         uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
         {
-            xReturn = pxTCB->pxTaskTag;
+            #if ( tskUSE_TASK_SIDE_TABLE == 1 )
+            {
+                TaskSideTableEntry_t * pxEntry = prvGetSideTableEntry( pxTCB, pdFALSE );
+
+                xReturn = ( pxEntry != NULL ) ? pxEntry->pxTaskTag : NULL;
+            }
+            #else
+            {
+                xReturn = pxTCB->pxTaskTag;
+            }
+            #endif
         }
         portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
@@ -3052,6 +3663,7 @@ BaseType_t xTaskIncrementTick( void )
     {
         TCB_t * xTCB;
         BaseType_t xReturn;
+        TaskHookFunction_t xHook;
 
         /* If xTask is NULL then we are calling our own task hook. */
         if( xTask == NULL )
@@ -3063,9 +3675,21 @@ BaseType_t xTaskIncrementTick( void )
             xTCB = xTask;
         }
 
-        if( xTCB->pxTaskTag != NULL )
+        #if ( tskUSE_TASK_SIDE_TABLE == 1 )
         {
-            xReturn = xTCB->pxTaskTag( pvParameter );
+            TaskSideTableEntry_t * pxEntry = prvGetSideTableEntry( xTCB, pdFALSE );
+
+            xHook = ( pxEntry != NULL ) ? pxEntry->pxTaskTag : NULL;
+        }
+        #else
+        {
+            xHook = xTCB->pxTaskTag;
+        }
+        #endif
+
+        if( xHook != NULL )
+        {
+            xReturn = xHook( pvParameter );
         }
         else
         {
@@ -3164,7 +3788,7 @@ void vTaskSwitchContext( void )
 }
 /*-----------------------------------------------------------*/
 
-void vTaskPlaceOnEventList( List_t * const pxEventList,
+void vTaskPlaceOnEventList( EventList_t * const pxEventList,
                             const TickType_t xTicksToWait )
 {
     configASSERT( pxEventList );
@@ -3179,11 +3803,13 @@ void vTaskPlaceOnEventList( List_t * const pxEventList,
      * Note: Lists are sorted in ascending order by ListItem_t.xItemValue.
      * Normally, the xItemValue of a TCB's ListItem_t members is:
      *      xItemValue = ( configMAX_PRIORITIES - uxPriority )
-     * Therefore, the event list is sorted in descending priority order.
+     * Therefore, the event list is sorted in descending priority order.  When
+     * configUSE_PRIORITY_EVENT_LISTS is 1 the item is instead appended to the
+     * bucket for the task's priority.
      *
      * The queue that contains the event list is locked, preventing
      * simultaneous access from interrupts. */
-    vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+    listEVENT_LIST_INSERT( pxEventList, &( pxCurrentTCB->xEventListItem ), pxCurrentTCB->uxPriority );
 
     prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
 }
@@ -3217,7 +3843,7 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
 
 #if ( configUSE_TIMERS == 1 )
 
-    void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
+    void vTaskPlaceOnEventListRestricted( EventList_t * const pxEventList,
                                           TickType_t xTicksToWait,
                                           const BaseType_t xWaitIndefinitely )
     {
@@ -3233,7 +3859,15 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
          * In this case it is assume that this is the only task that is going to
          * be waiting on this event list, so the faster vListInsertEnd() function
          * can be used in place of vListInsert. */
-        listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+        #if ( configUSE_PRIORITY_EVENT_LISTS == 1 )
+        {
+            listEVENT_LIST_INSERT( pxEventList, &( pxCurrentTCB->xEventListItem ), pxCurrentTCB->uxPriority );
+        }
+        #else
+        {
+            listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+        }
+        #endif
 
         /* If the task should block indefinitely then set the block time to a
          * value that will be recognised as an indefinite delay inside the
@@ -3250,7 +3884,7 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
 #endif /* configUSE_TIMERS */
 /*-----------------------------------------------------------*/
 
-BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
+BaseType_t xTaskRemoveFromEventList( EventList_t * const pxEventList )
 {
     TCB_t * pxUnblockedTCB;
     BaseType_t xReturn;
@@ -3268,7 +3902,7 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
      *
      * This function assumes that a check has already been made to ensure that
      * pxEventList is not empty. */
-    pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+    pxUnblockedTCB = listGET_LIST_ITEM_OWNER( listEVENT_LIST_GET_HEAD_ENTRY( pxEventList ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
     configASSERT( pxUnblockedTCB );
     listREMOVE_ITEM( &( pxUnblockedTCB->xEventListItem ) );
 
@@ -3527,6 +4161,14 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
          * is responsible for freeing the deleted task's TCB and stack. */
         prvCheckTasksWaitingTermination();
 
+        #if ( ( configUSE_TASK_RECYCLING == 1 ) && ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 ) )
+        {
+            /* Repaint the stacks of recycled TCBs before xTaskCreate() needs
+             * them. */
+            prvPaintRecycledStacks();
+        }
+        #endif
+
         #if ( configUSE_PREEMPTION == 0 )
         {
             /* If we are not using preemption we keep forcing a task switch to
@@ -3689,7 +4331,25 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
         {
             pxTCB = prvGetTCBFromHandle( xTaskToSet );
             configASSERT( pxTCB != NULL );
-            pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
+
+            #if ( tskUSE_TASK_SIDE_TABLE == 1 )
+            {
+                TaskSideTableEntry_t * pxEntry = prvGetSideTableEntry( pxTCB, ( BaseType_t ) ( pvValue != NULL ) );
+
+                if( pxEntry != NULL )
+                {
+                    pxEntry->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #else
+            {
+                pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
+            }
+            #endif
         }
     }
 
@@ -3708,7 +4368,18 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
             ( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS ) )
         {
             pxTCB = prvGetTCBFromHandle( xTaskToQuery );
-            pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
+
+            #if ( tskUSE_TASK_SIDE_TABLE == 1 )
+            {
+                TaskSideTableEntry_t * pxEntry = prvGetSideTableEntry( pxTCB, pdFALSE );
+
+                pvReturn = ( pxEntry != NULL ) ? pxEntry->pvThreadLocalStoragePointers[ xIndex ] : NULL;
+            }
+            #else
+            {
+                pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
+            }
+            #endif
         }
         else
         {
@@ -3747,8 +4418,17 @@ static void prvInitialiseTaskLists( void )
         vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
     }
 
-    vListInitialise( &xDelayedTaskList1 );
-    vListInitialise( &xDelayedTaskList2 );
+    #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+    {
+        vListInitialiseWheel( &xDelayedTaskWheel, xTickCount );
+    }
+    #else
+    {
+        vListInitialise( &xDelayedTaskList1 );
+        vListInitialise( &xDelayedTaskList2 );
+    }
+    #endif
+
     vListInitialise( &xPendingReadyList );
 
     #if ( INCLUDE_vTaskDelete == 1 )
@@ -3763,11 +4443,15 @@ static void prvInitialiseTaskLists( void )
     }
     #endif /* INCLUDE_vTaskSuspend */
 
-    /* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
-     * using list2. */
-    pxDelayedTaskList = &xDelayedTaskList1;
-    pxOverflowDelayedTaskList = &xDelayedTaskList2;
-}
+    #if ( configUSE_DELAYED_TASK_WHEEL == 0 )
+    {
+        /* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
+         * using list2. */
+        pxDelayedTaskList = &xDelayedTaskList1;
+        pxOverflowDelayedTaskList = &xDelayedTaskList2;
+    }
+    #endif
+}
 /*-----------------------------------------------------------*/
 
 static void prvCheckTasksWaitingTermination( void )
@@ -3896,6 +4580,12 @@ static void prvCheckTasksWaitingTermination( void )
         {
             pxTaskStatus->usStackHighWaterMark = 0;
         }
+
+        #if ( configUSE_HEAP_ACCOUNTING == 1 )
+        {
+            vTaskGetHeapUsage( ( TaskHandle_t ) pxTCB, &( pxTaskStatus->xHeapUsage ) );
+        }
+        #endif
     }
 
 #endif /* configUSE_TRACE_FACILITY */
@@ -3937,13 +4627,19 @@ static void prvCheckTasksWaitingTermination( void )
 #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( configUSE_STACK_PROFILING == 1 ) )
 
     static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
     {
         uint32_t ulCount = 0U;
 
-        while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
+        #if ( configPAINT_STACK_GUARD_ONLY == 1 )
+            /* Bytes beyond the guard were never painted, so only the guard
+             * can be checked. */
+            while( ( ulCount < ( uint32_t ) tskSTACK_GUARD_BYTES ) && ( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE ) )
+        #else
+            while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
+        #endif
         {
             pucStackByte -= portSTACK_GROWTH;
             ulCount++;
@@ -3954,7 +4650,206 @@ static void prvCheckTasksWaitingTermination( void )
         return ( configSTACK_DEPTH_TYPE ) ulCount;
     }
 
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( configUSE_STACK_PROFILING == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
+
+    static void prvFillStack( StackType_t * pxStack,
+                              uint32_t ulStackDepth )
+    {
+        #if ( configPAINT_STACK_GUARD_ONLY == 1 )
+        {
+            size_t xStackBytes = ( size_t ) ulStackDepth * sizeof( StackType_t );
+            size_t xGuardBytes = ( xStackBytes < tskSTACK_GUARD_BYTES ) ? xStackBytes : tskSTACK_GUARD_BYTES;
+
+            /* Only fill the end of the stack the stack overflow check looks
+             * at.  The rest of the stack is never read before it is written. */
+            #if ( portSTACK_GROWTH < 0 )
+            {
+                ( void ) memset( ( void * ) pxStack, ( int ) tskSTACK_FILL_BYTE, xGuardBytes );
+            }
+            #else
+            {
+                ( void ) memset( ( void * ) ( ( ( uint8_t * ) pxStack ) + ( xStackBytes - xGuardBytes ) ), ( int ) tskSTACK_FILL_BYTE, xGuardBytes );
+            }
+            #endif
+        }
+        #else
+        {
+            /* Fill the stack with a known value to assist debugging. */
+            ( void ) memset( ( void * ) pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
+        }
+        #endif /* configPAINT_STACK_GUARD_ONLY */
+    }
+
+#endif /* tskSET_NEW_STACKS_TO_KNOWN_VALUE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STACK_PROFILING == 1 )
+
+    static void prvRecordStackProfile( TCB_t * pxTCB )
+    {
+        TaskStackProfile_t * pxEntry = NULL;
+        configSTACK_DEPTH_TYPE uxStackDepth, uxUsed;
+        UBaseType_t x;
+
+        /* The depth from the start of the stack to the aligned top of stack,
+         * which can be a little less than the depth the task was created
+         * with. */
+        uxStackDepth = ( configSTACK_DEPTH_TYPE ) ( ( pxTCB->pxEndOfStack - pxTCB->pxStack ) + 1 );
+
+        #if ( portSTACK_GROWTH < 0 )
+        {
+            uxUsed = uxStackDepth - prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
+        }
+        #else
+        {
+            uxUsed = uxStackDepth - prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
+        }
+        #endif
+
+        for( x = ( UBaseType_t ) 0U; ( x < uxStackProfileEntries ) && ( pxEntry == NULL ); x++ )
+        {
+            if( strncmp( xStackProfile[ x ].pcTaskName, pxTCB->pcTaskName, ( size_t ) configMAX_TASK_NAME_LEN ) == 0 )
+            {
+                pxEntry = &( xStackProfile[ x ] );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        if( ( pxEntry == NULL ) && ( uxStackProfileEntries < ( UBaseType_t ) configSTACK_PROFILE_LENGTH ) )
+        {
+            pxEntry = &( xStackProfile[ uxStackProfileEntries ] );
+            uxStackProfileEntries++;
+            ( void ) memcpy( ( void * ) pxEntry->pcTaskName, ( void * ) pxTCB->pcTaskName, ( size_t ) configMAX_TASK_NAME_LEN );
+        }
+        else
+        {
+            /* Either the name is already in the profile, or the profile is
+             * full and the task is not recorded. */
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pxEntry != NULL )
+        {
+            if( uxStackDepth > pxEntry->uxStackDepth )
+            {
+                pxEntry->uxStackDepth = uxStackDepth;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( uxUsed > pxEntry->uxPeakUsage )
+            {
+                pxEntry->uxPeakUsage = uxUsed;
+                pxEntry->uxRecommendedDepth = ( configSTACK_DEPTH_TYPE ) ( ( uint32_t ) uxUsed + ( ( ( ( uint32_t ) uxUsed * ( uint32_t ) configSTACK_PROFILE_MARGIN_PERCENT ) + 99U ) / 100U ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_STACK_PROFILING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STACK_PROFILING == 1 )
+
+    static void prvRecordStackProfilesWithinSingleList( List_t * pxList )
+    {
+        configLIST_VOLATILE TCB_t * pxNextTCB;
+        configLIST_VOLATILE TCB_t * pxFirstTCB;
+
+        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+        {
+            listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+            do
+            {
+                listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                prvRecordStackProfile( ( TCB_t * ) pxNextTCB );
+            } while( pxNextTCB != pxFirstTCB );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_STACK_PROFILING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STACK_PROFILING == 1 )
+
+    UBaseType_t uxTaskGetStackProfile( TaskStackProfile_t * const pxProfileArray,
+                                       const UBaseType_t uxArraySize )
+    {
+        UBaseType_t uxEntries, uxQueue = configMAX_PRIORITIES;
+
+        vTaskSuspendAll();
+        {
+            /* Deleted tasks were recorded as they were deleted, so bring the
+             * profile up to date with the tasks that still exist. */
+            do
+            {
+                uxQueue--;
+                prvRecordStackProfilesWithinSingleList( &( pxReadyTasksLists[ uxQueue ] ) );
+            } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+            {
+                for( uxQueue = ( UBaseType_t ) 0U; uxQueue < listWHEEL_TOTAL_SLOTS; uxQueue++ )
+                {
+                    prvRecordStackProfilesWithinSingleList( listWHEEL_GET_SLOT( &xDelayedTaskWheel, uxQueue ) );
+                }
+            }
+            #else
+            {
+                prvRecordStackProfilesWithinSingleList( ( List_t * ) pxDelayedTaskList );
+                prvRecordStackProfilesWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList );
+            }
+            #endif /* configUSE_DELAYED_TASK_WHEEL */
+
+            #if ( INCLUDE_vTaskDelete == 1 )
+            {
+                prvRecordStackProfilesWithinSingleList( &xTasksWaitingTermination );
+            }
+            #endif
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+            {
+                prvRecordStackProfilesWithinSingleList( &xSuspendedTaskList );
+            }
+            #endif
+
+            uxEntries = ( uxStackProfileEntries < uxArraySize ) ? uxStackProfileEntries : uxArraySize;
+
+            if( uxEntries > ( UBaseType_t ) 0U )
+            {
+                ( void ) memcpy( ( void * ) pxProfileArray, ( void * ) xStackProfile, ( size_t ) uxEntries * sizeof( TaskStackProfile_t ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return uxEntries;
+    }
+
+#endif /* configUSE_STACK_PROFILING */
 /*-----------------------------------------------------------*/
 
 #if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
@@ -4034,6 +4929,68 @@ static void prvCheckTasksWaitingTermination( void )
          * want to allocate and clean RAM statically. */
         portCLEAN_UP_TCB( pxTCB );
 
+        #if ( configUSE_STACK_PROFILING == 1 )
+        {
+            /* Record the task's stack usage before its stack is freed. */
+            vTaskSuspendAll();
+            {
+                prvRecordStackProfile( pxTCB );
+            }
+            ( void ) xTaskResumeAll();
+        }
+        #endif
+
+        #if ( configUSE_HEAP_ACCOUNTING == 1 )
+        {
+            /* Blocks the task allocated but never freed still record the task
+             * as their owner, so must be disowned before the TCB is freed. */
+            if( pxTCB->xHeapUsage.xCurrentBytes != ( size_t ) 0 )
+            {
+                vPortHeapForgetOwner( ( void * ) pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
+        #if ( configUSE_HEAP_MAGAZINES == 1 )
+        {
+            /* Return the blocks the task had cached for reuse to the heap.  The
+             * task is no longer running, so its magazine cannot be in use. */
+            if( pxTCB->pvThreadLocalStoragePointers[ configHEAP_MAGAZINE_TLS_INDEX ] != NULL )
+            {
+                vPortHeapReleaseMagazine( pxTCB->pvThreadLocalStoragePointers[ configHEAP_MAGAZINE_TLS_INDEX ] );
+                pxTCB->pvThreadLocalStoragePointers[ configHEAP_MAGAZINE_TLS_INDEX ] = NULL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
+        #if ( tskUSE_TASK_SIDE_TABLE == 1 )
+        {
+            /* Clear the task's side table entry, if it has one, and return it
+             * to the table. */
+            if( pxTCB->ucSideTableIndex != ( uint8_t ) 0U )
+            {
+                taskENTER_CRITICAL();
+                {
+                    ( void ) memset( ( void * ) &( xTaskSideTable[ pxTCB->ucSideTableIndex - 1U ] ), 0x00, sizeof( TaskSideTableEntry_t ) );
+                    pxTCB->ucSideTableIndex = ( uint8_t ) 0U;
+                }
+                taskEXIT_CRITICAL();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
         #if ( ( configUSE_NEWLIB_REENTRANT == 1 ) || ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) )
         {
             /* Free up the memory allocated for the task's TLS Block. */
@@ -4045,8 +5002,7 @@ static void prvCheckTasksWaitingTermination( void )
         {
             /* The task can only have been allocated dynamically - free both
              * the stack and TCB. */
-            vPortFreeStack( pxTCB->pxStack );
-            vPortFree( pxTCB );
+            prvFreeStackAndTCB( pxTCB );
         }
         #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
         {
@@ -4057,14 +5013,13 @@ static void prvCheckTasksWaitingTermination( void )
             {
                 /* Both the stack and TCB were allocated dynamically, so both
                  * must be freed. */
-                vPortFreeStack( pxTCB->pxStack );
-                vPortFree( pxTCB );
+                prvFreeStackAndTCB( pxTCB );
             }
             else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
             {
                 /* Only the stack was statically allocated, so the TCB is the
                  * only memory that must be freed. */
-                vPortFree( pxTCB );
+                vPortFreeObject( pxTCB );
             }
             else
             {
@@ -4080,25 +5035,411 @@ static void prvCheckTasksWaitingTermination( void )
 #endif /* INCLUDE_vTaskDelete */
 /*-----------------------------------------------------------*/
 
-static void prvResetNextTaskUnblockTime( void )
-{
-    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+#if ( ( INCLUDE_vTaskDelete == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+    static void prvFreeStackAndTCB( TCB_t * pxTCB )
     {
-        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
-         * the maximum possible value so it is  extremely unlikely that the
-         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-         * there is an item in the delayed list. */
-        xNextTaskUnblockTime = portMAX_DELAY;
+        #if ( configUSE_TASK_RECYCLING == 1 )
+        {
+            BaseType_t xRecycled = pdFALSE;
+            StackType_t * pxSlotEndOfStack;
+
+            /* Only stacks of exactly the recycled depth are recycled, which is
+             * known from the end of stack recorded by prvInitialiseNewTask(). */
+            #if ( portSTACK_GROWTH < 0 )
+            {
+                pxSlotEndOfStack = &( pxTCB->pxStack[ configTASK_RECYCLE_STACK_DEPTH - 1 ] );
+                pxSlotEndOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxSlotEndOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 !e9033 !e9078 MISRA exception.  Avoiding casts between pointers and integers is not practical. */
+            }
+            #else
+            {
+                pxSlotEndOfStack = pxTCB->pxStack + ( configTASK_RECYCLE_STACK_DEPTH - 1 );
+            }
+            #endif
+
+            if( pxTCB->pxEndOfStack == pxSlotEndOfStack )
+            {
+                #if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
+                {
+                    /* A task deleted by another task is freed here in the
+                     * deleting task, so the stack is not repainted now but by
+                     * prvPaintRecycledStacks() in the idle task.  A deleted
+                     * task has no context to save, so a NULL pxTopOfStack
+                     * marks a stack that is yet to be painted. */
+                    pxTCB->pxTopOfStack = NULL;
+                }
+                #endif /* tskSET_NEW_STACKS_TO_KNOWN_VALUE */
+
+                xRecycled = prvAddTCBToRecyclePool( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( xRecycled == pdFALSE )
+            {
+                vPortFreeStack( pxTCB->pxStack );
+                vPortFreeObject( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #else /* configUSE_TASK_RECYCLING */
+        {
+            vPortFreeStack( pxTCB->pxStack );
+            vPortFreeObject( pxTCB );
+        }
+        #endif /* configUSE_TASK_RECYCLING */
     }
-    else
+
+#endif /* ( INCLUDE_vTaskDelete == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_RECYCLING == 1 )
+
+    static TCB_t * prvTakeRecycledTCB( void )
     {
-        /* The new current delayed list is not empty, get the value of
-         * the item at the head of the delayed list.  This is the time at
-         * which the task at the head of the delayed list should be removed
-         * from the Blocked state. */
-        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+        TCB_t * pxTCB = NULL;
+        StackType_t * pxStack;
+        StackType_t * pxEndOfStack;
+
+        taskENTER_CRITICAL();
+        {
+            if( uxRecycledTasks > ( UBaseType_t ) 0U )
+            {
+                uxRecycledTasks--;
+                pxTCB = pxRecycledTasks[ uxRecycledTasks ];
+
+                #if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
+                {
+                    if( pxTCB->pxTopOfStack == NULL )
+                    {
+                        /* The idle task has not repainted this stack yet. */
+                        uxRecycledStacksToPaint--;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( pxTCB != NULL )
+        {
+            /* Clear the TCB as xTaskCreate() clears a newly allocated one, but
+             * keep the stack it holds.  Keeping pxEndOfStack also tells
+             * prvInitialiseNewTask() the stack is already painted, so it is
+             * only kept if the idle task has painted it. */
+            pxStack = pxTCB->pxStack;
+            pxEndOfStack = ( pxTCB->pxTopOfStack != NULL ) ? pxTCB->pxEndOfStack : NULL;
+            ( void ) memset( ( void * ) pxTCB, 0x00, sizeof( TCB_t ) );
+            pxTCB->pxStack = pxStack;
+            pxTCB->pxEndOfStack = pxEndOfStack;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxTCB;
     }
-}
+
+#endif /* configUSE_TASK_RECYCLING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_RECYCLING == 1 )
+
+    static BaseType_t prvAddTCBToRecyclePool( TCB_t * pxTCB )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        taskENTER_CRITICAL();
+        {
+            if( uxRecycledTasks < ( UBaseType_t ) configTASK_RECYCLE_POOL_LENGTH )
+            {
+                pxRecycledTasks[ uxRecycledTasks ] = pxTCB;
+                uxRecycledTasks++;
+                xReturn = pdTRUE;
+
+                #if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
+                {
+                    if( pxTCB->pxTopOfStack == NULL )
+                    {
+                        uxRecycledStacksToPaint++;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+
+#endif /* configUSE_TASK_RECYCLING */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TASK_RECYCLING == 1 ) && ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 ) )
+
+    static void prvPaintRecycledStacks( void )
+    {
+        TCB_t * pxTCB;
+        UBaseType_t uxIndex;
+
+        while( uxRecycledStacksToPaint > ( UBaseType_t ) 0U )
+        {
+            pxTCB = NULL;
+
+            /* Take a TCB whose stack is still to be painted out of the pool,
+             * so xTaskCreate() cannot reuse it while it is being painted.  The
+             * pool is short, so it is searched in the critical section. */
+            taskENTER_CRITICAL();
+            {
+                for( uxIndex = ( UBaseType_t ) 0U; ( pxTCB == NULL ) && ( uxIndex < uxRecycledTasks ); uxIndex++ )
+                {
+                    if( pxRecycledTasks[ uxIndex ]->pxTopOfStack == NULL )
+                    {
+                        pxTCB = pxRecycledTasks[ uxIndex ];
+                        uxRecycledTasks--;
+                        pxRecycledTasks[ uxIndex ] = pxRecycledTasks[ uxRecycledTasks ];
+                        uxRecycledStacksToPaint--;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            /* The count and the pool are updated together. */
+            configASSERT( pxTCB );
+
+            if( pxTCB != NULL )
+            {
+                /* Painting the whole stack is quicker than searching for the
+                 * deleted task's high water mark to paint only the part it
+                 * used.  Any non-NULL pxTopOfStack marks the stack painted. */
+                prvFillStack( pxTCB->pxStack, ( uint32_t ) configTASK_RECYCLE_STACK_DEPTH );
+                pxTCB->pxTopOfStack = pxTCB->pxStack;
+
+                if( prvAddTCBToRecyclePool( pxTCB ) == pdFALSE )
+                {
+                    /* xTaskCreate() found the pool empty and deleted tasks
+                     * have refilled it in the meantime. */
+                    vPortFreeStack( pxTCB->pxStack );
+                    vPortFreeObject( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* Should not get here, but do not spin if the count is
+                 * wrong. */
+                uxRecycledStacksToPaint = ( UBaseType_t ) 0U;
+            }
+        }
+    }
+
+#endif /* ( ( configUSE_TASK_RECYCLING == 1 ) && ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( tskUSE_TASK_SIDE_TABLE == 1 )
+
+    static TaskSideTableEntry_t * prvGetSideTableEntry( TCB_t * pxTCB,
+                                                        BaseType_t xAssign )
+    {
+        TaskSideTableEntry_t * pxEntry = NULL;
+        UBaseType_t uxIndex;
+
+        if( pxTCB->ucSideTableIndex != ( uint8_t ) 0U )
+        {
+            pxEntry = &( xTaskSideTable[ pxTCB->ucSideTableIndex - 1U ] );
+        }
+        else if( xAssign != pdFALSE )
+        {
+            taskENTER_CRITICAL();
+            {
+                /* Another task may have assigned an entry to the task since
+                 * it was checked above. */
+                if( pxTCB->ucSideTableIndex != ( uint8_t ) 0U )
+                {
+                    pxEntry = &( xTaskSideTable[ pxTCB->ucSideTableIndex - 1U ] );
+                }
+                else
+                {
+                    for( uxIndex = ( UBaseType_t ) 0U; ( uxIndex < ( UBaseType_t ) configTASK_SIDE_TABLE_LENGTH ) && ( pxEntry == NULL ); uxIndex++ )
+                    {
+                        if( xTaskSideTable[ uxIndex ].pxOwner == NULL )
+                        {
+                            pxEntry = &( xTaskSideTable[ uxIndex ] );
+                            pxEntry->pxOwner = pxTCB;
+                            pxTCB->ucSideTableIndex = ( uint8_t ) ( uxIndex + 1U );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            /* Every entry is assigned to another task.  Increase
+             * configTASK_SIDE_TABLE_LENGTH. */
+            if( pxEntry == NULL )
+            {
+                traceTASK_SIDE_TABLE_FULL( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            configASSERT( pxEntry != NULL );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxEntry;
+    }
+
+#endif /* tskUSE_TASK_SIDE_TABLE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_RECYCLING == 1 )
+
+    void vTaskFreeRecycledTasks( void )
+    {
+        TCB_t * pxTCB;
+
+        do
+        {
+            pxTCB = prvTakeRecycledTCB();
+
+            if( pxTCB != NULL )
+            {
+                vPortFreeStack( pxTCB->pxStack );
+                vPortFreeObject( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        } while( pxTCB != NULL );
+    }
+
+#endif /* configUSE_TASK_RECYCLING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+    static void prvResetNextTaskUnblockTime( void )
+    {
+        TickType_t xNextWakeTime;
+
+        if( ( xListWheelGetNextExpiry( &xDelayedTaskWheel, &xNextWakeTime ) == pdFALSE ) ||
+            ( xNextWakeTime < xTickCount ) )
+        {
+            /* Either no tasks are delayed, or the earliest wake time is beyond
+             * the next tick count overflow.  As with the overflow delayed
+             * list, set xNextTaskUnblockTime to the maximum possible value so
+             * it is recalculated when the tick count overflows. */
+            xNextTaskUnblockTime = portMAX_DELAY;
+        }
+        else
+        {
+            /* The wheel gives the time at which the first delayed task should
+             * be removed from the Blocked state, or, if that task is not due
+             * within listWHEEL_SLOTS ticks, the earlier time at which the wheel
+             * must next be advanced to find it.  Either way the wheel is
+             * advanced on that tick and the time recalculated. */
+            xNextTaskUnblockTime = xNextWakeTime;
+        }
+    }
+
+#else /* configUSE_DELAYED_TASK_WHEEL */
+
+    static void prvResetNextTaskUnblockTime( void )
+    {
+        if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+        {
+            /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
+             * the maximum possible value so it is  extremely unlikely that the
+             * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+             * there is an item in the delayed list. */
+            xNextTaskUnblockTime = portMAX_DELAY;
+        }
+        else
+        {
+            #if ( configUSE_TIMER_SLACK == 1 )
+            {
+                const ListItem_t * pxItem = listGET_HEAD_ENTRY( pxDelayedTaskList );
+                const ListItem_t * const pxListEnd = listGET_END_MARKER( pxDelayedTaskList );
+                const TCB_t * pxTCB;
+                TickType_t xDeadline = portMAX_DELAY;
+
+                /* Each delayed task must be removed from the Blocked state by
+                 * its wake time plus its slack, so the next unblock time is the
+                 * earliest of these.  The list is in wake time order, so once a
+                 * task is reached that does not wake until after the earliest
+                 * deadline found so far, no later task can bring it forward.
+                 * When the tick count reaches the deadline, every task whose
+                 * wake time has passed is unblocked together. */
+                while( ( pxItem != pxListEnd ) && ( listGET_LIST_ITEM_VALUE( pxItem ) <= xDeadline ) )
+                {
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+                    if( taskGET_WAKE_DEADLINE( listGET_LIST_ITEM_VALUE( pxItem ), pxTCB ) < xDeadline )
+                    {
+                        xDeadline = taskGET_WAKE_DEADLINE( listGET_LIST_ITEM_VALUE( pxItem ), pxTCB );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    pxItem = listGET_NEXT( pxItem );
+                }
+
+                xNextTaskUnblockTime = xDeadline;
+            }
+            #else /* configUSE_TIMER_SLACK */
+            {
+                /* The new current delayed list is not empty, get the value of
+                 * the item at the head of the delayed list.  This is the time at
+                 * which the task at the head of the delayed list should be removed
+                 * from the Blocked state. */
+                xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+            }
+            #endif /* configUSE_TIMER_SLACK */
+        }
+    }
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
 /*-----------------------------------------------------------*/
 
 #if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
@@ -4118,7 +5459,7 @@ static void prvResetNextTaskUnblockTime( void )
 #endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) || ( configUSE_HEAP_MAGAZINES == 1 ) )
 
     BaseType_t xTaskGetSchedulerState( void )
     {
@@ -4143,7 +5484,7 @@ static void prvResetNextTaskUnblockTime( void )
         return xReturn;
     }
 
-#endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) ) */
+#endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) || ( configUSE_HEAP_MAGAZINES == 1 ) ) */
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_MUTEXES == 1 )
@@ -4419,7 +5760,144 @@ static void prvResetNextTaskUnblockTime( void )
         }
     }
 
-#endif /* configUSE_MUTEXES */
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TICKETS == 1 ) && ( configUSE_MUTEXES == 1 ) )
+
+    BaseType_t xTaskTicketInherit( TaskHandle_t const pxTicketHolder )
+    {
+        TCB_t * const pxTicketHolderTCB = pxTicketHolder;
+        BaseType_t xReturn = pdFALSE;
+
+        if( pxTicketHolder != NULL )
+        {
+            /* The lottery only chooses between tasks of equal priority, where
+             * priority inheritance changes nothing, so the holder also takes
+             * the tickets of the calling task should it hold fewer.  The ready
+             * lists need not be touched as the lottery reads nTickets each
+             * time it draws. */
+            if( pxTicketHolderTCB->nTickets < pxCurrentTCB->nTickets )
+            {
+                pxTicketHolderTCB->nTickets = pxCurrentTCB->nTickets;
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                if( pxTicketHolderTCB->nBaseTickets < pxCurrentTCB->nTickets )
+                {
+                    /* The holder already holds tickets inherited from another
+                     * task that are at least as many as the calling task's. */
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* ( ( configUSE_TICKETS == 1 ) && ( configUSE_MUTEXES == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TICKETS == 1 ) && ( configUSE_MUTEXES == 1 ) )
+
+    void vTaskTicketDisinherit( TaskHandle_t const pxTicketHolder )
+    {
+        TCB_t * const pxTCB = pxTicketHolder;
+
+        if( pxTicketHolder != NULL )
+        {
+            configASSERT( pxTCB == pxCurrentTCB );
+
+            /* As xTaskPriorityDisinherit(), which has already decremented
+             * uxMutexesHeld, only disinherit if no other mutexes are held. */
+            if( ( pxTCB->nTickets != pxTCB->nBaseTickets ) &&
+                ( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 ) )
+            {
+                pxTCB->nTickets = pxTCB->nBaseTickets;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* ( ( configUSE_TICKETS == 1 ) && ( configUSE_MUTEXES == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TICKETS == 1 ) && ( configUSE_MUTEXES == 1 ) )
+
+    void vTaskTicketDisinheritAfterTimeout( TaskHandle_t const pxTicketHolder,
+                                            UBaseType_t uxHighestTicketsWaitingTask )
+    {
+        TCB_t * const pxTCB = pxTicketHolder;
+        UBaseType_t uxTicketsToUse;
+        const UBaseType_t uxOnlyOneMutexHeld = ( UBaseType_t ) 1;
+
+        if( pxTicketHolder != NULL )
+        {
+            configASSERT( pxTCB->uxMutexesHeld );
+
+            /* The greater of the holder's own tickets and those of the tasks
+             * still waiting. */
+            if( ( UBaseType_t ) pxTCB->nBaseTickets < uxHighestTicketsWaitingTask )
+            {
+                uxTicketsToUse = uxHighestTicketsWaitingTask;
+            }
+            else
+            {
+                uxTicketsToUse = ( UBaseType_t ) pxTCB->nBaseTickets;
+            }
+
+            /* Only disinherit if no other mutexes are held, for the reason
+             * given in vTaskPriorityDisinheritAfterTimeout(). */
+            if( ( ( UBaseType_t ) pxTCB->nTickets != uxTicketsToUse ) &&
+                ( pxTCB->uxMutexesHeld == uxOnlyOneMutexHeld ) )
+            {
+                configASSERT( pxTCB != pxCurrentTCB );
+                pxTCB->nTickets = uxTicketsToUse;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* ( ( configUSE_TICKETS == 1 ) && ( configUSE_MUTEXES == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TICKETS == 1 )
+
+    UBaseType_t uxTaskGetTickets( TaskHandle_t xTask )
+    {
+        TCB_t const * pxTCB;
+
+        /* Tickets are not changed from interrupts, so no critical section is
+         * needed to read them. */
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        return ( UBaseType_t ) pxTCB->nTickets;
+    }
+
+#endif /* configUSE_TICKETS */
 /*-----------------------------------------------------------*/
 
 #if ( portCRITICAL_NESTING_IN_TCB == 1 )
@@ -4739,6 +6217,236 @@ static void prvResetNextTaskUnblockTime( void )
 #endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
+
+/* Write one line of the vTaskGetTCBSizeReport() table, and add the size of the
+ * field to xFieldBytes. */
+    #define taskREPORT_TCB_FIELD( xField )                                                                                                                                                     \
+    {                                                                                                                                                                                          \
+        sprintf( pcWriteBuffer, "%-28s%8u%8u\r\n", #xField, ( unsigned int ) offsetof( TCB_t, xField ), ( unsigned int ) sizeof( ( ( TCB_t * ) 0 )->xField ) ); /*lint !e586 sprintf() allowed as this is a utility function only. */ \
+        pcWriteBuffer += strlen( pcWriteBuffer );                                                                                                                                              \
+        xFieldBytes += sizeof( ( ( TCB_t * ) 0 )->xField );                                                                                                                                    \
+    }
+
+    void vTaskGetTCBSizeReport( char * pcWriteBuffer )
+    {
+        size_t xFieldBytes = 0;
+
+        /* Make sure the write buffer does not contain a string. */
+        *pcWriteBuffer = ( char ) 0x00;
+
+        sprintf( pcWriteBuffer, "%-28s%8s%8s\r\n", "Field", "Offset", "Bytes" ); /*lint !e586 sprintf() allowed as this is a utility function only. */
+        pcWriteBuffer += strlen( pcWriteBuffer );
+
+        /* The fields are listed in the order in which they are declared, so
+         * in order of offset. */
+        taskREPORT_TCB_FIELD( pxTopOfStack );
+
+        #if ( portUSING_MPU_WRAPPERS == 1 )
+            taskREPORT_TCB_FIELD( xMPUSettings );
+        #endif
+
+        taskREPORT_TCB_FIELD( xStateListItem );
+        taskREPORT_TCB_FIELD( xEventListItem );
+
+        #if ( configUSE_COMPACT_TCB == 1 )
+        {
+            taskREPORT_TCB_FIELD( pxStack );
+
+            #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
+                taskREPORT_TCB_FIELD( pxEndOfStack );
+            #endif
+
+            #if ( portCRITICAL_NESTING_IN_TCB == 1 )
+                taskREPORT_TCB_FIELD( uxCriticalNesting );
+            #endif
+
+            #if ( configGENERATE_RUN_TIME_STATS == 1 )
+                taskREPORT_TCB_FIELD( ulRunTimeCounter );
+            #endif
+
+            #if ( ( configUSE_NEWLIB_REENTRANT == 1 ) || ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) )
+                taskREPORT_TCB_FIELD( xTLSBlock );
+            #endif
+
+            #if ( configUSE_POSIX_ERRNO == 1 )
+                taskREPORT_TCB_FIELD( iTaskErrno );
+            #endif
+
+            #if ( configUSE_TIMER_SLACK == 1 )
+                taskREPORT_TCB_FIELD( xDelaySlack );
+            #endif
+
+            #if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+                taskREPORT_TCB_FIELD( ullWideEventItemValue );
+            #endif
+
+            #if ( configUSE_TRACE_FACILITY == 1 )
+                taskREPORT_TCB_FIELD( uxTCBNumber );
+                taskREPORT_TCB_FIELD( uxTaskNumber );
+            #endif
+
+            #if ( configUSE_HEAP_ACCOUNTING == 1 )
+                taskREPORT_TCB_FIELD( xHeapUsage );
+            #endif
+
+            #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+                taskREPORT_TCB_FIELD( ulNotifiedValue );
+            #endif
+
+            taskREPORT_TCB_FIELD( uxPriority );
+
+            #if ( configUSE_MUTEXES == 1 )
+                taskREPORT_TCB_FIELD( uxBasePriority );
+                taskREPORT_TCB_FIELD( uxMutexesHeld );
+            #endif
+
+            #if ( configUSE_TICKETS == 1 )
+                taskREPORT_TCB_FIELD( nTickets );
+                taskREPORT_TCB_FIELD( nBaseTickets );
+            #endif
+
+            #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+                taskREPORT_TCB_FIELD( ucNotifyState );
+            #endif
+
+            #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+                taskREPORT_TCB_FIELD( ucStaticallyAllocated );
+            #endif
+
+            #if ( INCLUDE_xTaskAbortDelay == 1 )
+                taskREPORT_TCB_FIELD( ucDelayAborted );
+            #endif
+
+            #if ( tskUSE_TASK_SIDE_TABLE == 1 )
+                taskREPORT_TCB_FIELD( ucSideTableIndex );
+            #endif
+
+            taskREPORT_TCB_FIELD( pcTaskName );
+        }
+        #else /* configUSE_COMPACT_TCB */
+        {
+            taskREPORT_TCB_FIELD( uxPriority );
+            taskREPORT_TCB_FIELD( pxStack );
+            taskREPORT_TCB_FIELD( pcTaskName );
+
+            #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
+                taskREPORT_TCB_FIELD( pxEndOfStack );
+            #endif
+
+            #if ( portCRITICAL_NESTING_IN_TCB == 1 )
+                taskREPORT_TCB_FIELD( uxCriticalNesting );
+            #endif
+
+            #if ( configUSE_TRACE_FACILITY == 1 )
+                taskREPORT_TCB_FIELD( uxTCBNumber );
+                taskREPORT_TCB_FIELD( uxTaskNumber );
+            #endif
+
+            #if ( configUSE_MUTEXES == 1 )
+                taskREPORT_TCB_FIELD( uxBasePriority );
+                taskREPORT_TCB_FIELD( uxMutexesHeld );
+            #endif
+
+            #if ( configUSE_APPLICATION_TASK_TAG == 1 )
+                taskREPORT_TCB_FIELD( pxTaskTag );
+            #endif
+
+            #if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
+                taskREPORT_TCB_FIELD( pvThreadLocalStoragePointers );
+            #endif
+
+            #if ( configGENERATE_RUN_TIME_STATS == 1 )
+                taskREPORT_TCB_FIELD( ulRunTimeCounter );
+            #endif
+
+            #if ( ( configUSE_NEWLIB_REENTRANT == 1 ) || ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) )
+                taskREPORT_TCB_FIELD( xTLSBlock );
+            #endif
+
+            #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+                taskREPORT_TCB_FIELD( ulNotifiedValue );
+                taskREPORT_TCB_FIELD( ucNotifyState );
+            #endif
+
+            #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+                taskREPORT_TCB_FIELD( ucStaticallyAllocated );
+            #endif
+
+            #if ( INCLUDE_xTaskAbortDelay == 1 )
+                taskREPORT_TCB_FIELD( ucDelayAborted );
+            #endif
+
+            #if ( configUSE_POSIX_ERRNO == 1 )
+                taskREPORT_TCB_FIELD( iTaskErrno );
+            #endif
+
+            #if ( configUSE_TIMER_SLACK == 1 )
+                taskREPORT_TCB_FIELD( xDelaySlack );
+            #endif
+
+            #if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+                taskREPORT_TCB_FIELD( ullWideEventItemValue );
+            #endif
+
+            #if ( configUSE_HEAP_ACCOUNTING == 1 )
+                taskREPORT_TCB_FIELD( xHeapUsage );
+            #endif
+
+            #if ( configUSE_TICKETS == 1 )
+                taskREPORT_TCB_FIELD( nTickets );
+                taskREPORT_TCB_FIELD( nBaseTickets );
+            #endif
+        }
+        #endif /* configUSE_COMPACT_TCB */
+
+        /* The padding the compiler inserted for alignment, then the totals. */
+        sprintf( pcWriteBuffer, "%-28s%8s%8u\r\n%-28s%8s%8u\r\n", "(padding)", "", ( unsigned int ) ( sizeof( TCB_t ) - xFieldBytes ), "TCB per task", "", ( unsigned int ) sizeof( TCB_t ) ); /*lint !e586 sprintf() allowed as this is a utility function only. */
+        pcWriteBuffer += strlen( pcWriteBuffer );
+
+        #if ( tskUSE_TASK_SIDE_TABLE == 1 )
+        {
+            sprintf( pcWriteBuffer, "%-28s%8u%8u\r\n", "Side table (entries)", ( unsigned int ) configTASK_SIDE_TABLE_LENGTH, ( unsigned int ) sizeof( xTaskSideTable ) ); /*lint !e586 sprintf() allowed as this is a utility function only. */
+        }
+        #endif
+    }
+
+    #undef taskREPORT_TCB_FIELD
+
+#endif /* configUSE_STATS_FORMATTING_FUNCTIONS */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_STACK_PROFILING == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+    void vTaskGetStackProfileReport( char * pcWriteBuffer )
+    {
+        UBaseType_t x;
+
+        /* Make sure the write buffer does not contain a string. */
+        *pcWriteBuffer = ( char ) 0x00;
+
+        vTaskSuspendAll();
+        {
+            /* Only called to bring xStackProfile up to date. */
+            ( void ) uxTaskGetStackProfile( NULL, ( UBaseType_t ) 0U );
+
+            for( x = ( UBaseType_t ) 0U; x < uxStackProfileEntries; x++ )
+            {
+                /* Write the task name to the string, padding with spaces so it
+                 * can be printed in tabular form more easily. */
+                pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, xStackProfile[ x ].pcTaskName );
+
+                /* Write the rest of the string. */
+                sprintf( pcWriteBuffer, "\t%u\t%u\t%u\r\n", ( unsigned int ) xStackProfile[ x ].uxStackDepth, ( unsigned int ) xStackProfile[ x ].uxPeakUsage, ( unsigned int ) xStackProfile[ x ].uxRecommendedDepth ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+                pcWriteBuffer += strlen( pcWriteBuffer );                                                                                                                                                                                      /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
+            }
+        }
+        ( void ) xTaskResumeAll();
+    }
+
+#endif /* ( ( configUSE_STACK_PROFILING == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+/*-----------------------------------------------------------*/
+
 TickType_t uxTaskResetEventItemValue( void )
 {
     TickType_t uxReturn;
@@ -4753,6 +6461,114 @@ TickType_t uxTaskResetEventItemValue( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_WIDE_EVENT_GROUPS == 1 )
+
+    void vTaskSetWideEventItemValue( TaskHandle_t xTask,
+                                     uint64_t ullValue )
+    {
+        TCB_t * const pxTCB = prvGetTCBFromHandle( xTask );
+
+        /* The value is only accessed by the event groups implementation with
+         * the scheduler suspended, or by the owning task itself. */
+        pxTCB->ullWideEventItemValue = ullValue;
+    }
+/*-----------------------------------------------------------*/
+
+    uint64_t ullTaskGetWideEventItemValue( TaskHandle_t xTask )
+    {
+        TCB_t const * const pxTCB = prvGetTCBFromHandle( xTask );
+
+        return pxTCB->ullWideEventItemValue;
+    }
+
+#endif /* configUSE_WIDE_EVENT_GROUPS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_ACCOUNTING == 1 )
+
+    BaseType_t xTaskCheckHeapQuota( size_t xWantedSize )
+    {
+        TaskHeapUsage_t * pxHeapUsage;
+        BaseType_t xReturn = pdTRUE;
+
+        /* Allocations made before the scheduler starts are not charged to a
+         * task, so are not limited by any quota. */
+        if( xSchedulerRunning != pdFALSE )
+        {
+            pxHeapUsage = &( pxCurrentTCB->xHeapUsage );
+
+            if( ( pxHeapUsage->xQuotaBytes != ( size_t ) 0 ) &&
+                ( ( pxHeapUsage->xCurrentBytes > pxHeapUsage->xQuotaBytes ) ||
+                  ( xWantedSize > ( pxHeapUsage->xQuotaBytes - pxHeapUsage->xCurrentBytes ) ) ) )
+            {
+                pxHeapUsage->xFailedAllocations++;
+                xReturn = pdFALSE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void * pvTaskChargeHeapUsage( size_t xBlockSize )
+    {
+        TaskHeapUsage_t * pxHeapUsage;
+        void * pvOwner = NULL;
+
+        if( xSchedulerRunning != pdFALSE )
+        {
+            pxHeapUsage = &( pxCurrentTCB->xHeapUsage );
+            pxHeapUsage->xCurrentBytes += xBlockSize;
+
+            if( pxHeapUsage->xCurrentBytes > pxHeapUsage->xPeakBytes )
+            {
+                pxHeapUsage->xPeakBytes = pxHeapUsage->xCurrentBytes;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pvOwner = ( void * ) pxCurrentTCB;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pvOwner;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskCreditHeapUsage( void * pvOwner,
+                               size_t xBlockSize )
+    {
+        TCB_t * const pxTCB = ( TCB_t * ) pvOwner;
+
+        /* The owner is NULL if the block was allocated before the scheduler
+         * started, or if the task that allocated it has since been deleted. */
+        if( pxTCB != NULL )
+        {
+            configASSERT( pxTCB->xHeapUsage.xCurrentBytes >= xBlockSize );
+            pxTCB->xHeapUsage.xCurrentBytes -= xBlockSize;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_HEAP_ACCOUNTING */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_MUTEXES == 1 )
 
     TaskHandle_t pvTaskIncrementMutexHeldCount( void )
@@ -4761,6 +6577,13 @@ TickType_t uxTaskResetEventItemValue( void )
          * then pxCurrentTCB will be NULL. */
         if( pxCurrentTCB != NULL )
         {
+            #if ( configUSE_COMPACT_TCB == 1 )
+            {
+                /* The compact TCB counts the mutexes held in a single byte. */
+                configASSERT( pxCurrentTCB->uxMutexesHeld < ( uint8_t ) 0xffU );
+            }
+            #endif
+
             ( pxCurrentTCB->uxMutexesHeld )++;
         }
 
@@ -5429,20 +7252,21 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
             {
                 /* Wake time has overflowed.  Place this item in the overflow
                  * list. */
-                vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+                taskINSERT_DELAYED_TASK( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
             }
             else
             {
                 /* The wake time has not overflowed, so the current block list
                  * is used. */
-                vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+                taskINSERT_DELAYED_TASK( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 
                 /* If the task entering the blocked state was placed at the
                  * head of the list of blocked tasks then xNextTaskUnblockTime
-                 * needs to be updated too. */
-                if( xTimeToWake < xNextTaskUnblockTime )
+                 * needs to be updated too.  With configUSE_TIMER_SLACK the
+                 * task can wait until its wake time plus its slack. */
+                if( taskGET_WAKE_DEADLINE( xTimeToWake, pxCurrentTCB ) < xNextTaskUnblockTime )
                 {
-                    xNextTaskUnblockTime = xTimeToWake;
+                    xNextTaskUnblockTime = taskGET_WAKE_DEADLINE( xTimeToWake, pxCurrentTCB );
                 }
                 else
                 {
@@ -5464,19 +7288,20 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
         if( xTimeToWake < xConstTickCount )
         {
             /* Wake time has overflowed.  Place this item in the overflow list. */
-            vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+            taskINSERT_DELAYED_TASK( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
         }
         else
         {
             /* The wake time has not overflowed, so the current block list is used. */
-            vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+            taskINSERT_DELAYED_TASK( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 
             /* If the task entering the blocked state was placed at the head of the
              * list of blocked tasks then xNextTaskUnblockTime needs to be updated
-             * too. */
-            if( xTimeToWake < xNextTaskUnblockTime )
+             * too.  With configUSE_TIMER_SLACK the task can wait until its wake
+             * time plus its slack. */
+            if( taskGET_WAKE_DEADLINE( xTimeToWake, pxCurrentTCB ) < xNextTaskUnblockTime )
             {
-                xNextTaskUnblockTime = xTimeToWake;
+                xNextTaskUnblockTime = taskGET_WAKE_DEADLINE( xTimeToWake, pxCurrentTCB );
             }
             else
             {
@@ -82,6 +82,9 @@
         #if ( configUSE_TRACE_FACILITY == 1 )
             UBaseType_t uxTimerNumber;              /*<< An ID assigned by trace tools such as FreeRTOS+Trace */
         #endif
+        #if ( configUSE_TIMER_SLACK == 1 )
+            TickType_t xTimerSlackInTicks;          /*<< How late after its expiry time the timer may be processed. */
+        #endif
         uint8_t ucStatus;                           /*<< Holds bits to say if the timer was statically allocated or not, and if it is active or not. */
     } xTIMER;
 
@@ -134,10 +137,14 @@
  * xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
  * breaks some kernel aware debuggers, and debuggers that reply on removing the
  * static qualifier. */
-    PRIVILEGED_DATA static List_t xActiveTimerList1;
-    PRIVILEGED_DATA static List_t xActiveTimerList2;
-    PRIVILEGED_DATA static List_t * pxCurrentTimerList;
-    PRIVILEGED_DATA static List_t * pxOverflowTimerList;
+    #if ( configUSE_TIMER_WHEEL == 1 )
+        PRIVILEGED_DATA static ListWheel_t xActiveTimerWheel; /*< Active timers, filed by expiry time.  Replaces the two active timer lists. */
+    #else
+        PRIVILEGED_DATA static List_t xActiveTimerList1;
+        PRIVILEGED_DATA static List_t xActiveTimerList2;
+        PRIVILEGED_DATA static List_t * pxCurrentTimerList;
+        PRIVILEGED_DATA static List_t * pxOverflowTimerList;
+    #endif
 
 /* A queue that is used to send commands to the timer service task. */
     PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
@@ -145,6 +152,29 @@
 
 /*lint -restore */
 
+    #if ( configUSE_TIMER_WHEEL == 1 )
+
+/* The timer wheel is indexed modulo the tick count, so an expiry time that
+ * has wrapped past the tick count overflow is held alongside those that have
+ * not.  Expiry times are therefore compared relative to the time the wheel has
+ * been advanced to, which is never later than the time now. */
+        #define tmrEXPIRY_TIME_REACHED( xExpiryTime, xTimeNow )                                  \
+    ( ( ( TickType_t ) ( ( xExpiryTime ) - listWHEEL_GET_WHEEL_TIME( &xActiveTimerWheel ) ) ) <= \
+      ( ( TickType_t ) ( ( xTimeNow ) - listWHEEL_GET_WHEEL_TIME( &xActiveTimerWheel ) ) ) )
+
+/* Place a timer in the wheel.  pxList, which would name the current or
+ * overflow timer list, is not needed. */
+        #define tmrINSERT_ACTIVE_TIMER( pxList, pxTimer )    vListWheelInsert( &xActiveTimerWheel, &( ( pxTimer )->xTimerListItem ) )
+
+    #else /* configUSE_TIMER_WHEEL */
+
+        #define tmrEXPIRY_TIME_REACHED( xExpiryTime, xTimeNow )    ( ( xExpiryTime ) <= ( xTimeNow ) )
+
+/* Place a timer in pxList in expiry time order. */
+        #define tmrINSERT_ACTIVE_TIMER( pxList, pxTimer )          vListInsert( ( pxList ), &( ( pxTimer )->xTimerListItem ) )
+
+    #endif /* configUSE_TIMER_WHEEL */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -161,14 +191,37 @@
     static portTASK_FUNCTION_PROTO( prvTimerTask, pvParameters ) PRIVILEGED_FUNCTION;
 
 /*
- * Called by the timer service task to interpret and process a command it
- * received on the timer queue.
+ * Called by the timer service task to interpret and process the commands it
+ * received on the timer queue.  Commands are removed from the queue up to
+ * configTIMER_COMMAND_BATCH_LENGTH at a time, and the time is sampled once for
+ * each batch.
  */
     static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Returns pdTRUE if the timer command at uxIndex in the batch pxBatch, which
+ * holds uxBatchLength commands, has no effect because a later command in the
+ * same batch acts on the same timer and overrides it, for example a reset that
+ * is followed by another reset.
+ */
+    static BaseType_t prvIsCommandSuperseded( const DaemonTaskMessage_t * const pxBatch,
+                                              const UBaseType_t uxIndex,
+                                              const UBaseType_t uxBatchLength,
+                                              const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if processing the timer command pxMessage at xTimeNow could
+ * call a timer callback, which is the case for a start or reset that finds the
+ * timer expired before the command was processed.
+ */
+    static BaseType_t prvCommandMayCallCallback( const DaemonTaskMessage_t * const pxMessage,
+                                                 const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
 /*
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
- * depending on if the expire time causes a timer counter overflow.
+ * depending on if the expire time causes a timer counter overflow.  When
+ * configUSE_TIMER_WHEEL is 1 the timer is inserted into xActiveTimerWheel in
+ * either case.
  */
     static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer,
                                                   const TickType_t xNextExpiryTime,
@@ -186,7 +239,9 @@
 
 /*
  * An active timer has reached its expire time.  Reload the timer if it is an
- * auto-reload timer, then call its callback.
+ * auto-reload timer, then call its callback.  When configUSE_TIMER_WHEEL is 1
+ * xNextExpireTime may be earlier than the expiry time of any timer, in which
+ * case the wheel is advanced to xTimeNow and no timer may have expired.
  */
     static void prvProcessExpiredTimer( const TickType_t xNextExpireTime,
                                         const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
@@ -218,6 +273,16 @@
     static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime,
                                             BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
 
+/*
+ * Return the latest time at which the timer service task can wake without
+ * processing any timer in the current timer list later than that timer's
+ * expiry time plus its slack.  Must only be called if the current timer list
+ * is not empty.
+ */
+    #if ( configUSE_TIMER_SLACK == 1 )
+        static TickType_t prvGetCoalescedWakeTime( void ) PRIVILEGED_FUNCTION;
+    #endif
+
 /*
  * Called after a Timer_t structure has been allocated either statically or
  * dynamically to fill in the structure's members.
@@ -255,7 +320,8 @@
                                                       NULL,
                                                       ( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
                                                       pxTimerTaskStackBuffer,
-                                                      pxTimerTaskTCBBuffer );
+                                                      pxTimerTaskTCBBuffer,
+                                                      0 ); /* No tickets, as for the dynamically created timer task. */
 
                 if( xTimerTaskHandle != NULL )
                 {
@@ -294,7 +360,7 @@
         {
             Timer_t * pxNewTimer;
 
-            pxNewTimer = ( Timer_t * ) pvPortMalloc( sizeof( Timer_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of Timer_t is always a pointer to the timer's mame. */
+            pxNewTimer = ( Timer_t * ) pvPortMallocObject( sizeof( Timer_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of Timer_t is always a pointer to the timer's mame. */
 
             if( pxNewTimer != NULL )
             {
@@ -375,6 +441,12 @@
         pxNewTimer->pxCallbackFunction = pxCallbackFunction;
         vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
 
+        #if ( configUSE_TIMER_SLACK == 1 )
+        {
+            pxNewTimer->xTimerSlackInTicks = ( TickType_t ) 0U;
+        }
+        #endif
+
         if( xAutoReload != pdFALSE )
         {
             pxNewTimer->ucStatus |= tmrSTATUS_IS_AUTORELOAD;
@@ -511,6 +583,37 @@
     }
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_TIMER_SLACK == 1 )
+
+        void vTimerSetSlack( TimerHandle_t xTimer,
+                             TickType_t xSlackTicks )
+        {
+            Timer_t * pxTimer = xTimer;
+
+            configASSERT( xTimer );
+            taskENTER_CRITICAL();
+            {
+                pxTimer->xTimerSlackInTicks = xSlackTicks;
+            }
+            taskEXIT_CRITICAL();
+        }
+
+    #endif /* configUSE_TIMER_SLACK */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TIMER_SLACK == 1 )
+
+        TickType_t xTimerGetSlack( TimerHandle_t xTimer )
+        {
+            Timer_t * pxTimer = xTimer;
+
+            configASSERT( xTimer );
+            return pxTimer->xTimerSlackInTicks;
+        }
+
+    #endif /* configUSE_TIMER_SLACK */
+/*-----------------------------------------------------------*/
+
     const char * pcTimerGetName( TimerHandle_t xTimer ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
     {
         Timer_t * pxTimer = xTimer;
@@ -539,31 +642,82 @@
     }
 /*-----------------------------------------------------------*/
 
-    static void prvProcessExpiredTimer( const TickType_t xNextExpireTime,
-                                        const TickType_t xTimeNow )
-    {
-        Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+    #if ( configUSE_TIMER_WHEEL == 1 )
+
+        static void prvProcessExpiredTimer( const TickType_t xNextExpireTime,
+                                            const TickType_t xTimeNow )
+        {
+            ListItem_t * pxExpiredItem;
+            Timer_t * pxTimer;
+            TickType_t xExpiredTime;
+
+            /* xNextExpireTime can be the time at which the wheel slot holding
+             * the earliest timers is cascaded to a lower level, rather than the
+             * expiry time of one of them, so advance the wheel to the time now
+             * to find the timer that has expired.  If the wheel only cascades
+             * then no timer has expired yet, and the caller obtains a new next
+             * expire time. */
+            ( void ) xNextExpireTime;
+            pxExpiredItem = pxListWheelGetExpired( &xActiveTimerWheel, xTimeNow );
+
+            if( pxExpiredItem != NULL )
+            {
+                pxTimer = ( Timer_t * ) listGET_LIST_ITEM_OWNER( pxExpiredItem ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                xExpiredTime = listGET_LIST_ITEM_VALUE( pxExpiredItem );
 
-        /* Remove the timer from the list of active timers.  A check has already
-         * been performed to ensure the list is not empty. */
+                /* Remove the timer from the wheel of active timers. */
+                ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
 
-        ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+                /* If the timer is an auto-reload timer then calculate the next
+                 * expiry time and re-insert the timer in the wheel. */
+                if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
+                {
+                    prvReloadTimer( pxTimer, xExpiredTime, xTimeNow );
+                }
+                else
+                {
+                    pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+                }
 
-        /* If the timer is an auto-reload timer then calculate the next
-         * expiry time and re-insert the timer in the list of active timers. */
-        if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
-        {
-            prvReloadTimer( pxTimer, xNextExpireTime, xTimeNow );
+                /* Call the timer callback. */
+                traceTIMER_EXPIRED( pxTimer );
+                pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
-        else
+
+    #else /* configUSE_TIMER_WHEEL */
+
+        static void prvProcessExpiredTimer( const TickType_t xNextExpireTime,
+                                            const TickType_t xTimeNow )
         {
-            pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+            Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+            /* Remove the timer from the list of active timers.  A check has already
+             * been performed to ensure the list is not empty. */
+
+            ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+
+            /* If the timer is an auto-reload timer then calculate the next
+             * expiry time and re-insert the timer in the list of active timers. */
+            if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
+            {
+                prvReloadTimer( pxTimer, xNextExpireTime, xTimeNow );
+            }
+            else
+            {
+                pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+            }
+
+            /* Call the timer callback. */
+            traceTIMER_EXPIRED( pxTimer );
+            pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
         }
 
-        /* Call the timer callback. */
-        traceTIMER_EXPIRED( pxTimer );
-        pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
-    }
+    #endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
     static portTASK_FUNCTION( prvTimerTask, pvParameters )
@@ -605,7 +759,7 @@
     static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime,
                                             BaseType_t xListWasEmpty )
     {
-        TickType_t xTimeNow;
+        TickType_t xTimeNow, xWakeTime = xNextExpireTime;
         BaseType_t xTimerListsWereSwitched;
 
         vTaskSuspendAll();
@@ -620,7 +774,7 @@
             if( xTimerListsWereSwitched == pdFALSE )
             {
                 /* The tick count has not overflowed, has the timer expired? */
-                if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
+                if( ( xListWasEmpty == pdFALSE ) && ( tmrEXPIRY_TIME_REACHED( xNextExpireTime, xTimeNow ) ) )
                 {
                     ( void ) xTaskResumeAll();
                     prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
@@ -633,14 +787,34 @@
                      * received - whichever comes first.  The following line cannot
                      * be reached unless xNextExpireTime > xTimeNow, except in the
                      * case when the current timer list is empty. */
-                    if( xListWasEmpty != pdFALSE )
+                    #if ( configUSE_TIMER_WHEEL == 0 )
                     {
-                        /* The current timer list is empty - is the overflow list
-                         * also empty? */
-                        xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+                        if( xListWasEmpty != pdFALSE )
+                        {
+                            /* The current timer list is empty - is the overflow list
+                             * also empty? */
+                            xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+                        }
+                    }
+                    #endif /* configUSE_TIMER_WHEEL */
+
+                    #if ( configUSE_TIMER_SLACK == 1 )
+                    {
+                        if( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+                        {
+                            /* Sleep for as long as the slack of the timers that
+                             * expire first allows, so that timers which expire
+                             * close together are processed in one wakeup. */
+                            xWakeTime = prvGetCoalescedWakeTime();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
                     }
+                    #endif /* configUSE_TIMER_SLACK */
 
-                    vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+                    vQueueWaitForMessageRestricted( xTimerQueue, ( xWakeTime - xTimeNow ), xListWasEmpty );
 
                     if( xTaskResumeAll() == pdFALSE )
                     {
@@ -675,22 +849,95 @@
          * this task to unblock when the tick count overflows, at which point the
          * timer lists will be switched and the next expiry time can be
          * re-assessed.  */
-        *pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
-
-        if( *pxListWasEmpty == pdFALSE )
+        #if ( configUSE_TIMER_WHEEL == 1 )
         {
-            xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+            /* The wheel holds the timers of both lists, so the expiry time may
+             * be beyond the tick count overflow.  The caller blocks for the
+             * number of ticks between now and then either way.  The time can
+             * also be earlier than the expiry time of any timer, when the
+             * wheel must first be advanced to cascade the earliest timers to a
+             * lower level. */
+            if( xListWheelGetNextExpiry( &xActiveTimerWheel, &xNextExpireTime ) != pdFALSE )
+            {
+                *pxListWasEmpty = pdFALSE;
+            }
+            else
+            {
+                *pxListWasEmpty = pdTRUE;
+                xNextExpireTime = ( TickType_t ) 0U;
+            }
         }
-        else
+        #else /* configUSE_TIMER_WHEEL */
         {
-            /* Ensure the task unblocks when the tick count rolls over. */
-            xNextExpireTime = ( TickType_t ) 0U;
+            *pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
+
+            if( *pxListWasEmpty == pdFALSE )
+            {
+                xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+            }
+            else
+            {
+                /* Ensure the task unblocks when the tick count rolls over. */
+                xNextExpireTime = ( TickType_t ) 0U;
+            }
         }
+        #endif /* configUSE_TIMER_WHEEL */
 
         return xNextExpireTime;
     }
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_TIMER_SLACK == 1 )
+
+        static TickType_t prvGetCoalescedWakeTime( void )
+        {
+            const ListItem_t * pxItem = listGET_HEAD_ENTRY( pxCurrentTimerList );
+            const ListItem_t * const pxListEnd = listGET_END_MARKER( pxCurrentTimerList );
+            const Timer_t * pxTimer;
+            TickType_t xWakeTime = tmrMAX_TIME_BEFORE_OVERFLOW;
+            TickType_t xLatestTime;
+
+            /* Timers are listed in expiry time order.  Each timer must be
+             * processed by its expiry time plus its slack, and the wake time is
+             * the earliest of these.  Once a timer is reached that does not
+             * expire until after the wake time found so far, neither it nor any
+             * timer after it can bring the wake time forward.  When the task
+             * wakes, every timer that has expired by then is processed. */
+            while( ( pxItem != pxListEnd ) && ( listGET_LIST_ITEM_VALUE( pxItem ) <= xWakeTime ) )
+            {
+                pxTimer = ( const Timer_t * ) listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                xLatestTime = listGET_LIST_ITEM_VALUE( pxItem ) + pxTimer->xTimerSlackInTicks;
+
+                if( xLatestTime < listGET_LIST_ITEM_VALUE( pxItem ) )
+                {
+                    /* The slack reaches past the tick count overflow, but the
+                     * lists are switched, and the timers in the current list
+                     * processed, when the tick count overflows anyway. */
+                    xLatestTime = tmrMAX_TIME_BEFORE_OVERFLOW;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( xLatestTime < xWakeTime )
+                {
+                    xWakeTime = xLatestTime;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxItem = listGET_NEXT( pxItem );
+            }
+
+            return xWakeTime;
+        }
+
+    #endif /* configUSE_TIMER_SLACK */
+/*-----------------------------------------------------------*/
+
     static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
     {
         TickType_t xTimeNow;
@@ -736,7 +983,7 @@
             }
             else
             {
-                vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+                tmrINSERT_ACTIVE_TIMER( pxOverflowTimerList, pxTimer );
             }
         }
         else
@@ -750,7 +997,7 @@
             }
             else
             {
-                vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+                tmrINSERT_ACTIVE_TIMER( pxCurrentTimerList, pxTimer );
             }
         }
 
@@ -758,177 +1005,386 @@
     }
 /*-----------------------------------------------------------*/
 
-    static void prvProcessReceivedCommands( void )
+    static BaseType_t prvCommandMayCallCallback( const DaemonTaskMessage_t * const pxMessage,
+                                                 const TickType_t xTimeNow )
     {
-        DaemonTaskMessage_t xMessage;
-        Timer_t * pxTimer;
-        BaseType_t xTimerListsWereSwitched;
-        TickType_t xTimeNow;
+        const TimerParameter_t * const pxParameters = &( pxMessage->u.xTimerParameters );
+        TickType_t xNextExpiryTime;
+        BaseType_t xReturn;
 
-        while( xQueueReceive( xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
+        switch( pxMessage->xMessageID )
         {
-            #if ( INCLUDE_xTimerPendFunctionCall == 1 )
-            {
-                /* Negative commands are pended function calls rather than timer
-                 * commands. */
-                if( xMessage.xMessageID < ( BaseType_t ) 0 )
-                {
-                    const CallbackParameters_t * const pxCallback = &( xMessage.u.xCallbackParameters );
+            case tmrCOMMAND_START:
+            case tmrCOMMAND_START_FROM_ISR:
+            case tmrCOMMAND_RESET:
+            case tmrCOMMAND_RESET_FROM_ISR:
 
-                    /* The timer uses the xCallbackParameters member to request a
-                     * callback be executed.  Check the callback is not NULL. */
-                    configASSERT( pxCallback );
+                /* These are the same checks as made by
+                 * prvInsertTimerInActiveList(). */
+                xNextExpiryTime = pxParameters->xMessageValue + pxParameters->pxTimer->xTimerPeriodInTicks;
 
-                    /* Call the function. */
-                    pxCallback->pxCallbackFunction( pxCallback->pvParameter1, pxCallback->ulParameter2 );
+                if( xNextExpiryTime <= xTimeNow )
+                {
+                    xReturn = ( ( ( TickType_t ) ( xTimeNow - pxParameters->xMessageValue ) ) >= pxParameters->pxTimer->xTimerPeriodInTicks ) ? pdTRUE : pdFALSE;
                 }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    xReturn = ( ( xTimeNow < pxParameters->xMessageValue ) && ( xNextExpiryTime >= pxParameters->xMessageValue ) ) ? pdTRUE : pdFALSE;
                 }
-            }
-            #endif /* INCLUDE_xTimerPendFunctionCall */
 
-            /* Commands that are positive are timer commands rather than pended
-             * function calls. */
-            if( xMessage.xMessageID >= ( BaseType_t ) 0 )
+                break;
+
+            default:
+                xReturn = pdFALSE;
+                break;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvIsCommandSuperseded( const DaemonTaskMessage_t * const pxBatch,
+                                              const UBaseType_t uxIndex,
+                                              const UBaseType_t uxBatchLength,
+                                              const TickType_t xTimeNow )
+    {
+        const Timer_t * const pxTimer = pxBatch[ uxIndex ].u.xTimerParameters.pxTimer;
+        UBaseType_t uxLater;
+        BaseType_t xCanBeSuperseded, xSuperseded = pdFALSE;
+
+        switch( pxBatch[ uxIndex ].xMessageID )
+        {
+            case tmrCOMMAND_START:
+            case tmrCOMMAND_START_FROM_ISR:
+            case tmrCOMMAND_RESET:
+            case tmrCOMMAND_RESET_FROM_ISR:
+
+                /* A start or reset can only be skipped if it would not find
+                 * that the timer expired before the command was processed, as
+                 * then the callback would be called. */
+                xCanBeSuperseded = ( prvCommandMayCallCallback( &( pxBatch[ uxIndex ] ), xTimeNow ) == pdFALSE ) ? pdTRUE : pdFALSE;
+                break;
+
+            case tmrCOMMAND_STOP:
+            case tmrCOMMAND_STOP_FROM_ISR:
+                xCanBeSuperseded = pdTRUE;
+                break;
+
+            default:
+
+                /* A change of period sets the period used by later commands,
+                 * and a delete can free the timer, so neither can be skipped. */
+                xCanBeSuperseded = pdFALSE;
+                break;
+        }
+
+        if( xCanBeSuperseded != pdFALSE )
+        {
+            for( uxLater = uxIndex + ( UBaseType_t ) 1U; uxLater < uxBatchLength; uxLater++ )
             {
-                /* The messages uses the xTimerParameters member to work on a
-                 * software timer. */
-                pxTimer = xMessage.u.xTimerParameters.pxTimer;
+                if( pxBatch[ uxLater ].xMessageID < ( BaseType_t ) 0 )
+                {
+                    /* A pended function call could look at the timer, so the
+                     * timer must be left in the state the command puts it in. */
+                    break;
+                }
+
+                if( pxBatch[ uxLater ].u.xTimerParameters.pxTimer == pxTimer )
+                {
+                    /* A later start, reset, stop or change of period removes the
+                     * timer from the active list and sets both its state and its
+                     * expiry time, so nothing the earlier command did remains. */
+                    switch( pxBatch[ uxLater ].xMessageID )
+                    {
+                        case tmrCOMMAND_START:
+                        case tmrCOMMAND_START_FROM_ISR:
+                        case tmrCOMMAND_RESET:
+                        case tmrCOMMAND_RESET_FROM_ISR:
+                        case tmrCOMMAND_STOP:
+                        case tmrCOMMAND_STOP_FROM_ISR:
+                        case tmrCOMMAND_CHANGE_PERIOD:
+                        case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR:
+                            xSuperseded = pdTRUE;
+                            break;
+
+                        default:
+                            break;
+                    }
 
-                if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
+                    break;
+                }
+                else if( ( pxBatch[ uxLater ].xMessageID == tmrCOMMAND_CHANGE_PERIOD ) ||
+                         ( pxBatch[ uxLater ].xMessageID == tmrCOMMAND_CHANGE_PERIOD_FROM_ISR ) ||
+                         ( prvCommandMayCallCallback( &( pxBatch[ uxLater ] ), xTimeNow ) != pdFALSE ) )
                 {
-                    /* The timer is in a list, remove it. */
-                    ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+                    /* A command in between calls the callback of another timer,
+                     * which could look at this timer, so the timer must be left
+                     * in the state this command puts it in.  A change of period
+                     * can make a later command of the other timer call its
+                     * callback, so is treated the same way. */
+                    break;
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-                traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
+        return xSuperseded;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvProcessReceivedCommands( void )
+    {
+        PRIVILEGED_DATA static DaemonTaskMessage_t xCommandBatch[ configTIMER_COMMAND_BATCH_LENGTH ]; /*lint !e956 Variable is only accessible to one task. */
+        const DaemonTaskMessage_t * pxMessage;
+        Timer_t * pxTimer;
+        BaseType_t xTimerListsWereSwitched;
+        TickType_t xTimeNow;
+        UBaseType_t uxBatchLength, uxIndex;
 
-                /* In this case the xTimerListsWereSwitched parameter is not used, but
-                 *  it must be present in the function call.  prvSampleTimeNow() must be
-                 *  called after the message is received from xTimerQueue so there is no
-                 *  possibility of a higher priority task adding a message to the message
-                 *  queue with a time that is ahead of the timer daemon task (because it
-                 *  pre-empted the timer daemon task after the xTimeNow value was set). */
-                xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+        for( ; ; )
+        {
+            /* Remove as many commands as will fit in the batch with a single
+             * queue access. */
+            uxBatchLength = uxQueueReceiveRestricted( xTimerQueue, xCommandBatch, ( UBaseType_t ) configTIMER_COMMAND_BATCH_LENGTH );
 
-                switch( xMessage.xMessageID )
+            if( uxBatchLength == ( UBaseType_t ) 0U )
+            {
+                break;
+            }
+
+            /* In this case the xTimerListsWereSwitched parameter is not used, but
+             *  it must be present in the function call.  prvSampleTimeNow() must be
+             *  called after the messages are received from xTimerQueue so there is no
+             *  possibility of a higher priority task adding a message to the message
+             *  queue with a time that is ahead of the timer daemon task (because it
+             *  pre-empted the timer daemon task after the xTimeNow value was set).
+             *  Every command in the batch was queued before this point, so one
+             *  sample serves the whole batch. */
+            xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+
+            #if ( configUSE_TIMER_WHEEL == 1 )
+            {
+                /* Expiry times are filed in the wheel relative to the time it
+                 * has been advanced to, which only moves when a timer expires.
+                 * Bring it up to the time now before the commands insert any
+                 * timers, as a wheel left behind by more than the tick count
+                 * range less the period of a timer being started would file the
+                 * timer as already due.  The wheel stops early at a timer that
+                 * has expired but not yet been processed. */
+                ( void ) pxListWheelGetExpired( &xActiveTimerWheel, xTimeNow );
+            }
+            #endif /* configUSE_TIMER_WHEEL */
+
+            for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxBatchLength; uxIndex++ )
+            {
+                pxMessage = &( xCommandBatch[ uxIndex ] );
+
+                #if ( INCLUDE_xTimerPendFunctionCall == 1 )
                 {
-                    case tmrCOMMAND_START:
-                    case tmrCOMMAND_START_FROM_ISR:
-                    case tmrCOMMAND_RESET:
-                    case tmrCOMMAND_RESET_FROM_ISR:
-                        /* Start or restart a timer. */
-                        pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
-
-                        if( prvInsertTimerInActiveList( pxTimer, xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) != pdFALSE )
-                        {
-                            /* The timer expired before it was added to the active
-                             * timer list.  Process it now. */
-                            if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
-                            {
-                                prvReloadTimer( pxTimer, xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow );
-                            }
-                            else
-                            {
-                                pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
-                            }
+                    /* Negative commands are pended function calls rather than timer
+                     * commands. */
+                    if( pxMessage->xMessageID < ( BaseType_t ) 0 )
+                    {
+                        const CallbackParameters_t * const pxCallback = &( pxMessage->u.xCallbackParameters );
+
+                        /* The timer uses the xCallbackParameters member to request a
+                         * callback be executed.  Check the callback is not NULL. */
+                        configASSERT( pxCallback );
+
+                        /* Call the function. */
+                        pxCallback->pxCallbackFunction( pxCallback->pvParameter1, pxCallback->ulParameter2 );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* INCLUDE_xTimerPendFunctionCall */
+
+                /* Commands that are positive are timer commands rather than pended
+                 * function calls. */
+                if( pxMessage->xMessageID >= ( BaseType_t ) 0 )
+                {
+                    /* The messages uses the xTimerParameters member to work on a
+                     * software timer. */
+                    pxTimer = pxMessage->u.xTimerParameters.pxTimer;
+
+                    traceTIMER_COMMAND_RECEIVED( pxTimer, pxMessage->xMessageID, pxMessage->u.xTimerParameters.xMessageValue );
 
-                            /* Call the timer callback. */
-                            traceTIMER_EXPIRED( pxTimer );
-                            pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+                    if( prvIsCommandSuperseded( xCommandBatch, uxIndex, uxBatchLength, xTimeNow ) != pdFALSE )
+                    {
+                        /* A later command in the batch overrides this one, so
+                         * this one is skipped.  The timer is left exactly as it
+                         * is, including in the active list, so callbacks called
+                         * by the commands in between do not see the later
+                         * command take effect early.  The later command removes
+                         * the timer from the active list when it is processed. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                    else
+                    {
+                        if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
+                        {
+                            /* The timer is in a list, remove it. */
+                            ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
                         }
                         else
                         {
                             mtCOVERAGE_TEST_MARKER();
                         }
 
-                        break;
-
-                    case tmrCOMMAND_STOP:
-                    case tmrCOMMAND_STOP_FROM_ISR:
-                        /* The timer has already been removed from the active list. */
-                        pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
-                        break;
-
-                    case tmrCOMMAND_CHANGE_PERIOD:
-                    case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR:
-                        pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
-                        pxTimer->xTimerPeriodInTicks = xMessage.u.xTimerParameters.xMessageValue;
-                        configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
-
-                        /* The new period does not really have a reference, and can
-                         * be longer or shorter than the old one.  The command time is
-                         * therefore set to the current time, and as the period cannot
-                         * be zero the next expiry time can only be in the future,
-                         * meaning (unlike for the xTimerStart() case above) there is
-                         * no fail case that needs to be handled here. */
-                        ( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
-                        break;
-
-                    case tmrCOMMAND_DELETE:
-                        #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                        switch( pxMessage->xMessageID )
                         {
-                            /* The timer has already been removed from the active list,
-                             * just free up the memory if the memory was dynamically
-                             * allocated. */
-                            if( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
-                            {
-                                vPortFree( pxTimer );
-                            }
-                            else
-                            {
+                            case tmrCOMMAND_START:
+                            case tmrCOMMAND_START_FROM_ISR:
+                            case tmrCOMMAND_RESET:
+                            case tmrCOMMAND_RESET_FROM_ISR:
+                                /* Start or restart a timer. */
+                                pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
+
+                                if( prvInsertTimerInActiveList( pxTimer, pxMessage->u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, pxMessage->u.xTimerParameters.xMessageValue ) != pdFALSE )
+                                {
+                                    /* The timer expired before it was added to the active
+                                     * timer list.  Process it now. */
+                                    if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
+                                    {
+                                        prvReloadTimer( pxTimer, pxMessage->u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow );
+                                    }
+                                    else
+                                    {
+                                        pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+                                    }
+
+                                    /* Call the timer callback. */
+                                    traceTIMER_EXPIRED( pxTimer );
+                                    pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+                                }
+                                else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
+
+                                break;
+
+                            case tmrCOMMAND_STOP:
+                            case tmrCOMMAND_STOP_FROM_ISR:
+                                /* The timer has already been removed from the active list. */
                                 pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
-                            }
-                        }
-                        #else /* if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
-                        {
-                            /* If dynamic allocation is not enabled, the memory
-                             * could not have been dynamically allocated. So there is
-                             * no need to free the memory - just mark the timer as
-                             * "not active". */
-                            pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+                                break;
+
+                            case tmrCOMMAND_CHANGE_PERIOD:
+                            case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR:
+                                pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
+                                pxTimer->xTimerPeriodInTicks = pxMessage->u.xTimerParameters.xMessageValue;
+                                configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+
+                                /* The new period does not really have a reference, and can
+                                 * be longer or shorter than the old one.  The command time is
+                                 * therefore set to the current time, and as the period cannot
+                                 * be zero the next expiry time can only be in the future,
+                                 * meaning (unlike for the xTimerStart() case above) there is
+                                 * no fail case that needs to be handled here. */
+                                ( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
+                                break;
+
+                            case tmrCOMMAND_DELETE:
+                                #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                                {
+                                    /* The timer has already been removed from the active list,
+                                     * just free up the memory if the memory was dynamically
+                                     * allocated. */
+                                    if( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
+                                    {
+                                        vPortFreeObject( pxTimer );
+                                    }
+                                    else
+                                    {
+                                        pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+                                    }
+                                }
+                                #else /* if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+                                {
+                                    /* If dynamic allocation is not enabled, the memory
+                                     * could not have been dynamically allocated. So there is
+                                     * no need to free the memory - just mark the timer as
+                                     * "not active". */
+                                    pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+                                }
+                                #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+                                break;
+
+                            default:
+                                /* Don't expect to get here. */
+                                break;
                         }
-                        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
-                        break;
-
-                    default:
-                        /* Don't expect to get here. */
-                        break;
+                    }
                 }
             }
         }
     }
 /*-----------------------------------------------------------*/
 
-    static void prvSwitchTimerLists( void )
-    {
-        TickType_t xNextExpireTime;
-        List_t * pxTemp;
+    #if ( configUSE_TIMER_WHEEL == 1 )
+
+        static void prvSwitchTimerLists( void )
+        {
+            TickType_t xNextExpireTime;
+
+            /* The tick count has overflowed.  There are no lists to switch, but
+             * any timers that expire before the overflow must have expired and
+             * should be processed before the wheel moves past it.  For
+             * auto-reload timers, expirations after the overflow are left in the
+             * wheel, as they would be left in the overflow list. */
+            while( xListWheelGetNextExpiry( &xActiveTimerWheel, &xNextExpireTime ) != pdFALSE )
+            {
+                if( tmrEXPIRY_TIME_REACHED( xNextExpireTime, tmrMAX_TIME_BEFORE_OVERFLOW ) )
+                {
+                    prvProcessExpiredTimer( xNextExpireTime, tmrMAX_TIME_BEFORE_OVERFLOW );
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            /* Nothing that remains expires before the overflow. */
+            ( void ) pxListWheelGetExpired( &xActiveTimerWheel, tmrMAX_TIME_BEFORE_OVERFLOW );
+        }
 
-        /* The tick count has overflowed.  The timer lists must be switched.
-         * If there are any timers still referenced from the current timer list
-         * then they must have expired and should be processed before the lists
-         * are switched. */
-        while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+    #else /* configUSE_TIMER_WHEEL */
+
+        static void prvSwitchTimerLists( void )
         {
-            xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+            TickType_t xNextExpireTime;
+            List_t * pxTemp;
+
+            /* The tick count has overflowed.  The timer lists must be switched.
+             * If there are any timers still referenced from the current timer list
+             * then they must have expired and should be processed before the lists
+             * are switched. */
+            while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+            {
+                xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+
+                /* Process the expired timer.  For auto-reload timers, be careful to
+                 * process only expirations that occur on the current list.  Further
+                 * expirations must wait until after the lists are switched. */
+                prvProcessExpiredTimer( xNextExpireTime, tmrMAX_TIME_BEFORE_OVERFLOW );
+            }
 
-            /* Process the expired timer.  For auto-reload timers, be careful to
-             * process only expirations that occur on the current list.  Further
-             * expirations must wait until after the lists are switched. */
-            prvProcessExpiredTimer( xNextExpireTime, tmrMAX_TIME_BEFORE_OVERFLOW );
+            pxTemp = pxCurrentTimerList;
+            pxCurrentTimerList = pxOverflowTimerList;
+            pxOverflowTimerList = pxTemp;
         }
 
-        pxTemp = pxCurrentTimerList;
-        pxCurrentTimerList = pxOverflowTimerList;
-        pxOverflowTimerList = pxTemp;
-    }
+    #endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
     static void prvCheckForValidListAndQueue( void )
@@ -940,10 +1396,18 @@
         {
             if( xTimerQueue == NULL )
             {
-                vListInitialise( &xActiveTimerList1 );
-                vListInitialise( &xActiveTimerList2 );
-                pxCurrentTimerList = &xActiveTimerList1;
-                pxOverflowTimerList = &xActiveTimerList2;
+                #if ( configUSE_TIMER_WHEEL == 1 )
+                {
+                    vListInitialiseWheel( &xActiveTimerWheel, xTaskGetTickCount() );
+                }
+                #else
+                {
+                    vListInitialise( &xActiveTimerList1 );
+                    vListInitialise( &xActiveTimerList2 );
+                    pxCurrentTimerList = &xActiveTimerList1;
+                    pxOverflowTimerList = &xActiveTimerList2;
+                }
+                #endif /* configUSE_TIMER_WHEEL */
 
                 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
                 {